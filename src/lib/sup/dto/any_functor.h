@@ -23,7 +23,16 @@
 #ifndef SUP_DTO_ANY_FUNCTOR_H_
 #define SUP_DTO_ANY_FUNCTOR_H_
 
+#include <sup/dto/basic_scalar_types.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace sup
 {
@@ -55,6 +64,59 @@ protected:
   AnyFunctor& operator=(AnyFunctor&&) & noexcept = default;
 };
 
+/**
+ * @brief The AnyBatchFunctor interface is used to model a function object that processes a batch of
+ * AnyValue inputs in a single call, so that it can amortize its setup over the whole batch.
+ */
+class AnyBatchFunctor
+{
+public:
+  virtual ~AnyBatchFunctor();
+  /**
+   * @brief Call the function object for a batch of inputs.
+   *
+   * @param inputs Pointer to the first of n inputs.
+   * @param outputs Pointer to the first of n outputs, which are assigned the output for the input
+   * with the same index.
+   * @param n Number of inputs and outputs.
+   */
+  virtual void operator()(const sup::dto::AnyValue* inputs, sup::dto::AnyValue* outputs,
+                          std::size_t n) = 0;
+
+protected:
+  AnyBatchFunctor() = default;
+
+  AnyBatchFunctor(const AnyBatchFunctor&) = default;
+  AnyBatchFunctor& operator=(const AnyBatchFunctor&) & = default;
+  AnyBatchFunctor(AnyBatchFunctor&&) noexcept = default;
+  AnyBatchFunctor& operator=(AnyBatchFunctor&&) & noexcept = default;
+};
+
+/**
+ * @brief Adapter that allows calling an AnyFunctor with batches, one input at a time.
+ */
+class AnyFunctorBatchAdapter : public AnyBatchFunctor
+{
+public:
+  explicit AnyFunctorBatchAdapter(AnyFunctor& functor);
+  ~AnyFunctorBatchAdapter() override;
+
+  AnyFunctorBatchAdapter(const AnyFunctorBatchAdapter&) = delete;
+  AnyFunctorBatchAdapter& operator=(const AnyFunctorBatchAdapter&) = delete;
+  AnyFunctorBatchAdapter(AnyFunctorBatchAdapter&&) = delete;
+  AnyFunctorBatchAdapter& operator=(AnyFunctorBatchAdapter&&) = delete;
+
+  /**
+   * @brief Call the underlying functor for each input in turn.
+   *
+   * @note When a call throws, the outputs of the preceding inputs are already assigned.
+   */
+  void operator()(const sup::dto::AnyValue* inputs, sup::dto::AnyValue* outputs,
+                  std::size_t n) override;
+private:
+  AnyFunctor& m_functor;
+};
+
 /**
  * @brief AnyFunctor decorator that effectively serializes concurrent calls to the call operator.
  */
@@ -78,6 +140,188 @@ private:
   std::mutex m_mtx;
 };
 
+/**
+ * @brief AnyFunctor decorator that caches the outputs of a pure function object.
+ *
+ * @details Inputs are looked up by their structural hash (see Hash) and confirmed with equality, so
+ * only calls with an input that compares equal to a cached input return the cached output. The
+ * number of cached entries is bounded: when the cache is full, an entry is evicted with the CLOCK
+ * algorithm, which approximates least-recently-used eviction. Concurrent lookups only take a shared
+ * lock. On a miss, the underlying functor is called without holding any lock, so it must support
+ * concurrent calls when the decorator is called concurrently (see ThreadsafeAnyFunctorDecorator).
+ * Calls that throw are not cached.
+ */
+class MemoizingAnyFunctorDecorator : public AnyFunctor
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param functor Function object whose output only depends on its input.
+   * @param capacity Maximum number of cached entries.
+   *
+   * @throws InvalidOperationException Thrown when the capacity is zero.
+   */
+  MemoizingAnyFunctorDecorator(AnyFunctor& functor, std::size_t capacity);
+  ~MemoizingAnyFunctorDecorator() override;
+
+  MemoizingAnyFunctorDecorator(const MemoizingAnyFunctorDecorator&) = delete;
+  MemoizingAnyFunctorDecorator& operator=(const MemoizingAnyFunctorDecorator&) = delete;
+  MemoizingAnyFunctorDecorator(MemoizingAnyFunctorDecorator&&) = delete;
+  MemoizingAnyFunctorDecorator& operator=(MemoizingAnyFunctorDecorator&&) = delete;
+
+  /**
+   * @brief Get the maximum number of cached entries.
+   */
+  std::size_t Capacity() const;
+
+  /**
+   * @brief Get the current number of cached entries.
+   */
+  std::size_t NumberOfEntries() const;
+
+  /**
+   * @brief Get the number of calls that returned a cached output.
+   */
+  uint64 NumberOfHits() const;
+
+  /**
+   * @brief Get the number of calls that called the underlying functor.
+   */
+  uint64 NumberOfMisses() const;
+
+  /**
+   * @brief Remove all cached entries. The hit and miss counters are not reset.
+   */
+  void Clear();
+
+  /**
+   * @brief Return the cached output for the input or call the underlying functor and cache its
+   * output.
+   */
+  sup::dto::AnyValue operator()(const sup::dto::AnyValue& input) override;
+private:
+  struct Entry;
+  bool Lookup(const sup::dto::AnyValue& input, std::size_t hash, sup::dto::AnyValue& output) const;
+  void Insert(const sup::dto::AnyValue& input, std::size_t hash, const sup::dto::AnyValue& output);
+  std::size_t FindIndex(const sup::dto::AnyValue& input, std::size_t hash) const;
+  std::size_t NextVictim();
+  AnyFunctor& m_functor;
+  std::size_t m_capacity;
+  std::vector<std::unique_ptr<Entry>> m_entries;
+  // Maps input hashes to the indices of the entries with that hash
+  std::unordered_multimap<std::size_t, std::size_t> m_index;
+  // Position of the CLOCK hand
+  std::size_t m_hand;
+  mutable std::shared_mutex m_mtx;
+  std::atomic<uint64> m_hits;
+  std::atomic<uint64> m_misses;
+};
+
+/**
+ * @brief Factory for independently constructed instances of the same function object.
+ */
+using AnyFunctorFactory = std::function<std::unique_ptr<AnyFunctor>()>;
+
+/**
+ * @brief AnyFunctor decorator that executes concurrent calls on a pool of independent instances.
+ *
+ * @details Every call takes an idle instance from a lock-free free-list, calls it and returns it
+ * to the list afterwards. Calls therefore only wait when all instances are busy. Since an instance
+ * is never used by two calls at the same time, the instances themselves do not need to be thread
+ * safe. Consecutive calls are not guaranteed to use the same instance.
+ */
+class PooledAnyFunctorDecorator : public AnyFunctor
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param factory Factory used to construct each of the instances.
+   * @param n_instances Number of instances, typically the number of calling threads.
+   *
+   * @throws InvalidOperationException Thrown when the number of instances is zero or the factory
+   * returns an empty pointer.
+   */
+  PooledAnyFunctorDecorator(const AnyFunctorFactory& factory, std::size_t n_instances);
+  ~PooledAnyFunctorDecorator() override;
+
+  PooledAnyFunctorDecorator(const PooledAnyFunctorDecorator&) = delete;
+  PooledAnyFunctorDecorator& operator=(const PooledAnyFunctorDecorator&) = delete;
+  PooledAnyFunctorDecorator(PooledAnyFunctorDecorator&&) = delete;
+  PooledAnyFunctorDecorator& operator=(PooledAnyFunctorDecorator&&) = delete;
+
+  /**
+   * @brief Get the number of instances in the pool.
+   */
+  std::size_t NumberOfInstances() const;
+
+  /**
+   * @brief Call an idle instance, waiting until one becomes available.
+   */
+  sup::dto::AnyValue operator()(const sup::dto::AnyValue& input) override;
+private:
+  std::size_t Acquire();
+  void Release(std::size_t idx);
+  std::vector<std::unique_ptr<AnyFunctor>> m_functors;
+  // Next index in the free-list for every instance
+  std::unique_ptr<std::atomic<uint32>[]> m_next;
+  // Top of the free-list in the lower half and a modification tag in the upper half, which protects
+  // against reading stale links (ABA problem)
+  std::atomic<uint64> m_head;
+};
+
+/**
+ * @brief AnyFunctor decorator that routes calls to one of several shards, based on a key field of
+ * the input.
+ *
+ * @details Each shard holds an independent instance that serializes its own calls. Calls with keys
+ * that compare equal are always routed to the same shard (using their structural hash), so that
+ * instances can keep state per key, while calls with different keys mostly run concurrently.
+ * Inputs without the key field are routed to the first shard.
+ */
+class ShardedAnyFunctorDecorator : public AnyFunctor
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param factory Factory used to construct the instance of each shard.
+   * @param n_shards Number of shards.
+   * @param key_field Fieldname of the input member used for routing, e.g. "request.session".
+   *
+   * @throws InvalidOperationException Thrown when the number of shards is zero or the factory
+   * returns an empty pointer.
+   */
+  ShardedAnyFunctorDecorator(const AnyFunctorFactory& factory, std::size_t n_shards,
+                             const std::string& key_field);
+  ~ShardedAnyFunctorDecorator() override;
+
+  ShardedAnyFunctorDecorator(const ShardedAnyFunctorDecorator&) = delete;
+  ShardedAnyFunctorDecorator& operator=(const ShardedAnyFunctorDecorator&) = delete;
+  ShardedAnyFunctorDecorator(ShardedAnyFunctorDecorator&&) = delete;
+  ShardedAnyFunctorDecorator& operator=(ShardedAnyFunctorDecorator&&) = delete;
+
+  /**
+   * @brief Get the number of shards.
+   */
+  std::size_t NumberOfShards() const;
+
+  /**
+   * @brief Get the index of the shard that handles the given input.
+   */
+  std::size_t GetShardIndex(const sup::dto::AnyValue& input) const;
+
+  /**
+   * @brief Call the instance of the input's shard while holding the shard's lock.
+   */
+  sup::dto::AnyValue operator()(const sup::dto::AnyValue& input) override;
+private:
+  struct Shard;
+  std::vector<std::unique_ptr<Shard>> m_shards;
+  std::string m_key_field;
+};
+
 }  // namespace dto
 
 }  // namespace sup
@@ -57,7 +57,8 @@ enum class TypeCode : sup::dto::uint32
   Float64,
   String,
   Struct,
-  Array
+  Array,
+  FixedString
 };
 
 const std::string kEmptyTypeName = "empty";
@@ -74,6 +75,7 @@ const std::string kUInt64TypeName = "uint64";
 const std::string kFloat32TypeName = "float32";
 const std::string kFloat64TypeName = "float64";
 const std::string kStringTypeName = "string";
+const std::string kFixedStringTypeName = "fixed_string";
 
 class ITypeData;
 class AnyValue;
@@ -270,6 +272,14 @@ public:
    */
   std::size_t NumberOfElements() const;
 
+  /**
+   * @brief Return the capacity of a fixed-capacity string type.
+   *
+   * @return Number of bytes of the fixed-capacity string, including the terminating null
+   * character, or zero if not supported.
+   */
+  std::size_t StringCapacity() const;
+
   /**
    * @brief Checks if this type has a (nested) subtype with the given field name.
    *
@@ -332,7 +342,18 @@ public:
   AnyType* GetChildType(std::size_t idx);
   const AnyType* GetChildType(std::size_t idx) const;
 
+  /**
+   * @brief Get the name of the member type for the given index, without copying the list of member
+   * names. This is mostly used to be able to visit an AnyType tree.
+   *
+   * @param idx Index of the member type.
+   * @return Name of the member type for the given index.
+   * @throws InvalidOperationException if no member type for the given index exists.
+   */
+  const std::string& GetMemberName(std::size_t idx) const;
+
 private:
+  friend AnyType FixedStringType(std::size_t capacity);
   static std::unique_ptr<AnyType> MakeAnyType(
     const AnyValue& anyvalue, std::vector<std::unique_ptr<AnyType>>&& children);
   static std::unique_ptr<AnyType> MakeStructAnyType(
@@ -366,6 +387,22 @@ AnyType EmptyStructType(const std::string& name);
  */
 AnyType EmptyStructType();
 
+/**
+ * @brief Constructs a fixed-capacity string type.
+ *
+ * @details Values of this type store their characters inline in a buffer of the given capacity, so
+ * that assigning to them never allocates memory. The capacity includes the terminating null
+ * character, i.e. the string can contain at most capacity - 1 characters. The C-type
+ * representation of such a value is a char array of exactly this capacity.
+ *
+ * @param capacity Capacity of the string in bytes.
+ *
+ * @return AnyType with fixed-capacity string type.
+ *
+ * @throws InvalidOperationException Thrown when the capacity is zero.
+ */
+AnyType FixedStringType(std::size_t capacity);
+
 bool IsEmptyTypeCode(TypeCode type_code);
 bool IsStructTypeCode(TypeCode type_code);
 bool IsArrayTypeCode(TypeCode type_code);
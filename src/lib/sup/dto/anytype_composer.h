@@ -64,6 +64,7 @@ public:
   void Float32();
   void Float64();
   void String();
+  void FixedString(std::size_t capacity);
 
   void StartStruct(const std::string& struct_name);
   void StartStruct();
@@ -29,6 +29,7 @@
 #include <sup/dto/basic_scalar_types.h>
 
 #include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <memory>
 #include <string>
@@ -39,7 +40,10 @@ namespace sup
 {
 namespace dto
 {
+class AnyValueHasher;
+class ConversionPlan;
 class IValueData;
+class ThreadPool;
 enum class Constraints : sup::dto::uint32;
 
 /**
@@ -160,6 +164,17 @@ public:
    */
   AnyValue(const AnyValue& other);
 
+  /**
+   * @brief Copy constructor that copies the elements of large arrays in parallel.
+   *
+   * @details Structures are descended into, while the elements of arrays with many elements are
+   * copied in chunks by the threads of the pool. The result is identical to a normal copy.
+   *
+   * @param other Source AnyValue for copy construction.
+   * @param thread_pool Thread pool to use.
+   */
+  AnyValue(const AnyValue& other, ThreadPool& thread_pool);
+
   /**
    * @brief Move constructor.
    *
@@ -170,6 +185,9 @@ public:
   /**
    * @brief Copy assignment.
    *
+   * @details When both values have identical types, the leaves are copied into the existing nodes
+   * of this value, so that no memory needs to be allocated (apart from growing strings).
+   *
    * @param other Source AnyValue for copy assignment.
    *
    * @return Reference to this.
@@ -206,6 +224,61 @@ public:
    */
   void ConvertFrom(const AnyValue& other);
 
+  /**
+   * @brief Try to convert from other AnyValue without changing the underlying type, converting the
+   * elements of large arrays in parallel.
+   *
+   * @note The result is identical to the one of ConvertFrom(other). When the conversion throws,
+   * elements converted by other threads may already have been updated.
+   *
+   * @param other Source AnyValue for conversion.
+   * @param thread_pool Thread pool to use.
+   *
+   * @throws InvalidConversionException Thrown when the given AnyValue cannot be properly converted
+   * to this AnyValue.
+   */
+  void ConvertFrom(const AnyValue& other, ThreadPool& thread_pool);
+
+  /**
+   * @brief Assign a scalar to this scalar value without changing its type and without allocating
+   * memory.
+   *
+   * @details The scalar is converted to the type of this value with the same rules as ConvertFrom.
+   * Unlike assignment from a scalar, no temporary AnyValue is created, so that these functions can
+   * be used to update the leaves of preallocated values in real-time code.
+   *
+   * @param val Scalar to assign.
+   *
+   * @throws InvalidConversionException Thrown when this value is not a scalar value or when the
+   * scalar cannot be converted to its type.
+   */
+  void AssignScalar(boolean val);
+  void AssignScalar(char8 val);
+  void AssignScalar(int8 val);
+  void AssignScalar(uint8 val);
+  void AssignScalar(int16 val);
+  void AssignScalar(uint16 val);
+  void AssignScalar(int32 val);
+  void AssignScalar(uint32 val);
+  void AssignScalar(int64 val);
+  void AssignScalar(uint64 val);
+  void AssignScalar(float32 val);
+  void AssignScalar(float64 val);
+
+  /**
+   * @brief Assign a string to this string value without changing its type.
+   *
+   * @details Fixed-capacity strings never allocate memory, while other strings reuse the capacity
+   * of their current payload and only allocate when they need to grow.
+   *
+   * @param str Zero-terminated string to assign.
+   *
+   * @throws InvalidConversionException Thrown when this value is not a string value or when the
+   * string does not fit in its fixed capacity.
+   */
+  void AssignScalar(const char8* str);
+  void AssignScalar(const std::string& str);
+
   /**
    * @brief Destructor.
    */
@@ -314,6 +387,14 @@ public:
    */
   AnyType ElementType() const;
 
+  /**
+   * @brief Return the capacity of a fixed-capacity string value.
+   *
+   * @return Number of bytes of the fixed-capacity string, including the terminating null
+   * character, or zero if not supported.
+   */
+  std::size_t StringCapacity() const;
+
   /**
    * @brief Cast to given type.
    *
@@ -415,6 +496,16 @@ public:
   bool operator==(const AnyValue& other) const;
   bool operator!=(const AnyValue& other) const;
 
+  /**
+   * @brief Comparison that compares the elements of large arrays in parallel.
+   *
+   * @param other AnyValue to compare this value to.
+   * @param thread_pool Thread pool to use.
+   *
+   * @return true when the values are exactly equal, i.e. when operator== would return true.
+   */
+  bool Equals(const AnyValue& other, ThreadPool& thread_pool) const;
+
   /**
    * @brief Get number of child values. This is mostly used to be able to visit an AnyValue tree
    * structure.
@@ -434,7 +525,21 @@ public:
   AnyValue* GetChildValue(std::size_t idx);
   const AnyValue* GetChildValue(std::size_t idx) const;
 
+  /**
+   * @brief Get the name of the member value for the given index, without copying the list of
+   * member names. This is mostly used to be able to visit an AnyValue tree.
+   *
+   * @param idx Index of the member value.
+   * @return Name of the member value for the given index.
+   * @throws InvalidOperationException if no member value for the given index exists.
+   */
+  const std::string& GetMemberName(std::size_t idx) const;
+
 private:
+  friend class AnyValueHasher;
+  friend class CLayout;
+  friend class ConversionPlan;
+  friend class LeafPayloadAccess;
   static std::unique_ptr<AnyValue> MakeAnyValue(
     const AnyType& anytype, std::vector<std::unique_ptr<AnyValue>>&& children,
     Constraints constraints);
@@ -452,11 +557,14 @@ private:
   AnyValue(const AnyType& anytype, Constraints constraints);
   bool HasChild(const std::string& child_name) const;
   const AnyValue* GetChildValue(const std::string& child_name) const;
+  static std::unique_ptr<AnyValue> ParallelClone(const AnyValue& src, Constraints constraints,
+                                                 ThreadPool& thread_pool);
   std::unique_ptr<AnyValue> CloneFromChildren(std::vector<std::unique_ptr<AnyValue>>&& children,
                                               Constraints constraints) const;
   // Equality function that disregards child values
   bool ShallowEquals(const AnyValue& other) const;
   void ShallowConvertFrom(const AnyValue& other);
+  void AssignString(const char8* str, std::size_t length);
   std::unique_ptr<IValueData> m_data;
 };
 
@@ -582,6 +690,60 @@ void FromBytes(AnyValue& anyvalue, const uint8* bytes, std::size_t total_size);
  */
 void FromNetworkOrderBytes(AnyValue& anyvalue, const uint8* bytes, std::size_t total_size);
 
+/**
+ * @brief Parse an array of consecutive records from an array of bytes that is encoded in host byte
+ * order.
+ * @note Each record has the byte representation described in `ToBytes`. The offsets of all leaves
+ * in a record are computed once per record type, so that large batches of records are decoded
+ * without visiting the type of every record.
+ *
+ * @param record_type Type of the records. It cannot contain unbounded arrays.
+ * @param bytes Array of bytes.
+ * @param total_size Size of the array of bytes. This needs to be a multiple of the record size.
+ *
+ * @return Array value with one element per record.
+ *
+ * @throws ParseException Thrown when the byte array cannot be correctly parsed (e.g. size is not
+ * a multiple of the record size or absence of null terminator in C-style string).
+ * @throws InvalidOperationException Thrown when the record type contains unbounded arrays.
+ */
+AnyValue RecordsFromBytes(const AnyType& record_type, const uint8* bytes, std::size_t total_size);
+
+/**
+ * @brief Parse an array of consecutive records from an array of bytes that is encoded in network
+ * byte order.
+ * @note See `RecordsFromBytes`.
+ */
+AnyValue RecordsFromNetworkOrderBytes(const AnyType& record_type, const uint8* bytes,
+                                      std::size_t total_size);
+
+/**
+ * @brief Parse consecutive records from an array of bytes that is encoded in host byte order into
+ * the given values.
+ * @note See `RecordsFromBytes`. All values need to have the type of the first one.
+ *
+ * @param records Pointer to the first of the values to assign to.
+ * @param n_records Number of values.
+ * @param bytes Array of bytes.
+ * @param total_size Size of the array of bytes. This needs to equal n_records times the record
+ * size.
+ *
+ * @throws ParseException Thrown when the byte array cannot be correctly parsed (e.g. sizes
+ * don't match, values of different types or absence of null terminator in C-style string). The
+ * values can then be partially assigned.
+ * @throws InvalidOperationException Thrown when the record type contains unbounded arrays.
+ */
+void RecordsFromBytes(AnyValue* records, std::size_t n_records, const uint8* bytes,
+                      std::size_t total_size);
+
+/**
+ * @brief Parse consecutive records from an array of bytes that is encoded in network byte order
+ * into the given values.
+ * @note See `RecordsFromBytes`.
+ */
+void RecordsFromNetworkOrderBytes(AnyValue* records, std::size_t n_records, const uint8* bytes,
+                                  std::size_t total_size);
+
 template <typename T>
 T AnyValue::ToCType() const
 {
@@ -709,4 +871,16 @@ bool SafeAssignFromCType(AnyValue& anyvalue, const T& object)
 
 }  // namespace sup
 
+namespace std
+{
+/**
+ * @brief Hash specialization that allows using AnyValue as a key in unordered containers. It
+ * returns the structural hash sup::dto::Hash, which is consistent with AnyValue equality.
+ */
+template <> struct hash<::sup::dto::AnyValue>
+{
+  size_t operator()(const ::sup::dto::AnyValue& val) const;
+};
+}  // namespace std
+
 #endif  // SUP_DTO_ANYVALUE_H_
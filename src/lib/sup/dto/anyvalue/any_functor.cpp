@@ -23,14 +23,55 @@
 #include <sup/dto/any_functor.h>
 
 #include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_operations.h>
+
+#include <thread>
 
 namespace sup
 {
 namespace dto
 {
+namespace
+{
+// Free-list index that marks the end of the list
+const uint32 kNoInstance = 0xFFFFFFFFu;
+
+const uint64 kIndexMask = 0xFFFFFFFFu;
+
+const uint64 kTagIncrement = uint64{1} << 32;
+
+std::unique_ptr<AnyFunctor> CreateInstance(const AnyFunctorFactory& factory);
+}  // unnamed namespace
+
+struct ShardedAnyFunctorDecorator::Shard
+{
+  explicit Shard(std::unique_ptr<AnyFunctor>&& functor_);
+
+  std::unique_ptr<AnyFunctor> functor;
+  ThreadsafeAnyFunctorDecorator decorator;
+};
 
 AnyFunctor::~AnyFunctor() = default;
 
+AnyBatchFunctor::~AnyBatchFunctor() = default;
+
+AnyFunctorBatchAdapter::AnyFunctorBatchAdapter(AnyFunctor& functor)
+  : AnyBatchFunctor{}
+  , m_functor{functor}
+{}
+
+AnyFunctorBatchAdapter::~AnyFunctorBatchAdapter() = default;
+
+void AnyFunctorBatchAdapter::operator()(const sup::dto::AnyValue* inputs,
+                                        sup::dto::AnyValue* outputs, std::size_t n)
+{
+  for (std::size_t idx = 0; idx < n; ++idx)
+  {
+    outputs[idx] = m_functor(inputs[idx]);
+  }
+}
+
 ThreadsafeAnyFunctorDecorator::ThreadsafeAnyFunctorDecorator(AnyFunctor& functor)
   : AnyFunctor{}
   , m_functor{functor}
@@ -45,6 +86,301 @@ sup::dto::AnyValue ThreadsafeAnyFunctorDecorator::operator()(const sup::dto::Any
   return m_functor(input);
 }
 
+struct MemoizingAnyFunctorDecorator::Entry
+{
+  Entry(const sup::dto::AnyValue& input_, std::size_t hash_, const sup::dto::AnyValue& output_);
+
+  sup::dto::AnyValue input;
+  sup::dto::AnyValue output;
+  std::size_t hash;
+  // Set on every hit and cleared when passed by the CLOCK hand
+  std::atomic<bool> referenced;
+};
+
+MemoizingAnyFunctorDecorator::MemoizingAnyFunctorDecorator(AnyFunctor& functor,
+                                                           std::size_t capacity)
+  : AnyFunctor{}
+  , m_functor{functor}
+  , m_capacity{capacity}
+  , m_entries{}
+  , m_index{}
+  , m_hand{0}
+  , m_mtx{}
+  , m_hits{0}
+  , m_misses{0}
+{
+  if (capacity == 0)
+  {
+    throw InvalidOperationException("MemoizingAnyFunctorDecorator: capacity cannot be zero");
+  }
+}
+
+MemoizingAnyFunctorDecorator::~MemoizingAnyFunctorDecorator() = default;
+
+std::size_t MemoizingAnyFunctorDecorator::Capacity() const
+{
+  return m_capacity;
+}
+
+std::size_t MemoizingAnyFunctorDecorator::NumberOfEntries() const
+{
+  const std::shared_lock<std::shared_mutex> lk{m_mtx};
+  return m_entries.size();
+}
+
+uint64 MemoizingAnyFunctorDecorator::NumberOfHits() const
+{
+  return m_hits.load(std::memory_order_relaxed);
+}
+
+uint64 MemoizingAnyFunctorDecorator::NumberOfMisses() const
+{
+  return m_misses.load(std::memory_order_relaxed);
+}
+
+void MemoizingAnyFunctorDecorator::Clear()
+{
+  const std::lock_guard<std::shared_mutex> lk{m_mtx};
+  m_entries.clear();
+  m_index.clear();
+  m_hand = 0;
+}
+
+sup::dto::AnyValue MemoizingAnyFunctorDecorator::operator()(const sup::dto::AnyValue& input)
+{
+  const auto hash = Hash(input);
+  sup::dto::AnyValue output;
+  if (Lookup(input, hash, output))
+  {
+    (void)m_hits.fetch_add(1, std::memory_order_relaxed);
+    return output;
+  }
+  (void)m_misses.fetch_add(1, std::memory_order_relaxed);
+  output = m_functor(input);
+  Insert(input, hash, output);
+  return output;
+}
+
+bool MemoizingAnyFunctorDecorator::Lookup(const sup::dto::AnyValue& input, std::size_t hash,
+                                          sup::dto::AnyValue& output) const
+{
+  const std::shared_lock<std::shared_mutex> lk{m_mtx};
+  const auto idx = FindIndex(input, hash);
+  if (idx == m_entries.size())
+  {
+    return false;
+  }
+  auto& entry = *m_entries[idx];
+  entry.referenced.store(true, std::memory_order_relaxed);
+  output = entry.output;
+  return true;
+}
+
+void MemoizingAnyFunctorDecorator::Insert(const sup::dto::AnyValue& input, std::size_t hash,
+                                          const sup::dto::AnyValue& output)
+{
+  const std::lock_guard<std::shared_mutex> lk{m_mtx};
+  // Another call with the same input may have inserted it in the meantime
+  if (FindIndex(input, hash) != m_entries.size())
+  {
+    return;
+  }
+  if (m_entries.size() < m_capacity)
+  {
+    (void)m_index.emplace(hash, m_entries.size());
+    m_entries.push_back(std::make_unique<Entry>(input, hash, output));
+    return;
+  }
+  const auto idx = NextVictim();
+  const auto range = m_index.equal_range(m_entries[idx]->hash);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    if (it->second == idx)
+    {
+      (void)m_index.erase(it);
+      break;
+    }
+  }
+  (void)m_index.emplace(hash, idx);
+  m_entries[idx] = std::make_unique<Entry>(input, hash, output);
+}
+
+std::size_t MemoizingAnyFunctorDecorator::FindIndex(const sup::dto::AnyValue& input,
+                                                    std::size_t hash) const
+{
+  const auto range = m_index.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    if (m_entries[it->second]->input == input)
+    {
+      return it->second;
+    }
+  }
+  return m_entries.size();
+}
+
+std::size_t MemoizingAnyFunctorDecorator::NextVictim()
+{
+  // Entries that were hit since the hand last passed get a second chance. This terminates after at
+  // most one full revolution, since the hand clears the flags it passes.
+  while (true)
+  {
+    const auto idx = m_hand;
+    m_hand = (m_hand + 1) % m_entries.size();
+    if (!m_entries[idx]->referenced.exchange(false, std::memory_order_relaxed))
+    {
+      return idx;
+    }
+  }
+}
+
+MemoizingAnyFunctorDecorator::Entry::Entry(const sup::dto::AnyValue& input_, std::size_t hash_,
+                                           const sup::dto::AnyValue& output_)
+  : input{input_}
+  , output{output_}
+  , hash{hash_}
+  , referenced{false}
+{}
+
+PooledAnyFunctorDecorator::PooledAnyFunctorDecorator(const AnyFunctorFactory& factory,
+                                                     std::size_t n_instances)
+  : AnyFunctor{}
+  , m_functors{}
+  , m_next{}
+  , m_head{kNoInstance}
+{
+  if (n_instances == 0 || n_instances >= kNoInstance)
+  {
+    throw InvalidOperationException("PooledAnyFunctorDecorator: invalid number of instances");
+  }
+  m_functors.reserve(n_instances);
+  m_next.reset(new std::atomic<uint32>[n_instances]);
+  for (std::size_t idx = 0; idx < n_instances; ++idx)
+  {
+    m_functors.push_back(CreateInstance(factory));
+    m_next[idx].store(kNoInstance, std::memory_order_relaxed);
+  }
+  for (std::size_t idx = n_instances; idx > 0; --idx)
+  {
+    Release(idx - 1);
+  }
+}
+
+PooledAnyFunctorDecorator::~PooledAnyFunctorDecorator() = default;
+
+std::size_t PooledAnyFunctorDecorator::NumberOfInstances() const
+{
+  return m_functors.size();
+}
+
+sup::dto::AnyValue PooledAnyFunctorDecorator::operator()(const sup::dto::AnyValue& input)
+{
+  const auto idx = Acquire();
+  try
+  {
+    auto result = (*m_functors[idx])(input);
+    Release(idx);
+    return result;
+  }
+  catch(...)
+  {
+    Release(idx);
+    throw;
+  }
+}
+
+std::size_t PooledAnyFunctorDecorator::Acquire()
+{
+  auto head = m_head.load(std::memory_order_acquire);
+  while (true)
+  {
+    const auto idx = static_cast<uint32>(head & kIndexMask);
+    if (idx == kNoInstance)
+    {
+      // All instances are busy
+      std::this_thread::yield();
+      head = m_head.load(std::memory_order_acquire);
+      continue;
+    }
+    const uint64 next = m_next[idx].load(std::memory_order_relaxed);
+    const auto new_head = ((head & ~kIndexMask) + kTagIncrement) | next;
+    if (m_head.compare_exchange_weak(head, new_head, std::memory_order_acquire,
+                                     std::memory_order_acquire))
+    {
+      return idx;
+    }
+  }
+}
+
+void PooledAnyFunctorDecorator::Release(std::size_t idx)
+{
+  auto head = m_head.load(std::memory_order_relaxed);
+  uint64 new_head = 0;
+  do
+  {
+    m_next[idx].store(static_cast<uint32>(head & kIndexMask), std::memory_order_relaxed);
+    new_head = ((head & ~kIndexMask) + kTagIncrement) | idx;
+  } while (!m_head.compare_exchange_weak(head, new_head, std::memory_order_release,
+                                         std::memory_order_relaxed));
+}
+
+ShardedAnyFunctorDecorator::ShardedAnyFunctorDecorator(const AnyFunctorFactory& factory,
+                                                       std::size_t n_shards,
+                                                       const std::string& key_field)
+  : AnyFunctor{}
+  , m_shards{}
+  , m_key_field{key_field}
+{
+  if (n_shards == 0)
+  {
+    throw InvalidOperationException("ShardedAnyFunctorDecorator: number of shards cannot be zero");
+  }
+  m_shards.reserve(n_shards);
+  for (std::size_t idx = 0; idx < n_shards; ++idx)
+  {
+    m_shards.push_back(std::make_unique<Shard>(CreateInstance(factory)));
+  }
+}
+
+ShardedAnyFunctorDecorator::~ShardedAnyFunctorDecorator() = default;
+
+std::size_t ShardedAnyFunctorDecorator::NumberOfShards() const
+{
+  return m_shards.size();
+}
+
+std::size_t ShardedAnyFunctorDecorator::GetShardIndex(const sup::dto::AnyValue& input) const
+{
+  if (m_shards.size() == 1 || !input.HasField(m_key_field))
+  {
+    return 0;
+  }
+  return Hash(input[m_key_field]) % m_shards.size();
+}
+
+sup::dto::AnyValue ShardedAnyFunctorDecorator::operator()(const sup::dto::AnyValue& input)
+{
+  return m_shards[GetShardIndex(input)]->decorator(input);
+}
+
+ShardedAnyFunctorDecorator::Shard::Shard(std::unique_ptr<AnyFunctor>&& functor_)
+  : functor{std::move(functor_)}
+  , decorator{*functor}
+{}
+
+namespace
+{
+std::unique_ptr<AnyFunctor> CreateInstance(const AnyFunctorFactory& factory)
+{
+  auto functor = factory();
+  if (!functor)
+  {
+    throw InvalidOperationException("AnyFunctorFactory returned an empty functor");
+  }
+  return functor;
+}
+}  // unnamed namespace
+
 }  // namespace dto
 
 }  // namespace sup
@@ -27,6 +27,7 @@
 #include <sup/dto/anyvalue/anytype_from_anyvalue_node.h>
 #include <sup/dto/anyvalue/array_type_data.h>
 #include <sup/dto/anyvalue/empty_type_data.h>
+#include <sup/dto/anyvalue/fixed_string_type_data.h>
 #include <sup/dto/anyvalue/node_utils.h>
 #include <sup/dto/anyvalue/scalar_type_data.h>
 #include <sup/dto/anyvalue/struct_type_data.h>
@@ -218,6 +219,11 @@ std::size_t AnyType::NumberOfElements() const
   return m_data->NumberOfElements();
 }
 
+std::size_t AnyType::StringCapacity() const
+{
+  return m_data->StringCapacity();
+}
+
 bool AnyType::HasField(const std::string& fieldname) const
 {
   std::deque<std::string> field_names;
@@ -311,6 +317,11 @@ const AnyType* AnyType::GetChildType(std::size_t idx) const
   return m_data->GetChildType(idx);
 }
 
+const std::string& AnyType::GetMemberName(std::size_t idx) const
+{
+  return m_data->GetMemberName(idx);
+}
+
 std::unique_ptr<AnyType> AnyType::MakeAnyType(
   const AnyValue& anyvalue, std::vector<std::unique_ptr<AnyType>>&& children)
 {
@@ -355,6 +366,10 @@ std::unique_ptr<AnyType> AnyType::MakeArrayAnyType(const AnyValue& anyvalue)
 
 std::unique_ptr<AnyType> AnyType::MakeScalarAnyType(const AnyValue& anyvalue)
 {
+  if (anyvalue.GetTypeCode() == TypeCode::FixedString)
+  {
+    return std::make_unique<AnyType>(FixedStringType(anyvalue.StringCapacity()));
+  }
   return std::unique_ptr<AnyType>{new AnyType{CreateScalarData(anyvalue.GetTypeCode())}};
 }
 
@@ -398,6 +413,11 @@ AnyType EmptyStructType()
   return EmptyStructType({});
 }
 
+AnyType FixedStringType(std::size_t capacity)
+{
+  return AnyType{std::make_unique<FixedStringTypeData>(capacity)};
+}
+
 bool IsEmptyTypeCode(TypeCode type_code)
 {
   return type_code == TypeCode::Empty;
@@ -502,6 +522,7 @@ std::unordered_set<TypeCode> ScalarTypes()
   {
     (void)result.insert(type_def.first);
   }
+  (void)result.insert(TypeCode::FixedString);
   return result;
 }
 
@@ -91,7 +91,7 @@ std::vector<uint8> AnyTypeToBinary(const AnyType& anytype)
   std::vector<uint8> result;
   result.push_back(ANYTYPE_TOKEN);
   BinaryTypeSerializer serializer{result};
-  SerializeAnyType(anytype, serializer);
+  VisitStatic<BinaryTypeSerializer>(anytype, serializer);
   return result;
 }
 
@@ -23,18 +23,23 @@
 #include <sup/dto/anyvalue.h>
 
 #include <sup/dto/anyvalue/anyvalue_compare_node.h>
-#include <sup/dto/anyvalue/anyvalue_convert_node.h>
 #include <sup/dto/anyvalue/anyvalue_copy_node.h>
 #include <sup/dto/anyvalue/array_value_data.h>
+#include <sup/dto/anyvalue/conversion_plan.h>
 #include <sup/dto/anyvalue/empty_value_data.h>
+#include <sup/dto/anyvalue/fixed_string_value_data.h>
 #include <sup/dto/anyvalue/anyvalue_from_anytype_node.h>
 #include <sup/dto/anyvalue/node_utils.h>
 #include <sup/dto/anyvalue/scalar_value_data_t.h>
 #include <sup/dto/anyvalue/struct_value_data.h>
 #include <sup/dto/parse/ctype_parser.h>
+#include <sup/dto/parse/record_decoder.h>
 #include <sup/dto/serialize/ctype_serializer.h>
+#include <sup/dto/serialize/network_order_layout.h>
+#include <sup/dto/serialize/serialization_plan.h>
 #include <sup/dto/visit/visit_t.h>
 
+#include <cstring>
 #include <stdexcept>
 
 namespace
@@ -46,6 +51,14 @@ std::unique_ptr<IValueData> CreateUnconstrainedScalarData(const T& val)
   return std::make_unique<ScalarValueDataT<T>>(val, Constraints::kNone);
 }
 
+template <typename T>
+void AssignScalarT(AnyValue& anyvalue, T val)
+{
+  // The source payload lives on the stack, so that no memory is allocated
+  const ScalarValueDataT<T> src_data{val, Constraints::kNone};
+  ConversionPlan::ConvertScalarData(anyvalue, src_data);
+}
+
 // Split a possibly nested value path into the first component and the rest:
 std::pair<std::string, std::string> SplitAnyValueFieldnameInHeadTail(const std::string& fieldname);
 
@@ -58,6 +71,12 @@ std::pair<std::string, std::string> SplitAnyValueFieldnameOnStructCharacter(
 bool CheckAnyValueComponentFieldname(const std::string& fieldname);
 
 bool CheckIndexString(const std::string& index_string);
+
+AnyValue DecodeRecordArray(const AnyType& record_type, const uint8* bytes, std::size_t total_size,
+                           CTypeParser::ByteOrder byte_order);
+
+void DecodeRecords(AnyValue* records, std::size_t n_records, const uint8* bytes,
+                   std::size_t total_size, CTypeParser::ByteOrder byte_order);
 }  // namespace
 
 namespace sup
@@ -196,7 +215,12 @@ AnyValue& AnyValue::operator=(const AnyValue& other) &
 {
   if (this != std::addressof(other))
   {
-    if (IsLockedTypeConstraint(m_data->GetConstraints()))
+    // Identical types: update the existing nodes in place, without allocating new ones
+    if (ConversionPlan::HaveIdenticalTypes(*this, other))
+    {
+      ConversionPlan::CopyIdenticalValue(*this, other);
+    }
+    else if (IsLockedTypeConstraint(m_data->GetConstraints()))
     {
       ConvertFrom(other);
     }
@@ -211,14 +235,11 @@ AnyValue& AnyValue::operator=(const AnyValue& other) &
 
 AnyValue& AnyValue::operator=(AnyValue&& other) &
 {
-  if (IsLockedTypeConstraint(m_data->GetConstraints()))
+  if (IsLockedTypeConstraint(m_data->GetConstraints()) ||
+      IsLockedTypeConstraint(other.m_data->GetConstraints()))
   {
-    ConvertFrom(other);
-  }
-  else if (IsLockedTypeConstraint(other.m_data->GetConstraints()))
-  {
-    AnyValue copy{other};
-    std::swap(m_data, copy.m_data);
+    // Nodes cannot be taken over from the other value: copy into the existing nodes if possible
+    *this = static_cast<const AnyValue&>(other);
   }
   else
   {
@@ -229,27 +250,83 @@ AnyValue& AnyValue::operator=(AnyValue&& other) &
 
 void AnyValue::ConvertFrom(const AnyValue& other)
 {
-  // Only push nodes that didn't throw on conversion:
-  ShallowConvertFrom(other);
-  std::deque<AnyValueConvertNode> queue;
-  (void)queue.emplace_back(this, std::addressof(other));
-  while (!queue.empty())
+  if (IsScalar() && other.IsScalar())
   {
-    auto& last_node = queue.back();
-    if (last_node.m_index >= last_node.m_n_children)
-    {
-      queue.pop_back();
-    }
-    else
-    {
-      auto idx = last_node.m_index++;
-      auto left_child = last_node.m_left->GetChildValue(idx);
-      auto right_child = last_node.m_right->GetChildValue(idx);
-      // Only push nodes that didn't throw on conversion:
-      left_child->ShallowConvertFrom(*right_child);
-      (void)queue.emplace_back(left_child, right_child);
-    }
+    ConversionPlan::ConvertScalarValue(*this, other);
+    return;
   }
+  const auto plan = GetConversionPlan(*this, other);
+  plan->Execute(*this, other);
+}
+
+void AnyValue::AssignScalar(boolean val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(char8 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(int8 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(uint8 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(int16 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(uint16 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(int32 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(uint32 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(int64 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(uint64 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(float32 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(float64 val)
+{
+  AssignScalarT(*this, val);
+}
+
+void AnyValue::AssignScalar(const char8* str)
+{
+  AssignString(str, std::strlen(str));
+}
+
+void AnyValue::AssignScalar(const std::string& str)
+{
+  AssignString(str.data(), str.size());
 }
 
 AnyValue::~AnyValue()
@@ -332,6 +409,11 @@ AnyType AnyValue::ElementType() const
   return m_data->ElementType();
 }
 
+std::size_t AnyValue::StringCapacity() const
+{
+  return m_data->StringCapacity();
+}
+
 template <>
 AnyValue AnyValue::As<AnyValue>() const
 {
@@ -519,6 +601,11 @@ const AnyValue* AnyValue::GetChildValue(std::size_t idx) const
   return m_data->GetChildValue(idx);
 }
 
+const std::string& AnyValue::GetMemberName(std::size_t idx) const
+{
+  return m_data->GetMemberName(idx);
+}
+
 std::unique_ptr<AnyValue> AnyValue::MakeAnyValue(
   const AnyType& anytype, std::vector<std::unique_ptr<AnyValue>>&& children,
   Constraints constraints)
@@ -572,6 +659,12 @@ std::unique_ptr<AnyValue> AnyValue::MakeArrayAnyValue(
 std::unique_ptr<AnyValue> AnyValue::MakeScalarAnyValue(const AnyType& anytype,
                                                        Constraints constraints)
 {
+  if (anytype.GetTypeCode() == TypeCode::FixedString)
+  {
+    std::unique_ptr<IValueData> val_data =
+      std::make_unique<FixedStringValueData>(anytype.StringCapacity(), constraints);
+    return std::unique_ptr<AnyValue>{new AnyValue{std::move(val_data)}};
+  }
   std::unique_ptr<IValueData> val_data = CreateScalarValueData(anytype.GetTypeCode(), constraints);
   return std::unique_ptr<AnyValue>{new AnyValue{std::move(val_data)}};
 }
@@ -673,6 +766,22 @@ void AnyValue::ShallowConvertFrom(const AnyValue& other)
   m_data->ShallowConvertFrom(other);
 }
 
+void AnyValue::AssignString(const char8* str, std::size_t length)
+{
+  switch (GetTypeCode())
+  {
+  case TypeCode::FixedString:
+    static_cast<FixedStringValueData&>(*m_data).Assign(str, length);
+    break;
+  case TypeCode::String:
+    // Assignment reuses the capacity of the payload
+    (void)static_cast<ScalarValueDataT<std::string>&>(*m_data).GetValue().assign(str, length);
+    break;
+  default:
+    throw InvalidConversionException("Can only assign strings to string values");
+  }
+}
+
 AnyValue EmptyStruct(const std::string& type_name)
 {
   return AnyValue(EmptyStructType(type_name));
@@ -731,22 +840,33 @@ std::deque<std::string> SplitAnyValueFieldname(const std::string& fieldname)
 
 std::vector<uint8> ToBytes(const AnyValue& anyvalue)
 {
+  const auto plan = GetSerializationPlan(anyvalue);
   CTypeSerializer serializer{CTypeSerializer::ByteOrder::Host};
-  Visit(anyvalue, serializer);
+  if (plan->HasFixedSize())
+  {
+    serializer.Reserve(plan->GetFixedSize());
+  }
+  plan->Execute<CTypeSerializer>(anyvalue, serializer);
   return serializer.GetRepresentation();
 }
 
 std::vector<uint8> ToNetworkOrderBytes(const AnyValue& anyvalue)
 {
+  const auto layout = GetNetworkOrderLayout(anyvalue);
+  if (layout)
+  {
+    return layout->Write(anyvalue);
+  }
   CTypeSerializer serializer{CTypeSerializer::ByteOrder::Network};
-  Visit(anyvalue, serializer);
+  GetSerializationPlan(anyvalue)->Execute<CTypeSerializer>(anyvalue, serializer);
   return serializer.GetRepresentation();
 }
 
 void FromBytes(AnyValue& anyvalue, const uint8* bytes, std::size_t total_size)
 {
+  const auto plan = GetSerializationPlan(anyvalue);
   CTypeParser byte_parser{bytes, total_size, CTypeParser::ByteOrder::Host};
-  Visit(anyvalue, byte_parser);
+  plan->Execute<CTypeParser>(anyvalue, byte_parser);
   if (!byte_parser.IsFinished())
   {
     throw ParseException("FromBytes ended before parsing all input bytes");
@@ -755,14 +875,43 @@ void FromBytes(AnyValue& anyvalue, const uint8* bytes, std::size_t total_size)
 
 void FromNetworkOrderBytes(AnyValue& anyvalue, const uint8* bytes, std::size_t total_size)
 {
+  const auto layout = GetNetworkOrderLayout(anyvalue);
+  if (layout)
+  {
+    layout->Read(anyvalue, bytes, total_size);
+    return;
+  }
   CTypeParser byte_parser{bytes, total_size, CTypeParser::ByteOrder::Network};
-  Visit(anyvalue, byte_parser);
+  GetSerializationPlan(anyvalue)->Execute<CTypeParser>(anyvalue, byte_parser);
   if (!byte_parser.IsFinished())
   {
     throw ParseException("FromNetworkOrderBytes ended before parsing all input bytes");
   }
 }
 
+AnyValue RecordsFromBytes(const AnyType& record_type, const uint8* bytes, std::size_t total_size)
+{
+  return DecodeRecordArray(record_type, bytes, total_size, CTypeParser::ByteOrder::Host);
+}
+
+AnyValue RecordsFromNetworkOrderBytes(const AnyType& record_type, const uint8* bytes,
+                                      std::size_t total_size)
+{
+  return DecodeRecordArray(record_type, bytes, total_size, CTypeParser::ByteOrder::Network);
+}
+
+void RecordsFromBytes(AnyValue* records, std::size_t n_records, const uint8* bytes,
+                      std::size_t total_size)
+{
+  DecodeRecords(records, n_records, bytes, total_size, CTypeParser::ByteOrder::Host);
+}
+
+void RecordsFromNetworkOrderBytes(AnyValue* records, std::size_t n_records, const uint8* bytes,
+                                  std::size_t total_size)
+{
+  DecodeRecords(records, n_records, bytes, total_size, CTypeParser::ByteOrder::Network);
+}
+
 }  // namespace dto
 
 }  // namespace sup
@@ -882,4 +1031,47 @@ bool CheckIndexString(const std::string& index_string)
   return pos == index_string.size();
 }
 
+AnyValue DecodeRecordArray(const AnyType& record_type, const uint8* bytes, std::size_t total_size,
+                           CTypeParser::ByteOrder byte_order)
+{
+  const auto decoder = GetRecordDecoder(record_type, byte_order);
+  const auto record_size = decoder->GetRecordSize();
+  if (record_size == 0 || total_size % record_size != 0)
+  {
+    throw ParseException("Size of byte array is not a multiple of the record size");
+  }
+  const auto n_records = total_size / record_size;
+  AnyValue result{n_records, record_type};
+  std::vector<uint8> buffer;
+  for (std::size_t idx = 0; idx < n_records; ++idx)
+  {
+    decoder->Decode(result[idx], bytes + idx * record_size, buffer);
+  }
+  return result;
+}
+
+void DecodeRecords(AnyValue* records, std::size_t n_records, const uint8* bytes,
+                   std::size_t total_size, CTypeParser::ByteOrder byte_order)
+{
+  if (n_records == 0)
+  {
+    if (total_size != 0)
+    {
+      throw ParseException("Size of byte array doesn't match the number of records");
+    }
+    return;
+  }
+  const auto decoder = GetRecordDecoder(records[0], byte_order);
+  const auto record_size = decoder->GetRecordSize();
+  if (total_size != n_records * record_size)
+  {
+    throw ParseException("Size of byte array doesn't match the number of records");
+  }
+  std::vector<uint8> buffer;
+  for (std::size_t idx = 0; idx < n_records; ++idx)
+  {
+    decoder->Decode(records[idx], bytes + idx * record_size, buffer);
+  }
+}
+
 }  // namespace
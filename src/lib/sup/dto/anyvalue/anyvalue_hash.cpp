@@ -0,0 +1,494 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/anyvalue_operations.h>
+
+#include <sup/dto/anyvalue/fixed_string_value_data.h>
+#include <sup/dto/anyvalue/scalar_value_data_t.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+// Tags that separate the different kinds of nodes in the hashed sequence:
+const uint64 kEmptyTag = 0x01;
+const uint64 kNumberTag = 0x02;
+const uint64 kStringTag = 0x03;
+const uint64 kStructTag = 0x04;
+const uint64 kArrayTag = 0x05;
+
+const uint64 kPrime1 = 0x9E3779B185EBCA87ull;
+const uint64 kPrime2 = 0xC2B2AE3D27D4EB4Full;
+const uint64 kPrime3 = 0x165667B19E3779F9ull;
+const uint64 kPrime4 = 0x85EBCA77C2B2AE63ull;
+
+// Number of array elements that are gathered before hashing them in bulk
+const std::size_t kHashBlockSize = 64;
+
+/**
+ * @brief Accumulates a sequence of 64 bit words into a hash value, using the round, merge and
+ * avalanche functions of xxHash64.
+ *
+ * @details Runs of words are hashed in stripes of four independent lanes, which removes the
+ * dependency between consecutive multiplications and lets the processor hash several words per
+ * cycle.
+ */
+class HashState
+{
+public:
+  HashState();
+  ~HashState();
+
+  HashState(const HashState& other) = delete;
+  HashState(HashState&& other) = delete;
+  HashState& operator=(const HashState& other) = delete;
+  HashState& operator=(HashState&& other) = delete;
+
+  void Add(uint64 word);
+  void AddWords(const uint64* words, std::size_t n);
+  void AddBytes(const char* data, std::size_t size);
+
+  std::size_t Finalize() const;
+
+private:
+  uint64 m_state;
+};
+
+uint64 RotateLeft(uint64 word, unsigned shift);
+
+uint64 Round(uint64 acc, uint64 word);
+
+uint64 CanonicalWord(boolean value);
+uint64 CanonicalWord(char8 value);
+uint64 CanonicalWord(int8 value);
+uint64 CanonicalWord(uint8 value);
+uint64 CanonicalWord(int16 value);
+uint64 CanonicalWord(uint16 value);
+uint64 CanonicalWord(int32 value);
+uint64 CanonicalWord(uint32 value);
+uint64 CanonicalWord(int64 value);
+uint64 CanonicalWord(uint64 value);
+uint64 CanonicalWord(float32 value);
+uint64 CanonicalWord(float64 value);
+
+template <typename T>
+uint64 ScalarWord(const IValueData& data);
+
+void HashScalar(HashState& state, const IValueData& data);
+}  // unnamed namespace
+
+/**
+ * @brief Structural hashing of AnyValue trees with direct access to their value nodes.
+ */
+class AnyValueHasher
+{
+public:
+  static std::size_t HashValue(const AnyValue& value);
+
+private:
+  struct Frame
+  {
+    const AnyValue* node;
+    std::size_t next_child;
+    std::size_t n_children;
+  };
+  static bool HashNode(HashState& state, const AnyValue& node);
+  static bool HashNumericElements(HashState& state, const AnyValue& array, std::size_t n);
+  template <typename T>
+  static void HashElements(HashState& state, const AnyValue& array, std::size_t n);
+};
+
+std::size_t Hash(const AnyValue& value)
+{
+  return AnyValueHasher::HashValue(value);
+}
+
+std::size_t AnyValueHasher::HashValue(const AnyValue& value)
+{
+  HashState state;
+  if (!HashNode(state, value))
+  {
+    return state.Finalize();
+  }
+  // Depth-first traversal in member/element order. Since every node hashes its number of children,
+  // the hashed sequence uniquely encodes the tree.
+  std::vector<Frame> stack{{std::addressof(value), 0, value.NumberOfChildren()}};
+  while (!stack.empty())
+  {
+    auto& frame = stack.back();
+    if (frame.next_child == frame.n_children)
+    {
+      stack.pop_back();
+      continue;
+    }
+    const auto* child = frame.node->GetChildValue(frame.next_child++);
+    if (HashNode(state, *child))
+    {
+      stack.push_back({child, 0, child->NumberOfChildren()});
+    }
+  }
+  return state.Finalize();
+}
+
+bool AnyValueHasher::HashNode(HashState& state, const AnyValue& node)
+{
+  const auto& data = *node.m_data;
+  if (data.IsScalar())
+  {
+    HashScalar(state, data);
+    return false;
+  }
+  const auto type_code = data.GetTypeCode();
+  if (type_code == TypeCode::Empty)
+  {
+    state.Add(kEmptyTag);
+    return false;
+  }
+  const auto n_children = data.NumberOfChildren();
+  const auto& type_name = data.GetTypeName();
+  state.Add(type_code == TypeCode::Struct ? kStructTag : kArrayTag);
+  state.AddBytes(type_name.data(), type_name.size());
+  state.Add(n_children);
+  if (type_code == TypeCode::Struct)
+  {
+    for (std::size_t idx = 0; idx < n_children; ++idx)
+    {
+      const auto& member_name = data.GetMemberName(idx);
+      state.AddBytes(member_name.data(), member_name.size());
+    }
+    return n_children > 0;
+  }
+  return n_children > 0 && !HashNumericElements(state, node, n_children);
+}
+
+bool AnyValueHasher::HashNumericElements(HashState& state, const AnyValue& array, std::size_t n)
+{
+  // Array elements have a locked type, so the first element determines the type of all of them
+  switch (array.GetChildValue(0)->m_data->GetTypeCode())
+  {
+  case TypeCode::Bool:
+    HashElements<boolean>(state, array, n);
+    return true;
+  case TypeCode::Char8:
+    HashElements<char8>(state, array, n);
+    return true;
+  case TypeCode::Int8:
+    HashElements<int8>(state, array, n);
+    return true;
+  case TypeCode::UInt8:
+    HashElements<uint8>(state, array, n);
+    return true;
+  case TypeCode::Int16:
+    HashElements<int16>(state, array, n);
+    return true;
+  case TypeCode::UInt16:
+    HashElements<uint16>(state, array, n);
+    return true;
+  case TypeCode::Int32:
+    HashElements<int32>(state, array, n);
+    return true;
+  case TypeCode::UInt32:
+    HashElements<uint32>(state, array, n);
+    return true;
+  case TypeCode::Int64:
+    HashElements<int64>(state, array, n);
+    return true;
+  case TypeCode::UInt64:
+    HashElements<uint64>(state, array, n);
+    return true;
+  case TypeCode::Float32:
+    HashElements<float32>(state, array, n);
+    return true;
+  case TypeCode::Float64:
+    HashElements<float64>(state, array, n);
+    return true;
+  default:
+    return false;
+  }
+}
+
+template <typename T>
+void AnyValueHasher::HashElements(HashState& state, const AnyValue& array, std::size_t n)
+{
+  // Elements are gathered as canonical words in blocks and hashed in bulk. Numeric arrays of
+  // different element types that compare equal produce the same words.
+  uint64 block[kHashBlockSize];
+  for (std::size_t block_first = 0; block_first < n; block_first += kHashBlockSize)
+  {
+    const auto block_n = std::min(kHashBlockSize, n - block_first);
+    for (std::size_t idx = 0; idx < block_n; ++idx)
+    {
+      block[idx] = ScalarWord<T>(*array.GetChildValue(block_first + idx)->m_data);
+    }
+    state.AddWords(block, block_n);
+  }
+}
+
+namespace
+{
+HashState::HashState()
+  : m_state{kPrime3}
+{}
+
+HashState::~HashState() = default;
+
+void HashState::Add(uint64 word)
+{
+  m_state = Round(m_state, word);
+}
+
+void HashState::AddWords(const uint64* words, std::size_t n)
+{
+  std::size_t idx = 0;
+  if (n >= 4)
+  {
+    uint64 acc_1 = m_state + kPrime1 + kPrime2;
+    uint64 acc_2 = m_state + kPrime2;
+    uint64 acc_3 = m_state;
+    uint64 acc_4 = m_state - kPrime1;
+    for (; idx + 4 <= n; idx += 4)
+    {
+      acc_1 = Round(acc_1, words[idx]);
+      acc_2 = Round(acc_2, words[idx + 1]);
+      acc_3 = Round(acc_3, words[idx + 2]);
+      acc_4 = Round(acc_4, words[idx + 3]);
+    }
+    auto merged = RotateLeft(acc_1, 1) + RotateLeft(acc_2, 7) + RotateLeft(acc_3, 12) +
+                  RotateLeft(acc_4, 18);
+    for (auto acc : {acc_1, acc_2, acc_3, acc_4})
+    {
+      merged = (merged ^ Round(0, acc)) * kPrime1 + kPrime4;
+    }
+    m_state = merged;
+  }
+  for (; idx < n; ++idx)
+  {
+    Add(words[idx]);
+  }
+}
+
+void HashState::AddBytes(const char* data, std::size_t size)
+{
+  Add(size);
+  std::size_t pos = 0;
+  for (; pos + sizeof(uint64) <= size; pos += sizeof(uint64))
+  {
+    uint64 word;
+    std::memcpy(&word, data + pos, sizeof(uint64));
+    Add(word);
+  }
+  if (pos < size)
+  {
+    uint64 word = 0;
+    std::memcpy(&word, data + pos, size - pos);
+    Add(word);
+  }
+}
+
+std::size_t HashState::Finalize() const
+{
+  auto result = m_state;
+  result ^= result >> 33;
+  result *= kPrime2;
+  result ^= result >> 29;
+  result *= kPrime3;
+  result ^= result >> 32;
+  return static_cast<std::size_t>(result);
+}
+
+uint64 RotateLeft(uint64 word, unsigned shift)
+{
+  return (word << shift) | (word >> (64u - shift));
+}
+
+uint64 Round(uint64 acc, uint64 word)
+{
+  return RotateLeft(acc + word * kPrime2, 31) * kPrime1;
+}
+
+uint64 CanonicalWord(boolean value)
+{
+  return value ? 1u : 0u;
+}
+
+uint64 CanonicalWord(char8 value)
+{
+  return static_cast<uint64>(static_cast<int64>(value));
+}
+
+uint64 CanonicalWord(int8 value)
+{
+  return static_cast<uint64>(static_cast<int64>(value));
+}
+
+uint64 CanonicalWord(uint8 value)
+{
+  return value;
+}
+
+uint64 CanonicalWord(int16 value)
+{
+  return static_cast<uint64>(static_cast<int64>(value));
+}
+
+uint64 CanonicalWord(uint16 value)
+{
+  return value;
+}
+
+uint64 CanonicalWord(int32 value)
+{
+  return static_cast<uint64>(static_cast<int64>(value));
+}
+
+uint64 CanonicalWord(uint32 value)
+{
+  return value;
+}
+
+uint64 CanonicalWord(int64 value)
+{
+  return static_cast<uint64>(value);
+}
+
+uint64 CanonicalWord(uint64 value)
+{
+  return value;
+}
+
+uint64 CanonicalWord(float32 value)
+{
+  return CanonicalWord(static_cast<float64>(value));
+}
+
+uint64 CanonicalWord(float64 value)
+{
+  // Integral values compare equal to the integers with the same value, so they must be hashed as
+  // such. Note that this also maps -0.0 onto 0.
+  if (value >= -9223372036854775808.0 && value < 18446744073709551616.0 &&
+      std::trunc(value) == value)
+  {
+    return (value < 0.0) ? static_cast<uint64>(static_cast<int64>(value))
+                         : static_cast<uint64>(value);
+  }
+  uint64 bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+template <typename T>
+uint64 ScalarWord(const IValueData& data)
+{
+  return CanonicalWord(static_cast<const ScalarValueDataT<T>&>(data).GetValue());
+}
+
+void HashScalar(HashState& state, const IValueData& data)
+{
+  switch (data.GetTypeCode())
+  {
+  case TypeCode::String:
+  {
+    const auto& str = static_cast<const ScalarValueDataT<std::string>&>(data).GetValue();
+    state.Add(kStringTag);
+    state.AddBytes(str.data(), str.size());
+    return;
+  }
+  case TypeCode::FixedString:
+  {
+    const auto& fixed_string = static_cast<const FixedStringValueData&>(data);
+    state.Add(kStringTag);
+    state.AddBytes(fixed_string.GetData(), fixed_string.GetLength());
+    return;
+  }
+  case TypeCode::Bool:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<boolean>(data));
+    return;
+  case TypeCode::Char8:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<char8>(data));
+    return;
+  case TypeCode::Int8:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<int8>(data));
+    return;
+  case TypeCode::UInt8:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<uint8>(data));
+    return;
+  case TypeCode::Int16:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<int16>(data));
+    return;
+  case TypeCode::UInt16:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<uint16>(data));
+    return;
+  case TypeCode::Int32:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<int32>(data));
+    return;
+  case TypeCode::UInt32:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<uint32>(data));
+    return;
+  case TypeCode::Int64:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<int64>(data));
+    return;
+  case TypeCode::UInt64:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<uint64>(data));
+    return;
+  case TypeCode::Float32:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<float32>(data));
+    return;
+  case TypeCode::Float64:
+    state.Add(kNumberTag);
+    state.Add(ScalarWord<float64>(data));
+    return;
+  default:
+    return;
+  }
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
+
+namespace std
+{
+size_t hash<::sup::dto::AnyValue>::operator()(const ::sup::dto::AnyValue& val) const
+{
+  return ::sup::dto::Hash(val);
+}
+}  // namespace std
@@ -24,21 +24,20 @@
 
 #include <sup/dto/anytype_helper.h>
 
-#include <sup/dto/anyvalue/subtype_copy_node.h>
+#include <sup/dto/anyvalue/field_mapping_plan.h>
 #include <sup/dto/json/json_reader.h>
 #include <sup/dto/json/json_writer.h>
 #include <sup/dto/parse/binary_parser.h>
 #include <sup/dto/parse/binary_value_parser.h>
 #include <sup/dto/serialize/binary_serializer.h>
 #include <sup/dto/serialize/binary_tokens.h>
+#include <sup/dto/serialize/serialization_plan.h>
 #include <sup/dto/visit/visit_t.h>
 
 #include <sup/dto/anytype_registry.h>
 #include <sup/dto/anyvalue.h>
 
-#include <deque>
 #include <fstream>
-#include <optional>
 #include <sstream>
 
 namespace
@@ -49,19 +48,10 @@ void PrintAnyValueToStream(std::ostream& os, const AnyValue& anyvalue, const std
 void PrintStructValueToStream(std::ostream& os, const AnyValue& anyvalue, const std::string& indent);
 void PrintArrayValueToStream(std::ostream& os, const AnyValue& anyvalue, const std::string& indent);
 
-struct NarrowingConvertNode
-{
-  AnyValue* m_dest;
-  const AnyValue* m_src;
-};
-
-// Try to create a new type that has the same tree structure as the source type, but with leaf
-// types from the corresponding target type. The target type is allowed to contain
-// unused structure members. If at some node location, the target is not a structure, it
-// will be used directly into the result, even when the corresponding source type has an
-// incompatible type at this node. This simplifies the code and since it is used only to do
-// conversions of AnyValues, such incompatibilities will be caught there.
-std::optional<AnyType> TrySubtypeCopy(const AnyType& src_type, const AnyType& target_type);
+// Convert with the cached field mapping plan for the source value's type and the target type:
+std::pair<bool, AnyValue> TryConvertWithFieldMapping(const AnyValue& src,
+                                                     const AnyType& target_type,
+                                                     sup::dto::FieldMappingMode mode);
 }  // unnamed namespace
 
 namespace sup
@@ -117,56 +107,13 @@ bool TryAssignIfEmptyOrConvert(AnyValue& dest, const AnyValue& src)
 std::pair<bool, AnyValue> TryConvertAllowExtraSourceFields(const AnyValue& src,
                                                            const AnyType& target_type)
 {
-  const std::pair<bool, AnyValue> failure{ false, {} };
-  AnyValue result{target_type};
-  std::deque<NarrowingConvertNode> stack{};
-  stack.push_back(NarrowingConvertNode{std::addressof(result), std::addressof(src)});
-  while (!stack.empty())
-  {
-    auto& front = stack.front();
-    auto* current_dest = front.m_dest;
-    auto* current_src = front.m_src;
-    if (IsStructValue(*current_dest))
-    {
-      auto mem_names = current_dest->MemberNames();
-      for (const auto& mem_name : mem_names)
-      {
-        if (!current_src->HasField(mem_name))
-        {
-          return failure;
-        }
-        auto* dest_mem = std::addressof((*current_dest)[mem_name]);
-        auto* src_mem = std::addressof((*current_src)[mem_name]);
-        stack.push_back(NarrowingConvertNode{dest_mem, src_mem});
-      }
-    }
-    else
-    {
-      if (!TryConvert(*current_dest, *current_src))
-      {
-        return failure;
-      }
-    }
-    stack.pop_front();
-  }
-  return { true, result };
+  return TryConvertWithFieldMapping(src, target_type, FieldMappingMode::kAllowExtraSourceFields);
 }
 
 std::pair<bool, AnyValue> TryConvertAllowExtraTargetFields(const AnyValue& src,
                                                            const AnyType& target_type)
 {
-  std::pair<bool, AnyValue> failure{ false, {} };
-  auto required_type = TrySubtypeCopy(src.GetType(), target_type);
-  if (!required_type)
-  {
-    return failure;
-  }
-  AnyValue result{required_type.value()};
-  if (!TryConvert(result, src))
-  {
-    return failure;
-  }
-  return { true, result };
+  return TryConvertWithFieldMapping(src, target_type, FieldMappingMode::kAllowExtraTargetFields);
 }
 
 void SerializeAnyValue(const AnyValue& anyvalue, IAnyVisitor<const AnyValue>& serializer)
@@ -193,6 +140,13 @@ std::string ValuesToJSONString(const AnyValue& anyvalue)
   return ValuesToJSONString(anyvalue, false);
 }
 
+std::string ValuesToJSONString(const AnyValue& anyvalue, ThreadPool& thread_pool)
+{
+  std::ostringstream oss;
+  JSONSerializeAnyValueValues(oss, anyvalue, thread_pool);
+  return oss.str();
+}
+
 std::string AnyValueToJSONString(const AnyValue& anyvalue, bool pretty)
 {
   std::ostringstream oss;
@@ -239,11 +193,14 @@ std::vector<uint8> AnyValueToBinary(const AnyValue& anyvalue)
 {
   std::vector<uint8> result;
   result.push_back(ANYTYPE_TOKEN);
+  // Cached plans can be shared with types that only differ in their type names:
+  const auto anytype = anyvalue.GetType();
   BinaryTypeSerializer type_serializer{result};
-  SerializeAnyType(anyvalue.GetType(), type_serializer);
+  VisitStatic<BinaryTypeSerializer, const AnyType>(anytype, type_serializer);
   result.push_back(ANYVALUE_TOKEN);
+  const auto plan = GetSerializationPlan(anytype);
   BinaryValueSerializer value_serializer{result};
-  SerializeAnyValue(anyvalue, value_serializer);
+  plan->Execute<BinaryValueSerializer>(anyvalue, value_serializer);
   return result;
 }
 
@@ -263,9 +220,10 @@ AnyValue AnyValueFromBinary(const std::vector<uint8>& representation)
       "AnyValueFromBinary(): value representation does not start with correct token");
   }
   iter++;
+  const auto plan = GetSerializationPlan(anytype);
   BinaryValueParser parser{iter, end_iter};
   AnyValue result{anytype};
-  Visit(result, parser);
+  plan->Execute<BinaryValueParser>(result, parser);
   if (!parser.IsFinished())
   {
     throw ParseException("AnyValueFromBinary(): ended before parsing all input bytes");
@@ -322,35 +280,25 @@ void PrintArrayValueToStream(std::ostream& os, const AnyValue& anyvalue, const s
   }
 }
 
-std::optional<AnyType> TrySubtypeCopy(const AnyType& src_type, const AnyType& target_type)
+std::pair<bool, AnyValue> TryConvertWithFieldMapping(const AnyValue& src,
+                                                     const AnyType& target_type,
+                                                     sup::dto::FieldMappingMode mode)
 {
-  std::deque<SubtypeCopyNode> stack{};
-  (void)stack.emplace_back(std::addressof(src_type), std::addressof(target_type));
-  while (true)
+  std::pair<bool, AnyValue> failure{ false, {} };
+  const auto plan = sup::dto::GetFieldMappingPlan(src, target_type, mode);
+  if (!plan->IsValid())
   {
-    auto& top = stack.back();
-    if (top.HasNextChild())
-    {
-      auto next_child_node = top.GetNextChildNode();
-      if (!next_child_node)
-      {
-        return {};
-      }
-      stack.push_back(std::move(next_child_node.value()));
-    }
-    else
-    {
-      auto current_node = std::move(top);
-      stack.pop_back();
-      if (!stack.empty())
-      {
-        stack.back().AddChildNode(current_node);
-      }
-      else
-      {
-        return current_node.MoveResult();
-      }
-    }
+    return failure;
+  }
+  AnyValue result{plan->GetResultType()};
+  try
+  {
+    plan->Execute(result, src);
+  }
+  catch(const sup::dto::MessageException&)
+  {
+    return failure;
   }
+  return { true, std::move(result) };
 }
 }  // unnamed namespace
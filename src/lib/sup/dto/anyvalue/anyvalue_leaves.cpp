@@ -0,0 +1,397 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/anyvalue_leaves.h>
+
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <memory>
+#include <string>
+
+namespace sup
+{
+namespace dto
+{
+
+LeafPath::LeafPath(const LeafPathComponent* components, std::size_t size)
+  : m_components{components}
+  , m_size{size}
+{}
+
+std::size_t LeafPath::size() const
+{
+  return m_size;
+}
+
+bool LeafPath::empty() const
+{
+  return m_size == 0;
+}
+
+const LeafPathComponent& LeafPath::operator[](std::size_t idx) const
+{
+  return m_components[idx];
+}
+
+const LeafPathComponent* LeafPath::begin() const
+{
+  return m_components;
+}
+
+const LeafPathComponent* LeafPath::end() const
+{
+  return m_components + m_size;
+}
+
+std::string LeafPath::ToString() const
+{
+  std::string result;
+  for (const auto& component : *this)
+  {
+    if (component.member_name == nullptr)
+    {
+      result += "[" + std::to_string(component.index) + "]";
+      continue;
+    }
+    if (!result.empty())
+    {
+      result += ".";
+    }
+    result += *component.member_name;
+  }
+  return result;
+}
+
+template <typename T>
+const std::size_t LeafIteratorT<T>::kInlineDepth;
+
+template <typename T>
+LeafIteratorT<T>::LeafIteratorT()
+  : m_inline_nodes{}
+  , m_inline_path{}
+  , m_overflow_nodes{}
+  , m_overflow_path{}
+  , m_depth{0}
+  , m_ordinal{0}
+  , m_end{true}
+{}
+
+template <typename T>
+LeafIteratorT<T>::LeafIteratorT(T& root)
+  : m_inline_nodes{}
+  , m_inline_path{}
+  , m_overflow_nodes{}
+  , m_overflow_path{}
+  , m_depth{0}
+  , m_ordinal{0}
+  , m_end{false}
+{
+  m_inline_nodes[0] = std::addressof(root);
+  Settle();
+}
+
+template <typename T>
+typename LeafIteratorT<T>::reference LeafIteratorT<T>::operator*() const
+{
+  return { m_ordinal, LeafPath{PathData(), m_depth}, *GetNode(m_depth) };
+}
+
+template <typename T>
+LeafIteratorT<T>& LeafIteratorT<T>::operator++()
+{
+  if (m_end)
+  {
+    return *this;
+  }
+  ++m_ordinal;
+  if (Next())
+  {
+    Settle();
+  }
+  return *this;
+}
+
+template <typename T>
+LeafIteratorT<T> LeafIteratorT<T>::operator++(int)
+{
+  auto result = *this;
+  ++(*this);
+  return result;
+}
+
+template <typename T>
+bool LeafIteratorT<T>::operator==(const LeafIteratorT& other) const
+{
+  if (m_end || other.m_end)
+  {
+    return m_end == other.m_end;
+  }
+  return m_ordinal == other.m_ordinal && GetNode(0) == other.GetNode(0);
+}
+
+template <typename T>
+bool LeafIteratorT<T>::operator!=(const LeafIteratorT& other) const
+{
+  return !(*this == other);
+}
+
+template <typename T>
+void LeafIteratorT<T>::Push(std::size_t idx)
+{
+  const auto level = m_depth + 1;
+  if (m_overflow_nodes.empty() && level >= kInlineDepth)
+  {
+    // Switch to heap storage for the remainder of the iteration
+    m_overflow_nodes.assign(m_inline_nodes, m_inline_nodes + level);
+    m_overflow_path.assign(m_inline_path, m_inline_path + m_depth);
+  }
+  if (!m_overflow_nodes.empty() && m_overflow_nodes.size() <= level)
+  {
+    m_overflow_nodes.resize(level + 1);
+    m_overflow_path.resize(level);
+  }
+  m_depth = level;
+  SetChild(idx);
+}
+
+template <typename T>
+void LeafIteratorT<T>::SetChild(std::size_t idx)
+{
+  auto parent = GetNode(m_depth - 1);
+  const std::string* member_name =
+    IsStructValue(*parent) ? std::addressof(parent->GetMemberName(idx)) : nullptr;
+  ComponentAt(m_depth - 1) = { member_name, idx };
+  SetNode(m_depth, parent->GetChildValue(idx));
+}
+
+template <typename T>
+bool LeafIteratorT<T>::Next()
+{
+  while (m_depth > 0)
+  {
+    auto parent = GetNode(m_depth - 1);
+    const auto idx = ComponentAt(m_depth - 1).index + 1;
+    if (idx < parent->NumberOfChildren())
+    {
+      SetChild(idx);
+      return true;
+    }
+    --m_depth;
+  }
+  m_end = true;
+  return false;
+}
+
+template <typename T>
+void LeafIteratorT<T>::Settle()
+{
+  while (!m_end)
+  {
+    auto node = GetNode(m_depth);
+    if (node->IsScalar())
+    {
+      return;
+    }
+    if (node->NumberOfChildren() > 0)
+    {
+      Push(0);
+      continue;
+    }
+    // Empty value or empty array: no leaves here
+    (void)Next();
+  }
+}
+
+template <typename T>
+T* LeafIteratorT<T>::GetNode(std::size_t level) const
+{
+  return m_overflow_nodes.empty() ? m_inline_nodes[level] : m_overflow_nodes[level];
+}
+
+template <typename T>
+void LeafIteratorT<T>::SetNode(std::size_t level, T* node)
+{
+  if (m_overflow_nodes.empty())
+  {
+    m_inline_nodes[level] = node;
+    return;
+  }
+  m_overflow_nodes[level] = node;
+}
+
+template <typename T>
+LeafPathComponent& LeafIteratorT<T>::ComponentAt(std::size_t level)
+{
+  return m_overflow_nodes.empty() ? m_inline_path[level] : m_overflow_path[level];
+}
+
+template <typename T>
+const LeafPathComponent* LeafIteratorT<T>::PathData() const
+{
+  return m_overflow_nodes.empty() ? m_inline_path : m_overflow_path.data();
+}
+
+template <typename T>
+LeafRangeT<T>::LeafRangeT(T& root)
+  : m_root{root}
+{}
+
+template <typename T>
+LeafIteratorT<T> LeafRangeT<T>::begin() const
+{
+  return LeafIteratorT<T>{m_root};
+}
+
+template <typename T>
+LeafIteratorT<T> LeafRangeT<T>::end() const
+{
+  return LeafIteratorT<T>{};
+}
+
+template class LeafIteratorT<AnyValue>;
+template class LeafIteratorT<const AnyValue>;
+template class LeafRangeT<AnyValue>;
+template class LeafRangeT<const AnyValue>;
+
+LeafRangeT<AnyValue> Leaves(AnyValue& anyvalue)
+{
+  return LeafRangeT<AnyValue>{anyvalue};
+}
+
+LeafRangeT<const AnyValue> Leaves(const AnyValue& anyvalue)
+{
+  return LeafRangeT<const AnyValue>{anyvalue};
+}
+
+LeafIndex::LeafIndex(const AnyType& anytype)
+  : m_anytype{anytype}
+  , m_components{}
+  , m_leaves{}
+{
+  std::vector<LeafPathComponent> path;
+  AddLeaves(m_anytype, path);
+}
+
+LeafIndex::~LeafIndex() = default;
+
+const AnyType& LeafIndex::GetType() const
+{
+  return m_anytype;
+}
+
+std::size_t LeafIndex::NumberOfLeaves() const
+{
+  return m_leaves.size();
+}
+
+LeafPath LeafIndex::GetLeafPath(std::size_t ordinal) const
+{
+  const auto& entry = GetEntry(ordinal);
+  return LeafPath{m_components.data() + entry.path_offset, entry.path_size};
+}
+
+TypeCode LeafIndex::GetLeafTypeCode(std::size_t ordinal) const
+{
+  return GetEntry(ordinal).type_code;
+}
+
+const AnyType& LeafIndex::GetLeafType(std::size_t ordinal) const
+{
+  return *GetEntry(ordinal).type;
+}
+
+AnyValue& LeafIndex::GetLeaf(AnyValue& anyvalue, std::size_t ordinal) const
+{
+  const auto& leaf = GetLeaf(static_cast<const AnyValue&>(anyvalue), ordinal);
+  return const_cast<AnyValue&>(leaf);
+}
+
+const AnyValue& LeafIndex::GetLeaf(const AnyValue& anyvalue, std::size_t ordinal) const
+{
+  const auto& entry = GetEntry(ordinal);
+  const auto* node = std::addressof(anyvalue);
+  const auto first = m_components.begin() + entry.path_offset;
+  const auto last = first + entry.path_size;
+  for (auto it = first; it != last; ++it)
+  {
+    node = node->GetChildValue(it->index);
+  }
+  if (node->GetTypeCode() != entry.type_code)
+  {
+    const std::string error =
+      "LeafIndex::GetLeaf(): value does not have the structure of the indexed type";
+    throw InvalidOperationException(error);
+  }
+  return *node;
+}
+
+void LeafIndex::AddLeaves(const AnyType& anytype, std::vector<LeafPathComponent>& path)
+{
+  if (IsScalarType(anytype))
+  {
+    m_leaves.push_back(
+      { m_components.size(), path.size(), anytype.GetTypeCode(), std::addressof(anytype) });
+    m_components.insert(m_components.end(), path.begin(), path.end());
+    return;
+  }
+  if (IsStructType(anytype))
+  {
+    for (std::size_t idx = 0; idx < anytype.NumberOfMembers(); ++idx)
+    {
+      path.push_back({ std::addressof(anytype.GetMemberName(idx)), idx });
+      AddLeaves(*anytype.GetChildType(idx), path);
+      path.pop_back();
+    }
+    return;
+  }
+  if (IsArrayType(anytype))
+  {
+    const auto n_elements = anytype.NumberOfElements();
+    if (n_elements == 0)
+    {
+      const std::string error =
+        "LeafIndex::AddLeaves(): unbounded arrays do not have a fixed number of leaves";
+      throw InvalidOperationException(error);
+    }
+    const auto& element_type = *anytype.GetChildType(0);
+    for (std::size_t idx = 0; idx < n_elements; ++idx)
+    {
+      path.push_back({ nullptr, idx });
+      AddLeaves(element_type, path);
+      path.pop_back();
+    }
+  }
+}
+
+const LeafIndex::LeafEntry& LeafIndex::GetEntry(std::size_t ordinal) const
+{
+  if (ordinal >= m_leaves.size())
+  {
+    const std::string error = "LeafIndex::GetEntry(): leaf ordinal out of bounds";
+    throw InvalidOperationException(error);
+  }
+  return m_leaves[ordinal];
+}
+
+}  // namespace dto
+
+}  // namespace sup
@@ -119,6 +119,7 @@ TypeCode PromoteIntegralCode(TypeCode t)
     { TypeCode::Float32, TypeCode::Float32 },
     { TypeCode::Float64, TypeCode::Float64 },
     { TypeCode::String, TypeCode::Empty },
+    { TypeCode::FixedString, TypeCode::Empty },
     { TypeCode::Struct, TypeCode::Empty },
     { TypeCode::Array, TypeCode::Empty }
   };
@@ -187,6 +188,7 @@ UnaryOperatorFunction GetIncrementFunction(TypeCode type_code)
     { TypeCode::Float32, &IncrementT<float32, float32> },
     { TypeCode::Float64, &IncrementT<float64, float64> },
     { TypeCode::String, &UnsupportedIncrement },
+    { TypeCode::FixedString, &UnsupportedIncrement },
     { TypeCode::Struct, &UnsupportedIncrement },
     { TypeCode::Array, &UnsupportedIncrement }
   };
@@ -210,6 +212,7 @@ UnaryOperatorFunction GetDecrementFunction(TypeCode type_code)
     { TypeCode::Float32, &DecrementT<float32, float32> },
     { TypeCode::Float64, &DecrementT<float64, float64> },
     { TypeCode::String, &UnsupportedDecrement },
+    { TypeCode::FixedString, &UnsupportedDecrement },
     { TypeCode::Struct, &UnsupportedDecrement },
     { TypeCode::Array, &UnsupportedDecrement }
   };
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/anyvalue.h>
+
+#include <sup/dto/anyvalue/conversion_plan.h>
+#include <sup/dto/anyvalue/i_value_data.h>
+#include <sup/dto/anyvalue/parallel_utils.h>
+#include <sup/dto/thread_pool.h>
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+/**
+ * @brief Compare the given pair of nodes on a shallow level and descend into their children,
+ * collecting the elements of large arrays as independent jobs.
+ *
+ * @return false when a shallow comparison already failed.
+ */
+template <typename ShallowEquals>
+bool CollectParallelJobs(const AnyValue* left, const AnyValue* right,
+                         ShallowEquals& shallow_equals,
+                         std::vector<std::pair<const AnyValue*, const AnyValue*>>& jobs);
+}  // unnamed namespace
+
+AnyValue::AnyValue(const AnyValue& other, ThreadPool& thread_pool)
+  : AnyValue{}
+{
+  auto copy = ParallelClone(other, Constraints::kNone, thread_pool);
+  std::swap(m_data, copy->m_data);
+}
+
+void AnyValue::ConvertFrom(const AnyValue& other, ThreadPool& thread_pool)
+{
+  if (IsScalar() && other.IsScalar())
+  {
+    ConversionPlan::ConvertScalarValue(*this, other);
+    return;
+  }
+  const auto plan = GetConversionPlan(*this, other);
+  plan->Execute(*this, other, thread_pool);
+}
+
+bool AnyValue::Equals(const AnyValue& other, ThreadPool& thread_pool) const
+{
+  auto shallow_equals = [](const AnyValue& left, const AnyValue& right) {
+    return left.ShallowEquals(right);
+  };
+  std::vector<std::pair<const AnyValue*, const AnyValue*>> jobs;
+  if (!CollectParallelJobs(this, std::addressof(other), shallow_equals, jobs))
+  {
+    return false;
+  }
+  std::atomic<bool> equal{true};
+  auto compare_chunk = [&jobs, &equal](std::size_t, std::size_t first, std::size_t last) {
+    for (auto idx = first; idx < last && equal; ++idx)
+    {
+      if (*jobs[idx].first != *jobs[idx].second)
+      {
+        equal = false;
+      }
+    }
+  };
+  utils::ParallelForChunks(thread_pool, jobs.size(), compare_chunk);
+  return equal;
+}
+
+std::unique_ptr<AnyValue> AnyValue::ParallelClone(const AnyValue& src, Constraints constraints,
+                                                  ThreadPool& thread_pool)
+{
+  // If source is an array, child always has a locked type; otherwise, just inherit the constraints
+  const auto child_constraints = IsArrayValue(src) ? Constraints::kLockedType : constraints;
+  const auto n_children = src.NumberOfChildren();
+  std::vector<std::unique_ptr<AnyValue>> children(n_children);
+  if (utils::IsParallelArray(src))
+  {
+    auto copy_chunk = [&src, &children, child_constraints](std::size_t, std::size_t first,
+                                                           std::size_t last) {
+      for (auto idx = first; idx < last; ++idx)
+      {
+        children[idx].reset(new AnyValue{*src.GetChildValue(idx), child_constraints});
+      }
+    };
+    utils::ParallelForChunks(thread_pool, n_children, copy_chunk);
+  }
+  else
+  {
+    for (std::size_t idx = 0; idx < n_children; ++idx)
+    {
+      children[idx] = ParallelClone(*src.GetChildValue(idx), child_constraints, thread_pool);
+    }
+  }
+  return src.CloneFromChildren(std::move(children), constraints);
+}
+
+namespace
+{
+template <typename ShallowEquals>
+bool CollectParallelJobs(const AnyValue* left, const AnyValue* right,
+                         ShallowEquals& shallow_equals,
+                         std::vector<std::pair<const AnyValue*, const AnyValue*>>& jobs)
+{
+  if (!shallow_equals(*left, *right))
+  {
+    return false;
+  }
+  const auto n_children = left->NumberOfChildren();
+  const bool split = utils::IsParallelArray(*left);
+  for (std::size_t idx = 0; idx < n_children; ++idx)
+  {
+    auto left_child = left->GetChildValue(idx);
+    auto right_child = right->GetChildValue(idx);
+    if (split)
+    {
+      jobs.emplace_back(left_child, right_child);
+    }
+    else if (!CollectParallelJobs(left_child, right_child, shallow_equals, jobs))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
@@ -0,0 +1,244 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/anyvalue_publisher.h>
+
+#include <sup/dto/anyvalue/conversion_plan.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+const std::size_t kDefaultPublisherBuffers = 3;
+
+const uint64 kCountMask = 0xFFFFFFFFu;
+
+// Number of snapshots counted in the current word at which a reader moves the count to the buffer
+// itself, long before it could overflow into the buffer index
+const uint64 kCountTransferThreshold = uint64{1} << 31;
+
+uint64 MakeWord(std::size_t idx);
+
+std::size_t WordIndex(uint64 word);
+
+uint64 WordCount(uint64 word);
+}  // unnamed namespace
+
+struct AnyValuePublisher::Buffer
+{
+  explicit Buffer(const AnyValue& value_);
+
+  AnyValue value;
+  // Number of unreleased snapshots of this buffer that are not counted in the current word. This
+  // can be negative while the buffer is current, since snapshots are released here.
+  std::atomic<int64> references;
+  uint64 version;
+};
+
+AnyValueSnapshot::~AnyValueSnapshot()
+{
+  Release();
+}
+
+AnyValueSnapshot::AnyValueSnapshot(AnyValueSnapshot&& other) noexcept
+  : m_value{other.m_value}
+  , m_references{other.m_references}
+  , m_version{other.m_version}
+{
+  other.m_value = nullptr;
+  other.m_references = nullptr;
+}
+
+AnyValueSnapshot& AnyValueSnapshot::operator=(AnyValueSnapshot&& other) & noexcept
+{
+  if (this != std::addressof(other))
+  {
+    Release();
+    m_value = other.m_value;
+    m_references = other.m_references;
+    m_version = other.m_version;
+    other.m_value = nullptr;
+    other.m_references = nullptr;
+  }
+  return *this;
+}
+
+const AnyValue& AnyValueSnapshot::operator*() const
+{
+  return *m_value;
+}
+
+const AnyValue* AnyValueSnapshot::operator->() const
+{
+  return m_value;
+}
+
+uint64 AnyValueSnapshot::GetVersion() const
+{
+  return m_version;
+}
+
+AnyValueSnapshot::AnyValueSnapshot(const AnyValue* value, std::atomic<int64>* references,
+                                   uint64 version)
+  : m_value{value}
+  , m_references{references}
+  , m_version{version}
+{}
+
+void AnyValueSnapshot::Release()
+{
+  if (m_references != nullptr)
+  {
+    // Release ordering guarantees that all reads of the value happen before the writer reuses it
+    (void)m_references->fetch_sub(1, std::memory_order_release);
+    m_references = nullptr;
+  }
+}
+
+AnyValuePublisher::AnyValuePublisher(const AnyValue& initial_value)
+  : AnyValuePublisher{initial_value, kDefaultPublisherBuffers}
+{}
+
+AnyValuePublisher::AnyValuePublisher(const AnyValue& initial_value, std::size_t n_buffers)
+  : m_buffers{}
+  , m_n_buffers{0}
+  , m_current{MakeWord(0)}
+  , m_version{0}
+{
+  if (n_buffers < 2 || n_buffers > kMaxPublisherBuffers)
+  {
+    throw InvalidOperationException("AnyValuePublisher: invalid number of buffers");
+  }
+  m_buffers.reset(new std::unique_ptr<Buffer>[kMaxPublisherBuffers]);
+  for (; m_n_buffers < n_buffers; ++m_n_buffers)
+  {
+    m_buffers[m_n_buffers] = std::make_unique<Buffer>(initial_value);
+  }
+}
+
+AnyValuePublisher::~AnyValuePublisher() = default;
+
+AnyValueSnapshot AnyValuePublisher::GetSnapshot() const
+{
+  const auto word = m_current.fetch_add(1, std::memory_order_acquire) + 1;
+  auto& buffer = *m_buffers[WordIndex(word)];
+  const auto count = WordCount(word);
+  if (count >= kCountTransferThreshold)
+  {
+    // Single attempt to move the count to the buffer. The buffer's count is raised first, so that
+    // the writer never sees it too low. When the attempt fails, because of another snapshot or a
+    // publication, the count is left in place.
+    (void)buffer.references.fetch_add(static_cast<int64>(count), std::memory_order_relaxed);
+    auto expected = word;
+    if (!m_current.compare_exchange_strong(expected, MakeWord(WordIndex(word)),
+                                           std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+      (void)buffer.references.fetch_sub(static_cast<int64>(count), std::memory_order_relaxed);
+    }
+  }
+  return AnyValueSnapshot{std::addressof(buffer.value), std::addressof(buffer.references),
+                          buffer.version};
+}
+
+void AnyValuePublisher::Publish(const AnyValue& value)
+{
+  const auto idx = AcquireFreeBuffer();
+  auto& buffer = *m_buffers[idx];
+  if (ConversionPlan::HaveIdenticalTypes(buffer.value, value))
+  {
+    ConversionPlan::CopyIdenticalValue(buffer.value, value);
+  }
+  else
+  {
+    buffer.value.ConvertFrom(value);
+  }
+  const auto version = m_version.load(std::memory_order_relaxed) + 1;
+  buffer.version = version;
+  const auto previous = m_current.exchange(MakeWord(idx), std::memory_order_acq_rel);
+  // Snapshots of the previous buffer that were counted in the current word are now counted in the
+  // buffer itself, which makes it free as soon as they are all released
+  (void)m_buffers[WordIndex(previous)]->references.fetch_add(
+    static_cast<int64>(WordCount(previous)), std::memory_order_relaxed);
+  m_version.store(version, std::memory_order_release);
+}
+
+uint64 AnyValuePublisher::GetVersion() const
+{
+  return m_version.load(std::memory_order_acquire);
+}
+
+std::size_t AnyValuePublisher::NumberOfBuffers() const
+{
+  return m_n_buffers;
+}
+
+std::size_t AnyValuePublisher::AcquireFreeBuffer()
+{
+  const auto current = WordIndex(m_current.load(std::memory_order_relaxed));
+  for (std::size_t idx = 0; idx < m_n_buffers; ++idx)
+  {
+    if (idx != current && m_buffers[idx]->references.load(std::memory_order_acquire) == 0)
+    {
+      return idx;
+    }
+  }
+  if (m_n_buffers == kMaxPublisherBuffers)
+  {
+    throw InvalidOperationException("AnyValuePublisher::Publish(): all buffers are in use");
+  }
+  // Readers hold snapshots of all other buffers: add a buffer instead of waiting for them
+  m_buffers[m_n_buffers] = std::make_unique<Buffer>(m_buffers[current]->value);
+  return m_n_buffers++;
+}
+
+AnyValuePublisher::Buffer::Buffer(const AnyValue& value_)
+  : value{value_}
+  , references{0}
+  , version{0}
+{}
+
+namespace
+{
+uint64 MakeWord(std::size_t idx)
+{
+  return static_cast<uint64>(idx) << 32;
+}
+
+std::size_t WordIndex(uint64 word)
+{
+  return static_cast<std::size_t>(word >> 32);
+}
+
+uint64 WordCount(uint64 word)
+{
+  return word & kCountMask;
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
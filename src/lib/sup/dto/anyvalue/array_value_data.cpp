@@ -59,7 +59,7 @@ TypeCode ArrayValueData::GetTypeCode() const
   return TypeCode::Array;
 }
 
-std::string ArrayValueData::GetTypeName() const
+const std::string& ArrayValueData::GetTypeName() const
 {
   return m_name;
 }
@@ -163,6 +163,21 @@ bool ArrayValueData::ShallowEquals(const IValueData* other) const
   return true;
 }
 
+bool ArrayValueData::ShallowSameType(const IValueData* other) const
+{
+  if (!IsArrayTypeCode(other->GetTypeCode()))
+  {
+    return false;
+  }
+  const auto* other_array = static_cast<const ArrayValueData*>(other);
+  if (other_array->m_name != m_name || other_array->m_elements.size() != m_elements.size())
+  {
+    return false;
+  }
+  // The element types are otherwise checked through the (type locked) elements themselves:
+  return !m_elements.empty() || other_array->m_elem_type == m_elem_type;
+}
+
 void ArrayValueData::ShallowConvertFrom(const AnyValue& value)
 {
   if (value.GetTypeCode() != TypeCode::Array)
@@ -43,7 +43,7 @@ public:
   ArrayValueData& operator=(ArrayValueData&& other) = delete;
 
   TypeCode GetTypeCode() const override;
-  std::string GetTypeName() const override;
+  const std::string& GetTypeName() const override;
 
   Constraints GetConstraints() const override;
 
@@ -60,6 +60,7 @@ public:
   std::unique_ptr<IValueData> CloneFromChildren(std::vector<std::unique_ptr<AnyValue>>&& children,
                                                 Constraints constraints) const override;
   bool ShallowEquals(const IValueData* other) const override;
+  bool ShallowSameType(const IValueData* other) const override;
   void ShallowConvertFrom(const AnyValue& value) override;
 
 private:
@@ -0,0 +1,135 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/async_any_functor.h>
+
+#include <sup/dto/any_functor.h>
+#include <sup/dto/thread_pool.h>
+
+#include <memory>
+#include <utility>
+
+namespace sup
+{
+namespace dto
+{
+
+AsyncAnyFunctor::AsyncAnyFunctor(AnyFunctor& functor, ThreadPool& thread_pool)
+  : AsyncAnyFunctor{functor,
+                    [&thread_pool](std::function<void()> task) {
+                      thread_pool.Submit(std::move(task));
+                    }}
+{}
+
+AsyncAnyFunctor::AsyncAnyFunctor(AnyFunctor& functor, AnyFunctorExecutor executor)
+  : m_functor{functor}
+  , m_executor{std::move(executor)}
+  , m_n_pending{0}
+  , m_mtx{}
+  , m_cv{}
+{}
+
+AsyncAnyFunctor::~AsyncAnyFunctor()
+{
+  std::unique_lock<std::mutex> lk{m_mtx};
+  m_cv.wait(lk, [this](){ return m_n_pending == 0; });
+}
+
+std::future<AnyValue> AsyncAnyFunctor::CallAsync(AnyValue input)
+{
+  auto promise = std::make_shared<std::promise<AnyValue>>();
+  auto future = promise->get_future();
+  CallAsync(std::move(input), [promise](AnyValue&& output, std::exception_ptr error) {
+    if (error)
+    {
+      promise->set_exception(error);
+    }
+    else
+    {
+      promise->set_value(std::move(output));
+    }
+  });
+  return future;
+}
+
+void AsyncAnyFunctor::CallAsync(AnyValue input, AnyFunctorCallback callback)
+{
+  // Executor tasks need to be copyable: share the input and callback instead of copying them
+  auto shared_input = std::make_shared<const AnyValue>(std::move(input));
+  auto shared_callback = std::make_shared<const AnyFunctorCallback>(std::move(callback));
+  {
+    const std::lock_guard<std::mutex> lk{m_mtx};
+    ++m_n_pending;
+  }
+  try
+  {
+    m_executor([this, shared_input, shared_callback]() {
+      RunCall(*shared_input, *shared_callback);
+    });
+  }
+  catch(...)
+  {
+    FinishCall();
+    throw;
+  }
+}
+
+std::size_t AsyncAnyFunctor::NumberOfPendingCalls() const
+{
+  const std::lock_guard<std::mutex> lk{m_mtx};
+  return m_n_pending;
+}
+
+void AsyncAnyFunctor::RunCall(const AnyValue& input, const AnyFunctorCallback& callback)
+{
+  AnyValue output;
+  std::exception_ptr error;
+  try
+  {
+    output = m_functor(input);
+  }
+  catch(...)
+  {
+    error = std::current_exception();
+  }
+  try
+  {
+    callback(std::move(output), error);
+  }
+  catch(...)
+  {
+    // Exceptions are not propagated from completion callbacks
+  }
+  FinishCall();
+}
+
+void AsyncAnyFunctor::FinishCall()
+{
+  // Notify while holding the lock, since the destructor may return as soon as it is released
+  const std::lock_guard<std::mutex> lk{m_mtx};
+  --m_n_pending;
+  m_cv.notify_all();
+}
+
+}  // namespace dto
+
+}  // namespace sup
@@ -0,0 +1,753 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/anyvalue/conversion_plan.h>
+
+#include <sup/dto/anyvalue/fixed_string_value_data.h>
+#include <sup/dto/anyvalue/parallel_utils.h>
+#include <sup/dto/anyvalue/scalar_value_data_t.h>
+#include <sup/dto/low_level/scalar_array_conversion.h>
+#include <sup/dto/serialize/serialization_plan.h>
+#include <sup/dto/serialize/type_keyed_cache.h>
+#include <sup/dto/visit/visit_frame.h>
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+// Maximum number of plans kept in the global cache; least recently used plans are evicted first:
+const std::size_t kMaxCachedPlans = 256;
+
+const std::string kIncompatibleError = "Cannot convert from incompatible AnyValue";
+
+const std::string kArrayLengthError = "Can't convert between arrays of different length";
+
+struct LeafConversion
+{
+  LeafConversionKind kind;
+  LeafConverter convert;
+  LeafArrayConverter convert_array;
+};
+
+template <LeafConversionKind kind>
+using LeafConversionTag = std::integral_constant<LeafConversionKind, kind>;
+
+template <typename To, typename From>
+struct LeafConversionKindOf
+{
+  static constexpr LeafConversionKind value =
+    std::is_same<To, From>::value ? LeafConversionKind::kIdentity
+    : (std::is_same<To, std::string>::value || std::is_same<From, std::string>::value)
+      ? LeafConversionKind::kUnsupported
+    : IsWideningConversion<To, From>::value ? LeafConversionKind::kWidening
+                                            : LeafConversionKind::kNarrowing;
+};
+
+template <typename T>
+T& Payload(IValueData& value_data);
+
+template <typename T>
+const T& Payload(const IValueData& value_data);
+
+template <typename T>
+void CopyLeaf(IValueData& dest, const IValueData& src);
+
+template <typename To, typename From>
+void CastLeaf(IValueData& dest, const IValueData& src);
+
+template <typename To, typename From>
+void CheckedLeaf(IValueData& dest, const IValueData& src);
+
+template <typename To, typename From>
+std::size_t ConvertLeafBlock(IValueData* const* dest, const IValueData* const* src, std::size_t n);
+
+void StringFromFixedStringLeaf(IValueData& dest, const IValueData& src);
+
+void FixedStringFromStringLeaf(IValueData& dest, const IValueData& src);
+
+void FixedStringFromFixedStringLeaf(IValueData& dest, const IValueData& src);
+
+template <typename To, typename From,
+  typename std::enable_if<std::is_arithmetic<To>::value &&
+                          std::is_arithmetic<From>::value, bool>::type = true>
+LeafArrayConverter MakeLeafArrayConverter();
+
+template <typename To, typename From,
+  typename std::enable_if<!std::is_arithmetic<To>::value ||
+                          !std::is_arithmetic<From>::value, bool>::type = true>
+LeafArrayConverter MakeLeafArrayConverter();
+
+template <typename To, typename From>
+LeafConversion MakeLeafConversion(LeafConversionTag<LeafConversionKind::kIdentity>);
+
+template <typename To, typename From>
+LeafConversion MakeLeafConversion(LeafConversionTag<LeafConversionKind::kWidening>);
+
+template <typename To, typename From>
+LeafConversion MakeLeafConversion(LeafConversionTag<LeafConversionKind::kNarrowing>);
+
+template <typename To, typename From>
+LeafConversion MakeLeafConversion(LeafConversionTag<LeafConversionKind::kUnsupported>);
+
+template <typename To>
+LeafConversion SelectLeafConversionTo(TypeCode src_code);
+
+LeafConversion SelectLeafConversionToFixedString(TypeCode src_code);
+
+LeafConversion SelectLeafConversion(TypeCode dest_code, TypeCode src_code);
+
+std::string UnsupportedLeafConversionError(TypeCode dest_code, TypeCode src_code);
+
+bool IsStringTypeCode(TypeCode type_code);
+
+std::string ArrayElementRangeError(std::size_t idx);
+
+TypeKeyedCache<ConversionPlan>& GetPlanCache();
+
+template <typename T>
+std::size_t ConversionShapeHashT(const T& node);
+
+template <typename T>
+bool MatchesConversionShapeT(const T& node, const AnyType& other);
+}  // unnamed namespace
+
+ConversionPlan::ConversionPlan(const AnyType& dest_type, const AnyType& src_type)
+  : m_dest_type{dest_type}
+  , m_src_type{src_type}
+  , m_steps{}
+  , m_error{}
+{
+  if (!Compile(m_dest_type, m_src_type))
+  {
+    m_steps.clear();
+  }
+}
+
+ConversionPlan::~ConversionPlan() = default;
+
+const AnyType& ConversionPlan::GetDestinationType() const
+{
+  return m_dest_type;
+}
+
+const AnyType& ConversionPlan::GetSourceType() const
+{
+  return m_src_type;
+}
+
+bool ConversionPlan::IsValid() const
+{
+  return m_error.empty();
+}
+
+const std::vector<ConversionStep>& ConversionPlan::GetSteps() const
+{
+  return m_steps;
+}
+
+bool ConversionPlan::Matches(const AnyValue& dest, const AnyValue& src) const
+{
+  return MatchesConversionShapeT(dest, m_dest_type) && MatchesConversionShapeT(src, m_src_type);
+}
+
+void ConversionPlan::Execute(AnyValue& dest, const AnyValue& src) const
+{
+  if (!IsValid())
+  {
+    throw InvalidConversionException(m_error);
+  }
+  (void)ExecuteStep(0, dest, src, nullptr);
+}
+
+void ConversionPlan::Execute(AnyValue& dest, const AnyValue& src, ThreadPool& thread_pool) const
+{
+  if (!IsValid())
+  {
+    throw InvalidConversionException(m_error);
+  }
+  (void)ExecuteStep(0, dest, src, std::addressof(thread_pool));
+}
+
+void ConversionPlan::ConvertScalarValue(AnyValue& dest, const AnyValue& src)
+{
+  ConvertScalarData(dest, *src.m_data);
+}
+
+void ConversionPlan::ConvertScalarData(AnyValue& dest, const IValueData& src_data)
+{
+  const auto dest_code = dest.GetTypeCode();
+  const auto src_code = src_data.GetTypeCode();
+  const auto conversion = SelectLeafConversion(dest_code, src_code);
+  if (conversion.convert == nullptr)
+  {
+    throw InvalidConversionException(UnsupportedLeafConversionError(dest_code, src_code));
+  }
+  conversion.convert(*dest.m_data, src_data);
+}
+
+bool ConversionPlan::HaveIdenticalTypes(const AnyValue& lhs, const AnyValue& rhs)
+{
+  if (!lhs.m_data->ShallowSameType(rhs.m_data.get()))
+  {
+    return false;
+  }
+  const auto n_children = lhs.NumberOfChildren();
+  for (std::size_t idx = 0; idx < n_children; ++idx)
+  {
+    if (!HaveIdenticalTypes(*lhs.GetChildValue(idx), *rhs.GetChildValue(idx)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ConversionPlan::CopyIdenticalValue(AnyValue& dest, const AnyValue& src)
+{
+  if (dest.IsScalar())
+  {
+    const auto type_code = dest.GetTypeCode();
+    SelectLeafConversion(type_code, type_code).convert(*dest.m_data, *src.m_data);
+    return;
+  }
+  const auto n_children = dest.NumberOfChildren();
+  for (std::size_t idx = 0; idx < n_children; ++idx)
+  {
+    CopyIdenticalValue(*dest.GetChildValue(idx), *src.GetChildValue(idx));
+  }
+}
+
+bool ConversionPlan::Compile(const AnyType& dest_type, const AnyType& src_type)
+{
+  const auto pos = m_steps.size();
+  if (IsEmptyType(dest_type))
+  {
+    if (!IsEmptyType(src_type))
+    {
+      m_error = kIncompatibleError;
+      return false;
+    }
+    m_steps.push_back({ ConversionOpcode::kEmpty, 0, pos + 1, LeafConversionKind::kIdentity,
+                        nullptr, nullptr });
+    return true;
+  }
+  if (IsStructType(dest_type))
+  {
+    if (!IsStructType(src_type))
+    {
+      m_error = kIncompatibleError;
+      return false;
+    }
+    const auto n_members = dest_type.NumberOfMembers();
+    if (src_type.NumberOfMembers() != n_members)
+    {
+      m_error = "Can't convert between structs with different lists of fields";
+      return false;
+    }
+    m_steps.push_back({ ConversionOpcode::kStruct, n_members, 0, LeafConversionKind::kIdentity,
+                        nullptr, nullptr });
+    for (std::size_t idx = 0; idx < n_members; ++idx)
+    {
+      if (dest_type.GetMemberName(idx) != src_type.GetMemberName(idx))
+      {
+        m_error = "Can't convert between structs with different lists of fields";
+        return false;
+      }
+      if (!Compile(*dest_type.GetChildType(idx), *src_type.GetChildType(idx)))
+      {
+        return false;
+      }
+    }
+    m_steps[pos].end = m_steps.size();
+    return true;
+  }
+  if (IsArrayType(dest_type))
+  {
+    if (!IsArrayType(src_type))
+    {
+      m_error = kIncompatibleError;
+      return false;
+    }
+    // Lengths are only checked on execution, so the plan can be shared between arrays of
+    // different lengths. Element types are only checked when there are elements to convert:
+    m_steps.push_back({ ConversionOpcode::kArray, 0, 0, LeafConversionKind::kIdentity,
+                        nullptr, nullptr });
+    if (dest_type.NumberOfElements() > 0 && src_type.NumberOfElements() > 0 &&
+        !Compile(*dest_type.GetChildType(0), *src_type.GetChildType(0)))
+    {
+      return false;
+    }
+    m_steps[pos].end = m_steps.size();
+    return true;
+  }
+  const auto dest_code = dest_type.GetTypeCode();
+  const auto src_code = src_type.GetTypeCode();
+  if (!IsScalarType(src_type))
+  {
+    m_error = kIncompatibleError;
+    return false;
+  }
+  const auto conversion = SelectLeafConversion(dest_code, src_code);
+  if (conversion.convert == nullptr)
+  {
+    m_error = UnsupportedLeafConversionError(dest_code, src_code);
+    return false;
+  }
+  m_steps.push_back({ ConversionOpcode::kScalar, 0, pos + 1, conversion.kind,
+                      conversion.convert, conversion.convert_array });
+  return true;
+}
+
+std::size_t ConversionPlan::ExecuteStep(std::size_t pos, AnyValue& dest, const AnyValue& src,
+                                        ThreadPool* thread_pool) const
+{
+  const auto& step = m_steps[pos];
+  switch (step.opcode)
+  {
+  case ConversionOpcode::kScalar:
+    step.convert(*dest.m_data, *src.m_data);
+    break;
+  case ConversionOpcode::kStruct:
+  {
+    auto next = pos + 1;
+    for (std::size_t idx = 0; idx < step.count; ++idx)
+    {
+      next = ExecuteStep(next, *dest.GetChildValue(idx), *src.GetChildValue(idx), thread_pool);
+    }
+    break;
+  }
+  case ConversionOpcode::kArray:
+  {
+    const auto n_elements = dest.NumberOfElements();
+    if (src.NumberOfElements() != n_elements)
+    {
+      throw InvalidConversionException(kArrayLengthError);
+    }
+    if (n_elements == 0)
+    {
+      break;
+    }
+    if (thread_pool != nullptr && n_elements >= utils::kMinParallelElements)
+    {
+      // Elements are converted in chunks; nested arrays are handled sequentially inside a chunk
+      auto convert_chunk = [this, pos, &dest, &src](std::size_t, std::size_t first,
+                                                    std::size_t last) {
+        ExecuteElements(pos + 1, dest, src, first, last, nullptr);
+      };
+      utils::ParallelForChunks(*thread_pool, n_elements, convert_chunk);
+      break;
+    }
+    ExecuteElements(pos + 1, dest, src, 0, n_elements, thread_pool);
+    break;
+  }
+  default:
+    break;
+  }
+  return step.end;
+}
+
+void ConversionPlan::ExecuteElements(std::size_t pos, AnyValue& dest, const AnyValue& src,
+                                     std::size_t first, std::size_t last,
+                                     ThreadPool* thread_pool) const
+{
+  const auto& element_step = m_steps[pos];
+  if (element_step.convert_array == nullptr)
+  {
+    for (auto idx = first; idx < last; ++idx)
+    {
+      (void)ExecuteStep(pos, *dest.GetChildValue(idx), *src.GetChildValue(idx), thread_pool);
+    }
+    return;
+  }
+  // Arithmetic elements are gathered and converted in blocks by the array conversion kernels:
+  IValueData* dest_block[kScalarArrayBlockSize];
+  const IValueData* src_block[kScalarArrayBlockSize];
+  for (auto block_first = first; block_first < last; block_first += kScalarArrayBlockSize)
+  {
+    const auto n = std::min(kScalarArrayBlockSize, last - block_first);
+    for (std::size_t idx = 0; idx < n; ++idx)
+    {
+      dest_block[idx] = dest.GetChildValue(block_first + idx)->m_data.get();
+      src_block[idx] = src.GetChildValue(block_first + idx)->m_data.get();
+    }
+    const auto n_converted = element_step.convert_array(dest_block, src_block, n);
+    if (n_converted < n)
+    {
+      throw InvalidConversionException(ArrayElementRangeError(block_first + n_converted));
+    }
+  }
+}
+
+LeafConversionKind GetLeafConversionKind(TypeCode dest_code, TypeCode src_code)
+{
+  return SelectLeafConversion(dest_code, src_code).kind;
+}
+
+std::shared_ptr<const ConversionPlan> GetConversionPlan(const AnyType& dest_type,
+                                                        const AnyType& src_type)
+{
+  const auto hash = CombineHashes(ConversionShapeHashT(dest_type), ConversionShapeHashT(src_type));
+  auto matches = [&dest_type, &src_type](const ConversionPlan& plan) {
+    return MatchesConversionShapeT(dest_type, plan.GetDestinationType()) &&
+           MatchesConversionShapeT(src_type, plan.GetSourceType());
+  };
+  auto compile = [&dest_type, &src_type]() {
+    return std::make_shared<const ConversionPlan>(dest_type, src_type);
+  };
+  return GetPlanCache().Get(hash, matches, compile);
+}
+
+std::shared_ptr<const ConversionPlan> GetConversionPlan(const AnyValue& dest, const AnyValue& src)
+{
+  const auto hash = CombineHashes(ConversionShapeHashT(dest), ConversionShapeHashT(src));
+  auto matches = [&dest, &src](const ConversionPlan& plan) {
+    return plan.Matches(dest, src);
+  };
+  auto compile = [&dest, &src]() {
+    return std::make_shared<const ConversionPlan>(dest.GetType(), src.GetType());
+  };
+  return GetPlanCache().Get(hash, matches, compile);
+}
+
+namespace
+{
+template <typename T>
+T& Payload(IValueData& value_data)
+{
+  return static_cast<ScalarValueDataT<T>&>(value_data).GetValue();
+}
+
+template <typename T>
+const T& Payload(const IValueData& value_data)
+{
+  return static_cast<const ScalarValueDataT<T>&>(value_data).GetValue();
+}
+
+template <typename T>
+void CopyLeaf(IValueData& dest, const IValueData& src)
+{
+  // Plain assignment reuses the capacity of string payloads
+  Payload<T>(dest) = Payload<T>(src);
+}
+
+template <typename To, typename From>
+void CastLeaf(IValueData& dest, const IValueData& src)
+{
+  Payload<To>(dest) = static_cast<To>(Payload<From>(src));
+}
+
+template <typename To, typename From>
+void CheckedLeaf(IValueData& dest, const IValueData& src)
+{
+  Payload<To>(dest) = ConvertScalar<To, From>(Payload<From>(src));
+}
+
+template <typename To, typename From>
+std::size_t ConvertLeafBlock(IValueData* const* dest, const IValueData* const* src, std::size_t n)
+{
+  From src_block[kScalarArrayBlockSize];
+  To dest_block[kScalarArrayBlockSize];
+  for (std::size_t idx = 0; idx < n; ++idx)
+  {
+    src_block[idx] = Payload<From>(*src[idx]);
+  }
+  const auto n_converted = ConvertScalarArray<To, From>(dest_block, src_block, n);
+  for (std::size_t idx = 0; idx < n_converted; ++idx)
+  {
+    Payload<To>(*dest[idx]) = dest_block[idx];
+  }
+  return n_converted;
+}
+
+void StringFromFixedStringLeaf(IValueData& dest, const IValueData& src)
+{
+  const auto& fixed_string = static_cast<const FixedStringValueData&>(src);
+  Payload<std::string>(dest).assign(fixed_string.GetData(), fixed_string.GetLength());
+}
+
+void FixedStringFromStringLeaf(IValueData& dest, const IValueData& src)
+{
+  const auto& str = Payload<std::string>(src);
+  static_cast<FixedStringValueData&>(dest).Assign(str.data(), str.size());
+}
+
+void FixedStringFromFixedStringLeaf(IValueData& dest, const IValueData& src)
+{
+  const auto& fixed_string = static_cast<const FixedStringValueData&>(src);
+  static_cast<FixedStringValueData&>(dest).Assign(fixed_string.GetData(),
+                                                  fixed_string.GetLength());
+}
+
+template <typename To, typename From,
+  typename std::enable_if<std::is_arithmetic<To>::value &&
+                          std::is_arithmetic<From>::value, bool>::type>
+LeafArrayConverter MakeLeafArrayConverter()
+{
+  return &ConvertLeafBlock<To, From>;
+}
+
+template <typename To, typename From,
+  typename std::enable_if<!std::is_arithmetic<To>::value ||
+                          !std::is_arithmetic<From>::value, bool>::type>
+LeafArrayConverter MakeLeafArrayConverter()
+{
+  return nullptr;
+}
+
+template <typename To, typename From>
+LeafConversion MakeLeafConversion(LeafConversionTag<LeafConversionKind::kIdentity>)
+{
+  return { LeafConversionKind::kIdentity, &CopyLeaf<To>, MakeLeafArrayConverter<To, From>() };
+}
+
+template <typename To, typename From>
+LeafConversion MakeLeafConversion(LeafConversionTag<LeafConversionKind::kWidening>)
+{
+  return { LeafConversionKind::kWidening, &CastLeaf<To, From>,
+           MakeLeafArrayConverter<To, From>() };
+}
+
+template <typename To, typename From>
+LeafConversion MakeLeafConversion(LeafConversionTag<LeafConversionKind::kNarrowing>)
+{
+  return { LeafConversionKind::kNarrowing, &CheckedLeaf<To, From>,
+           MakeLeafArrayConverter<To, From>() };
+}
+
+template <typename To, typename From>
+LeafConversion MakeLeafConversion(LeafConversionTag<LeafConversionKind::kUnsupported>)
+{
+  return { LeafConversionKind::kUnsupported, nullptr, nullptr };
+}
+
+template <typename To>
+LeafConversion SelectLeafConversionTo(TypeCode src_code)
+{
+  switch (src_code)
+  {
+  case TypeCode::Bool:
+    return MakeLeafConversion<To, boolean>(
+      LeafConversionTag<LeafConversionKindOf<To, boolean>::value>{});
+  case TypeCode::Char8:
+    return MakeLeafConversion<To, char8>(
+      LeafConversionTag<LeafConversionKindOf<To, char8>::value>{});
+  case TypeCode::Int8:
+    return MakeLeafConversion<To, int8>(
+      LeafConversionTag<LeafConversionKindOf<To, int8>::value>{});
+  case TypeCode::UInt8:
+    return MakeLeafConversion<To, uint8>(
+      LeafConversionTag<LeafConversionKindOf<To, uint8>::value>{});
+  case TypeCode::Int16:
+    return MakeLeafConversion<To, int16>(
+      LeafConversionTag<LeafConversionKindOf<To, int16>::value>{});
+  case TypeCode::UInt16:
+    return MakeLeafConversion<To, uint16>(
+      LeafConversionTag<LeafConversionKindOf<To, uint16>::value>{});
+  case TypeCode::Int32:
+    return MakeLeafConversion<To, int32>(
+      LeafConversionTag<LeafConversionKindOf<To, int32>::value>{});
+  case TypeCode::UInt32:
+    return MakeLeafConversion<To, uint32>(
+      LeafConversionTag<LeafConversionKindOf<To, uint32>::value>{});
+  case TypeCode::Int64:
+    return MakeLeafConversion<To, int64>(
+      LeafConversionTag<LeafConversionKindOf<To, int64>::value>{});
+  case TypeCode::UInt64:
+    return MakeLeafConversion<To, uint64>(
+      LeafConversionTag<LeafConversionKindOf<To, uint64>::value>{});
+  case TypeCode::Float32:
+    return MakeLeafConversion<To, float32>(
+      LeafConversionTag<LeafConversionKindOf<To, float32>::value>{});
+  case TypeCode::Float64:
+    return MakeLeafConversion<To, float64>(
+      LeafConversionTag<LeafConversionKindOf<To, float64>::value>{});
+  case TypeCode::String:
+    return MakeLeafConversion<To, std::string>(
+      LeafConversionTag<LeafConversionKindOf<To, std::string>::value>{});
+  default:
+    break;
+  }
+  return { LeafConversionKind::kUnsupported, nullptr, nullptr };
+}
+
+LeafConversion SelectLeafConversionToFixedString(TypeCode src_code)
+{
+  // Capacities are not known from the type codes: every conversion needs a check on the length
+  switch (src_code)
+  {
+  case TypeCode::String:
+    return { LeafConversionKind::kNarrowing, &FixedStringFromStringLeaf, nullptr };
+  case TypeCode::FixedString:
+    return { LeafConversionKind::kNarrowing, &FixedStringFromFixedStringLeaf, nullptr };
+  default:
+    break;
+  }
+  return { LeafConversionKind::kUnsupported, nullptr, nullptr };
+}
+
+LeafConversion SelectLeafConversion(TypeCode dest_code, TypeCode src_code)
+{
+  switch (dest_code)
+  {
+  case TypeCode::Bool:
+    return SelectLeafConversionTo<boolean>(src_code);
+  case TypeCode::Char8:
+    return SelectLeafConversionTo<char8>(src_code);
+  case TypeCode::Int8:
+    return SelectLeafConversionTo<int8>(src_code);
+  case TypeCode::UInt8:
+    return SelectLeafConversionTo<uint8>(src_code);
+  case TypeCode::Int16:
+    return SelectLeafConversionTo<int16>(src_code);
+  case TypeCode::UInt16:
+    return SelectLeafConversionTo<uint16>(src_code);
+  case TypeCode::Int32:
+    return SelectLeafConversionTo<int32>(src_code);
+  case TypeCode::UInt32:
+    return SelectLeafConversionTo<uint32>(src_code);
+  case TypeCode::Int64:
+    return SelectLeafConversionTo<int64>(src_code);
+  case TypeCode::UInt64:
+    return SelectLeafConversionTo<uint64>(src_code);
+  case TypeCode::Float32:
+    return SelectLeafConversionTo<float32>(src_code);
+  case TypeCode::Float64:
+    return SelectLeafConversionTo<float64>(src_code);
+  case TypeCode::String:
+    if (src_code == TypeCode::FixedString)
+    {
+      return { LeafConversionKind::kWidening, &StringFromFixedStringLeaf, nullptr };
+    }
+    return SelectLeafConversionTo<std::string>(src_code);
+  case TypeCode::FixedString:
+    return SelectLeafConversionToFixedString(src_code);
+  default:
+    break;
+  }
+  return { LeafConversionKind::kUnsupported, nullptr, nullptr };
+}
+
+std::string UnsupportedLeafConversionError(TypeCode dest_code, TypeCode src_code)
+{
+  if (IsStringTypeCode(dest_code) && IsScalarTypeCode(src_code))
+  {
+    return "Cannot convert arithmetic types to string";
+  }
+  if (IsStringTypeCode(src_code) && IsScalarTypeCode(dest_code))
+  {
+    return "Cannot convert string to arithmetic types";
+  }
+  return kIncompatibleError;
+}
+
+bool IsStringTypeCode(TypeCode type_code)
+{
+  return type_code == TypeCode::String || type_code == TypeCode::FixedString;
+}
+
+std::string ArrayElementRangeError(std::size_t idx)
+{
+  return "Source value doesn't fit in destination type (array element " + std::to_string(idx) +
+         ")";
+}
+
+TypeKeyedCache<ConversionPlan>& GetPlanCache()
+{
+  static TypeKeyedCache<ConversionPlan> cache{kMaxCachedPlans};
+  return cache;
+}
+
+template <typename T>
+std::size_t ConversionShapeHashT(const T& node)
+{
+  const auto type_code = node.GetTypeCode();
+  auto hash = std::hash<std::size_t>{}(static_cast<std::size_t>(type_code));
+  if (IsStructTypeCode(type_code))
+  {
+    const auto n_members = node.NumberOfMembers();
+    for (std::size_t idx = 0; idx < n_members; ++idx)
+    {
+      hash = CombineHashes(hash, std::hash<std::string>{}(GetIndexedMemberName(&node, idx)));
+      hash = CombineHashes(hash, ConversionShapeHashT(*GetIndexedChild(&node, idx)));
+    }
+  }
+  else if (IsArrayTypeCode(type_code))
+  {
+    // Only the presence of elements determines the steps of an array
+    const bool has_elements = node.NumberOfElements() > 0;
+    hash = CombineHashes(hash, has_elements ? 1u : 0u);
+    if (has_elements)
+    {
+      hash = CombineHashes(hash, ConversionShapeHashT(*GetIndexedChild(&node, 0)));
+    }
+  }
+  return hash;
+}
+
+template <typename T>
+bool MatchesConversionShapeT(const T& node, const AnyType& other)
+{
+  const auto type_code = node.GetTypeCode();
+  if (type_code != other.GetTypeCode())
+  {
+    return false;
+  }
+  if (IsStructTypeCode(type_code))
+  {
+    const auto n_members = node.NumberOfMembers();
+    if (other.NumberOfMembers() != n_members)
+    {
+      return false;
+    }
+    for (std::size_t idx = 0; idx < n_members; ++idx)
+    {
+      if (GetIndexedMemberName(&node, idx) != other.GetMemberName(idx) ||
+          !MatchesConversionShapeT(*GetIndexedChild(&node, idx), *other.GetChildType(idx)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (IsArrayTypeCode(type_code))
+  {
+    const bool has_elements = node.NumberOfElements() > 0;
+    if ((other.NumberOfElements() > 0) != has_elements)
+    {
+      return false;
+    }
+    return !has_elements ||
+           MatchesConversionShapeT(*GetIndexedChild(&node, 0), *other.GetChildType(0));
+  }
+  return true;
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
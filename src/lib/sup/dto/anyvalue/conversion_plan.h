@@ -0,0 +1,222 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_CONVERSION_PLAN_H_
+#define SUP_DTO_CONVERSION_PLAN_H_
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+class IValueData;
+class ThreadPool;
+
+/**
+ * @brief Kind of conversion between a source and destination leaf, as determined by their type
+ * codes only.
+ */
+enum class LeafConversionKind : sup::dto::uint32
+{
+  kIdentity = 0,  // Same type: plain copy of the payload
+  kWidening,      // Conversion that can never fail
+  kNarrowing,     // Conversion that needs a range check on the actual value
+  kUnsupported    // Conversion that always fails (e.g. between string and arithmetic types)
+};
+
+using LeafConverter = void (*)(IValueData& dest, const IValueData& src);
+
+// Converts a block of at most kScalarArrayBlockSize leaves and returns the number of converted
+// leaves. When this is less than n, it is the index of the first source value that didn't fit.
+using LeafArrayConverter = std::size_t (*)(IValueData* const* dest, const IValueData* const* src,
+                                           std::size_t n);
+
+/**
+ * @brief Operation codes of the steps in a ConversionPlan.
+ */
+enum class ConversionOpcode : sup::dto::uint32
+{
+  kEmpty = 0,
+  kStruct,
+  kArray,
+  kScalar
+};
+
+/**
+ * @brief Single step of a ConversionPlan.
+ *
+ * @details For kStruct, count is the number of members and the steps of the members follow
+ * consecutively. For kArray, the number of elements is taken from the values on execution, the
+ * steps of the element type follow once (when the compiled types have elements) and end is the
+ * position after them. Scalar steps carry the leaf conversion and, for
+ * arithmetic leaves, the block conversion used for arrays of such leaves.
+ */
+struct ConversionStep
+{
+  ConversionOpcode opcode;
+  std::size_t count;
+  std::size_t end;
+  LeafConversionKind kind;
+  LeafConverter convert;
+  LeafArrayConverter convert_array;
+};
+
+/**
+ * @brief Conversion between values of a fixed pair of types, compiled once from these types.
+ *
+ * @details Compiling the plan performs all structural compatibility checks that
+ * AnyValue::ConvertFrom would otherwise repeat for every node and selects a direct conversion
+ * function for every leaf. Executing the plan is a single pass over both values that only performs
+ * the range checks of narrowing conversions.
+ *
+ * Plans do not depend on type names or on the number of array elements, which is checked on
+ * execution. They can thus be shared between all pairs of values that have the same conversion
+ * shape, see Matches.
+ *
+ * @note The behavior is only defined for values that match the plan.
+ */
+class ConversionPlan
+{
+public:
+  ConversionPlan(const AnyType& dest_type, const AnyType& src_type);
+  ~ConversionPlan();
+
+  ConversionPlan(const ConversionPlan& other) = delete;
+  ConversionPlan(ConversionPlan&& other) = delete;
+  ConversionPlan& operator=(const ConversionPlan& other) = delete;
+  ConversionPlan& operator=(ConversionPlan&& other) = delete;
+
+  const AnyType& GetDestinationType() const;
+  const AnyType& GetSourceType() const;
+
+  /**
+   * @brief Check if the types are compatible, i.e. if executing the plan can succeed.
+   */
+  bool IsValid() const;
+
+  const std::vector<ConversionStep>& GetSteps() const;
+
+  /**
+   * @brief Check if the plan can be used to convert between the given values, i.e. if their types
+   * only differ from the types the plan was compiled from in type names, string capacities and
+   * numbers of array elements (empty arrays excepted). Their types are not constructed.
+   */
+  bool Matches(const AnyValue& dest, const AnyValue& src) const;
+
+  /**
+   * @brief Convert the source value into the destination value.
+   *
+   * @throws InvalidConversionException Thrown when the types are not compatible or when a
+   * narrowing conversion fails. In the latter case, the destination can be partially updated.
+   */
+  void Execute(AnyValue& dest, const AnyValue& src) const;
+
+  /**
+   * @brief Convert the source value into the destination value, converting the elements of large
+   * arrays in parallel.
+   *
+   * @throws InvalidConversionException Thrown when the types are not compatible or when a
+   * narrowing conversion fails. In the latter case, the destination can be partially updated.
+   */
+  void Execute(AnyValue& dest, const AnyValue& src, ThreadPool& thread_pool) const;
+
+  /**
+   * @brief Convert a single scalar value into another, without using a compiled plan.
+   *
+   * @throws InvalidConversionException Thrown when the conversion fails.
+   */
+  static void ConvertScalarValue(AnyValue& dest, const AnyValue& src);
+
+  /**
+   * @brief Convert the payload of a scalar into a scalar value, e.g. a payload that was not
+   * allocated on the heap.
+   *
+   * @throws InvalidConversionException Thrown when the conversion fails.
+   */
+  static void ConvertScalarData(AnyValue& dest, const IValueData& src_data);
+
+  /**
+   * @brief Check if two values have identical types, without constructing their AnyType
+   * representation and without allocating memory.
+   */
+  static bool HaveIdenticalTypes(const AnyValue& lhs, const AnyValue& rhs);
+
+  /**
+   * @brief Copy all leaves of the source value into the existing nodes of the destination value,
+   * reusing the capacity of string leaves.
+   *
+   * @note The behavior is only defined for values with identical types (see HaveIdenticalTypes).
+   */
+  static void CopyIdenticalValue(AnyValue& dest, const AnyValue& src);
+
+private:
+  bool Compile(const AnyType& dest_type, const AnyType& src_type);
+  std::size_t ExecuteStep(std::size_t pos, AnyValue& dest, const AnyValue& src,
+                          ThreadPool* thread_pool) const;
+  void ExecuteElements(std::size_t pos, AnyValue& dest, const AnyValue& src, std::size_t first,
+                       std::size_t last, ThreadPool* thread_pool) const;
+  AnyType m_dest_type;
+  AnyType m_src_type;
+  std::vector<ConversionStep> m_steps;
+  std::string m_error;
+};
+
+/**
+ * @brief Get the kind of the direct conversion between scalar leaves with the given type codes.
+ */
+LeafConversionKind GetLeafConversionKind(TypeCode dest_code, TypeCode src_code);
+
+/**
+ * @brief Retrieve the (shared) conversion plan for the given pair of types from a global cache,
+ * compiling it first when it was not yet cached.
+ *
+ * @details The types of the returned plan can differ from the given types in the properties that
+ * the plan does not depend on, see ConversionPlan::Matches.
+ *
+ * @note This function is thread safe.
+ */
+std::shared_ptr<const ConversionPlan> GetConversionPlan(const AnyType& dest_type,
+                                                        const AnyType& src_type);
+
+/**
+ * @brief Retrieve the (shared) conversion plan between the types of the given values from a global
+ * cache, compiling it first when it was not yet cached.
+ *
+ * @details The lookup only walks the structure of the values and does not construct their types,
+ * unless the plan needs to be compiled. Callers that repeatedly convert between values of the same
+ * types can hold on to the returned plan and check it with ConversionPlan::Matches.
+ *
+ * @note This function is thread safe.
+ */
+std::shared_ptr<const ConversionPlan> GetConversionPlan(const AnyValue& dest, const AnyValue& src);
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_CONVERSION_PLAN_H_
@@ -0,0 +1,395 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/ctype_layout.h>
+
+#include <sup/dto/anyvalue/fixed_string_value_data.h>
+#include <sup/dto/anyvalue/scalar_value_data_t.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace sup
+{
+namespace dto
+{
+using LeafStore = void (*)(const IValueData& src, uint8* dest);
+using LeafLoad = void (*)(IValueData& dest, const uint8* src);
+
+/**
+ * @brief Single step of a CLayout.
+ *
+ * @details Steps are stored in depth-first order. The offset of a step is relative to the start of
+ * its parent structure or array element. For structures, count is the number of members and the
+ * steps of the members follow consecutively. For arrays, count is the number of elements, stride
+ * is the size of an element and the steps of the element type follow once. In both cases, end is
+ * the position after the steps of the children. For fixed-capacity string leaves, count is the
+ * capacity of the string.
+ */
+struct CLayoutStep
+{
+  TypeCode type_code;
+  std::size_t offset;
+  std::size_t count;
+  std::size_t stride;
+  std::size_t end;
+  LeafStore store;
+  LeafLoad load;
+};
+
+namespace
+{
+struct LeafLayout
+{
+  std::size_t size;
+  std::size_t alignment;
+  LeafStore store;
+  LeafLoad load;
+};
+
+LeafLayout GetLeafLayout(const AnyType& anytype);
+
+void StoreFixedStringLeaf(const IValueData& src, uint8* dest);
+
+void LoadFixedStringLeaf(IValueData& dest, const uint8* src);
+
+std::size_t RoundUp(std::size_t offset, std::size_t alignment);
+
+bool IsValidPack(std::size_t pack);
+
+std::size_t NumberOfChildren(const AnyValue& anyvalue);
+}  // unnamed namespace
+
+CLayout::CLayout(const AnyType& anytype)
+  : CLayout(anytype, 0)
+{}
+
+CLayout::CLayout(const AnyType& anytype, std::size_t pack)
+  : m_anytype{anytype}
+  , m_pack{pack}
+  , m_size{0}
+  , m_alignment{1}
+  , m_steps{}
+{
+  if (!IsValidPack(pack))
+  {
+    throw InvalidOperationException("CLayout(): pack value must be zero or a power of two");
+  }
+  m_size = Compile(m_anytype, m_alignment);
+}
+
+CLayout::~CLayout() = default;
+
+const AnyType& CLayout::GetType() const
+{
+  return m_anytype;
+}
+
+std::size_t CLayout::GetPack() const
+{
+  return m_pack;
+}
+
+std::size_t CLayout::GetSize() const
+{
+  return m_size;
+}
+
+std::size_t CLayout::GetAlignment() const
+{
+  return m_alignment;
+}
+
+void CLayout::Write(const AnyValue& anyvalue, void* object, std::size_t size) const
+{
+  if (size != m_size)
+  {
+    throw SerializeException("CLayout::Write(): size mismatch");
+  }
+  (void)WriteNode(0, anyvalue, static_cast<uint8*>(object));
+}
+
+void CLayout::Read(AnyValue& anyvalue, const void* object, std::size_t size) const
+{
+  if (size != m_size)
+  {
+    throw ParseException("CLayout::Read(): size mismatch");
+  }
+  (void)ReadNode(0, anyvalue, static_cast<const uint8*>(object));
+}
+
+std::size_t CLayout::Compile(const AnyType& anytype, std::size_t& alignment)
+{
+  const auto pos = m_steps.size();
+  const auto type_code = anytype.GetTypeCode();
+  m_steps.push_back({type_code, 0, 0, 0, 0, nullptr, nullptr});
+  std::size_t size = 0;
+  alignment = 1;
+  if (IsStructType(anytype))
+  {
+    const auto n_members = anytype.NumberOfMembers();
+    for (std::size_t idx = 0; idx < n_members; ++idx)
+    {
+      const auto member_pos = m_steps.size();
+      std::size_t member_alignment = 1;
+      const auto member_size = Compile(*anytype.GetChildType(idx), member_alignment);
+      size = RoundUp(size, member_alignment);
+      m_steps[member_pos].offset = size;
+      size += member_size;
+      alignment = std::max(alignment, member_alignment);
+    }
+    size = RoundUp(size, alignment);
+    m_steps[pos].count = n_members;
+  }
+  else if (IsArrayType(anytype))
+  {
+    const auto n_elements = anytype.NumberOfElements();
+    const auto stride = Compile(anytype.ElementType(), alignment);
+    size = n_elements * stride;
+    m_steps[pos].count = n_elements;
+    m_steps[pos].stride = stride;
+  }
+  else if (IsScalarType(anytype))
+  {
+    const auto leaf_layout = GetLeafLayout(anytype);
+    size = leaf_layout.size;
+    m_steps[pos].count = anytype.StringCapacity();
+    alignment = (m_pack == 0) ? leaf_layout.alignment : std::min(leaf_layout.alignment, m_pack);
+    m_steps[pos].store = leaf_layout.store;
+    m_steps[pos].load = leaf_layout.load;
+  }
+  m_steps[pos].end = m_steps.size();
+  return size;
+}
+
+std::size_t CLayout::WriteNode(std::size_t pos, const AnyValue& anyvalue, uint8* base) const
+{
+  const auto& step = m_steps[pos];
+  if (anyvalue.GetTypeCode() != step.type_code)
+  {
+    throw SerializeException("CLayout::Write(): value doesn't match the layout's type");
+  }
+  auto address = base + step.offset;
+  if (step.store != nullptr)
+  {
+    if (anyvalue.StringCapacity() != step.count)
+    {
+      throw SerializeException("CLayout::Write(): value doesn't match the layout's type");
+    }
+    step.store(*anyvalue.m_data, address);
+    return step.end;
+  }
+  const auto n_children = NumberOfChildren(anyvalue);
+  if (n_children != step.count)
+  {
+    throw SerializeException("CLayout::Write(): value doesn't match the layout's type");
+  }
+  const bool is_array = IsArrayValue(anyvalue);
+  auto child_pos = pos + 1;
+  for (std::size_t idx = 0; idx < n_children; ++idx)
+  {
+    if (is_array)
+    {
+      (void)WriteNode(pos + 1, *anyvalue.GetChildValue(idx), address + idx * step.stride);
+    }
+    else
+    {
+      child_pos = WriteNode(child_pos, *anyvalue.GetChildValue(idx), address);
+    }
+  }
+  return step.end;
+}
+
+std::size_t CLayout::ReadNode(std::size_t pos, AnyValue& anyvalue, const uint8* base) const
+{
+  const auto& step = m_steps[pos];
+  if (anyvalue.GetTypeCode() != step.type_code)
+  {
+    throw ParseException("CLayout::Read(): value doesn't match the layout's type");
+  }
+  auto address = base + step.offset;
+  if (step.load != nullptr)
+  {
+    if (anyvalue.StringCapacity() != step.count)
+    {
+      throw ParseException("CLayout::Read(): value doesn't match the layout's type");
+    }
+    step.load(*anyvalue.m_data, address);
+    return step.end;
+  }
+  const auto n_children = NumberOfChildren(anyvalue);
+  if (n_children != step.count)
+  {
+    throw ParseException("CLayout::Read(): value doesn't match the layout's type");
+  }
+  const bool is_array = IsArrayValue(anyvalue);
+  auto child_pos = pos + 1;
+  for (std::size_t idx = 0; idx < n_children; ++idx)
+  {
+    if (is_array)
+    {
+      (void)ReadNode(pos + 1, *anyvalue.GetChildValue(idx), address + idx * step.stride);
+    }
+    else
+    {
+      child_pos = ReadNode(child_pos, *anyvalue.GetChildValue(idx), address);
+    }
+  }
+  return step.end;
+}
+
+namespace
+{
+template <typename T>
+void StoreLeaf(const IValueData& src, uint8* dest)
+{
+  const auto& payload = static_cast<const ScalarValueDataT<T>&>(src).GetValue();
+  (void)std::memcpy(dest, std::addressof(payload), sizeof(T));
+}
+
+template <>
+void StoreLeaf<std::string>(const IValueData& src, uint8* dest)
+{
+  const auto& payload = static_cast<const ScalarValueDataT<std::string>&>(src).GetValue();
+  const auto size = payload.size();
+  if ((size + 1) > kStringMaxLength)
+  {
+    throw SerializeException("Strings should not exceed max length for C-type casting");
+  }
+  (void)std::memcpy(dest, payload.data(), size);
+  (void)std::memset(dest + size, 0, kStringMaxLength - size);
+}
+
+template <typename T>
+void LoadLeaf(IValueData& dest, const uint8* src)
+{
+  auto& payload = static_cast<ScalarValueDataT<T>&>(dest).GetValue();
+  (void)std::memcpy(std::addressof(payload), src, sizeof(T));
+}
+
+template <>
+void LoadLeaf<std::string>(IValueData& dest, const uint8* src)
+{
+  const auto* terminator = static_cast<const uint8*>(std::memchr(src, 0, kStringMaxLength));
+  if (terminator == nullptr)
+  {
+    throw ParseException("C-type string is not zero-terminated");
+  }
+  auto& payload = static_cast<ScalarValueDataT<std::string>&>(dest).GetValue();
+  (void)payload.assign(reinterpret_cast<const char*>(src), terminator - src);
+}
+
+void StoreFixedStringLeaf(const IValueData& src, uint8* dest)
+{
+  // The buffer is zero after the string's content, so it maps one to one on the char array
+  const auto& fixed_string = static_cast<const FixedStringValueData&>(src);
+  (void)std::memcpy(dest, fixed_string.GetData(), fixed_string.StringCapacity());
+}
+
+void LoadFixedStringLeaf(IValueData& dest, const uint8* src)
+{
+  auto& fixed_string = static_cast<FixedStringValueData&>(dest);
+  const auto capacity = fixed_string.StringCapacity();
+  const auto* terminator = static_cast<const uint8*>(std::memchr(src, 0, capacity));
+  if (terminator == nullptr)
+  {
+    throw ParseException("C-type string is not zero-terminated");
+  }
+  fixed_string.Assign(reinterpret_cast<const char8*>(src), terminator - src);
+}
+
+template <typename T>
+LeafLayout MakeLeafLayout()
+{
+  return { sizeof(T), alignof(T), StoreLeaf<T>, LoadLeaf<T> };
+}
+
+template <>
+LeafLayout MakeLeafLayout<std::string>()
+{
+  return { kStringMaxLength, alignof(char8), StoreLeaf<std::string>, LoadLeaf<std::string> };
+}
+
+LeafLayout GetLeafLayout(const AnyType& anytype)
+{
+  switch (anytype.GetTypeCode())
+  {
+  case TypeCode::Bool:
+    return MakeLeafLayout<boolean>();
+  case TypeCode::Char8:
+    return MakeLeafLayout<char8>();
+  case TypeCode::Int8:
+    return MakeLeafLayout<int8>();
+  case TypeCode::UInt8:
+    return MakeLeafLayout<uint8>();
+  case TypeCode::Int16:
+    return MakeLeafLayout<int16>();
+  case TypeCode::UInt16:
+    return MakeLeafLayout<uint16>();
+  case TypeCode::Int32:
+    return MakeLeafLayout<int32>();
+  case TypeCode::UInt32:
+    return MakeLeafLayout<uint32>();
+  case TypeCode::Int64:
+    return MakeLeafLayout<int64>();
+  case TypeCode::UInt64:
+    return MakeLeafLayout<uint64>();
+  case TypeCode::Float32:
+    return MakeLeafLayout<float32>();
+  case TypeCode::Float64:
+    return MakeLeafLayout<float64>();
+  case TypeCode::String:
+    return MakeLeafLayout<std::string>();
+  case TypeCode::FixedString:
+    return { anytype.StringCapacity(), alignof(char8), StoreFixedStringLeaf, LoadFixedStringLeaf };
+  default:
+    break;
+  }
+  throw InvalidOperationException("CLayout(): not a known scalar type code");
+}
+
+std::size_t RoundUp(std::size_t offset, std::size_t alignment)
+{
+  return ((offset + alignment - 1) / alignment) * alignment;
+}
+
+bool IsValidPack(std::size_t pack)
+{
+  return (pack & (pack - 1)) == 0;
+}
+
+std::size_t NumberOfChildren(const AnyValue& anyvalue)
+{
+  if (IsStructValue(anyvalue))
+  {
+    return anyvalue.NumberOfMembers();
+  }
+  return IsArrayValue(anyvalue) ? anyvalue.NumberOfElements() : 0;
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
@@ -44,9 +44,9 @@ TypeCode EmptyValueData::GetTypeCode() const
   return TypeCode::Empty;
 }
 
-std::string EmptyValueData::GetTypeName() const
+const std::string& EmptyValueData::GetTypeName() const
 {
-  return AnyType{}.GetTypeName();
+  return kEmptyTypeName;
 }
 
 Constraints EmptyValueData::GetConstraints() const
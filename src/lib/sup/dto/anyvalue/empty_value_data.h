@@ -41,7 +41,7 @@ public:
   EmptyValueData& operator=(EmptyValueData&& other) = delete;
 
   TypeCode GetTypeCode() const override;
-  std::string GetTypeName() const override;
+  const std::string& GetTypeName() const override;
 
   Constraints GetConstraints() const override;
 
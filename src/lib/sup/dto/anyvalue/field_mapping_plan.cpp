@@ -0,0 +1,307 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/anyvalue/field_mapping_plan.h>
+
+#include <sup/dto/anyvalue/subtype_copy_node.h>
+#include <sup/dto/serialize/serialization_plan.h>
+#include <sup/dto/serialize/type_keyed_cache.h>
+
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <deque>
+#include <optional>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+// Maximum number of plans kept in the global cache; least recently used plans are evicted first:
+const std::size_t kMaxCachedPlans = 256;
+
+TypeKeyedCache<FieldMappingPlan>& GetPlanCache();
+
+// Check the parts of two types with the same shape (see MatchesShape) that the shape does not
+// cover: the names of structured types and the element types of empty arrays:
+bool HasSameTypeNames(const AnyType& lhs, const AnyType& rhs);
+
+// Index of the member with the given name or the number of members if there is no such member:
+std::size_t FindMemberIndex(const AnyType& anytype, const std::string& member_name);
+
+// Try to create a new type that has the same tree structure as the source type, but with leaf
+// types from the corresponding target type. The target type is allowed to contain
+// unused structure members. If at some node location, the target is not a structure, it
+// will be used directly into the result, even when the corresponding source type has an
+// incompatible type at this node. This simplifies the code and since it is used only to do
+// conversions of AnyValues, such incompatibilities will be caught there.
+std::optional<AnyType> TrySubtypeCopy(const AnyType& src_type, const AnyType& target_type);
+}  // unnamed namespace
+
+FieldMappingPlan::FieldMappingPlan(const AnyType& src_type, const AnyType& target_type,
+                                   FieldMappingMode mode)
+  : m_src_type{src_type}
+  , m_target_type{target_type}
+  , m_mode{mode}
+  , m_result_type{}
+  , m_steps{}
+{
+  if (!Compile())
+  {
+    m_steps.clear();
+  }
+}
+
+FieldMappingPlan::~FieldMappingPlan() = default;
+
+const AnyType& FieldMappingPlan::GetSourceType() const
+{
+  return m_src_type;
+}
+
+const AnyType& FieldMappingPlan::GetTargetType() const
+{
+  return m_target_type;
+}
+
+FieldMappingMode FieldMappingPlan::GetMode() const
+{
+  return m_mode;
+}
+
+bool FieldMappingPlan::IsValid() const
+{
+  return !m_steps.empty();
+}
+
+const AnyType& FieldMappingPlan::GetResultType() const
+{
+  return m_result_type;
+}
+
+const std::vector<FieldMappingStep>& FieldMappingPlan::GetSteps() const
+{
+  return m_steps;
+}
+
+bool FieldMappingPlan::Matches(const AnyValue& src) const
+{
+  return MatchesShape(src, m_src_type);
+}
+
+void FieldMappingPlan::Execute(AnyValue& dest, const AnyValue& src) const
+{
+  if (!IsValid())
+  {
+    throw InvalidConversionException("Cannot map fields of incompatible AnyValue");
+  }
+  (void)ExecuteStep(0, dest, src);
+}
+
+bool FieldMappingPlan::Compile()
+{
+  if (m_mode == FieldMappingMode::kAllowExtraSourceFields)
+  {
+    m_result_type = m_target_type;
+    return CompileSourceMapping(m_result_type, m_src_type, 0);
+  }
+  auto result_type = TrySubtypeCopy(m_src_type, m_target_type);
+  if (!result_type)
+  {
+    return false;
+  }
+  m_result_type = std::move(result_type.value());
+  return CompileConversion(m_result_type, m_src_type, 0);
+}
+
+bool FieldMappingPlan::CompileSourceMapping(const AnyType& dest_type, const AnyType& src_type,
+                                            std::size_t src_index)
+{
+  if (!IsStructType(dest_type))
+  {
+    return CompileConversion(dest_type, src_type, src_index);
+  }
+  const auto n_members = dest_type.NumberOfMembers();
+  if (n_members > 0 && !IsStructType(src_type))
+  {
+    return false;
+  }
+  const auto pos = m_steps.size();
+  m_steps.push_back({ FieldMappingOpcode::kStruct, n_members, src_index, 0, nullptr });
+  for (std::size_t idx = 0; idx < n_members; ++idx)
+  {
+    const auto src_member_idx = FindMemberIndex(src_type, dest_type.GetMemberName(idx));
+    if (src_member_idx == src_type.NumberOfMembers())
+    {
+      return false;
+    }
+    if (!CompileSourceMapping(*dest_type.GetChildType(idx), *src_type.GetChildType(src_member_idx),
+                              src_member_idx))
+    {
+      return false;
+    }
+  }
+  m_steps[pos].end = m_steps.size();
+  return true;
+}
+
+bool FieldMappingPlan::CompileConversion(const AnyType& dest_type, const AnyType& src_type,
+                                         std::size_t src_index)
+{
+  auto conversion = GetConversionPlan(dest_type, src_type);
+  if (!conversion->IsValid())
+  {
+    return false;
+  }
+  const auto pos = m_steps.size();
+  m_steps.push_back({ FieldMappingOpcode::kConvert, 0, src_index, pos + 1,
+                      std::move(conversion) });
+  return true;
+}
+
+std::size_t FieldMappingPlan::ExecuteStep(std::size_t pos, AnyValue& dest,
+                                          const AnyValue& src) const
+{
+  const auto& step = m_steps[pos];
+  if (step.opcode == FieldMappingOpcode::kConvert)
+  {
+    step.conversion->Execute(dest, src);
+    return step.end;
+  }
+  auto next = pos + 1;
+  for (std::size_t idx = 0; idx < step.count; ++idx)
+  {
+    const auto src_member_idx = m_steps[next].src_index;
+    next = ExecuteStep(next, *dest.GetChildValue(idx), *src.GetChildValue(src_member_idx));
+  }
+  return step.end;
+}
+
+std::shared_ptr<const FieldMappingPlan> GetFieldMappingPlan(const AnyValue& src,
+                                                            const AnyType& target_type,
+                                                            FieldMappingMode mode)
+{
+  const auto hash = CombineHashes(CombineHashes(ShapeHash(src), ShapeHash(target_type)),
+                                  static_cast<std::size_t>(mode));
+  auto matches = [&src, &target_type, mode](const FieldMappingPlan& plan) {
+    const auto& plan_target = plan.GetTargetType();
+    return plan.GetMode() == mode && MatchesShape(target_type, plan_target) &&
+           HasSameTypeNames(target_type, plan_target) && plan.Matches(src);
+  };
+  auto compile = [&src, &target_type, mode]() {
+    return std::make_shared<const FieldMappingPlan>(src.GetType(), target_type, mode);
+  };
+  return GetPlanCache().Get(hash, matches, compile);
+}
+
+namespace
+{
+TypeKeyedCache<FieldMappingPlan>& GetPlanCache()
+{
+  static TypeKeyedCache<FieldMappingPlan> cache{kMaxCachedPlans};
+  return cache;
+}
+
+bool HasSameTypeNames(const AnyType& lhs, const AnyType& rhs)
+{
+  // Scalar type names are determined by their type code
+  if (IsStructType(lhs))
+  {
+    if (lhs.GetTypeName() != rhs.GetTypeName())
+    {
+      return false;
+    }
+    const auto n_members = lhs.NumberOfMembers();
+    for (std::size_t idx = 0; idx < n_members; ++idx)
+    {
+      if (!HasSameTypeNames(*lhs.GetChildType(idx), *rhs.GetChildType(idx)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (IsArrayType(lhs))
+  {
+    if (lhs.GetTypeName() != rhs.GetTypeName())
+    {
+      return false;
+    }
+    if (lhs.NumberOfElements() == 0)
+    {
+      return *lhs.GetChildType(0) == *rhs.GetChildType(0);
+    }
+    return HasSameTypeNames(*lhs.GetChildType(0), *rhs.GetChildType(0));
+  }
+  return true;
+}
+
+std::size_t FindMemberIndex(const AnyType& anytype, const std::string& member_name)
+{
+  const auto n_members = anytype.NumberOfMembers();
+  for (std::size_t idx = 0; idx < n_members; ++idx)
+  {
+    if (anytype.GetMemberName(idx) == member_name)
+    {
+      return idx;
+    }
+  }
+  return n_members;
+}
+
+std::optional<AnyType> TrySubtypeCopy(const AnyType& src_type, const AnyType& target_type)
+{
+  std::deque<SubtypeCopyNode> stack{};
+  (void)stack.emplace_back(std::addressof(src_type), std::addressof(target_type));
+  while (true)
+  {
+    auto& top = stack.back();
+    if (top.HasNextChild())
+    {
+      auto next_child_node = top.GetNextChildNode();
+      if (!next_child_node)
+      {
+        return {};
+      }
+      stack.push_back(std::move(next_child_node.value()));
+    }
+    else
+    {
+      auto current_node = std::move(top);
+      stack.pop_back();
+      if (!stack.empty())
+      {
+        stack.back().AddChildNode(current_node);
+      }
+      else
+      {
+        return current_node.MoveResult();
+      }
+    }
+  }
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
@@ -0,0 +1,153 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_FIELD_MAPPING_PLAN_H_
+#define SUP_DTO_FIELD_MAPPING_PLAN_H_
+
+#include <sup/dto/anyvalue/conversion_plan.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+
+#include <memory>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+/**
+ * @brief Schema-tolerant conversions supported by a FieldMappingPlan.
+ */
+enum class FieldMappingMode : sup::dto::uint32
+{
+  kAllowExtraSourceFields = 0,  // See TryConvertAllowExtraSourceFields
+  kAllowExtraTargetFields       // See TryConvertAllowExtraTargetFields
+};
+
+/**
+ * @brief Operation codes of the steps in a FieldMappingPlan.
+ */
+enum class FieldMappingOpcode : sup::dto::uint32
+{
+  kStruct = 0,
+  kConvert
+};
+
+/**
+ * @brief Single step of a FieldMappingPlan.
+ *
+ * @details For kStruct, count is the number of members of the destination structure and the steps
+ * of these members follow consecutively. For every step, src_index is the index of the member in
+ * the enclosing source structure that is mapped onto the destination node. kConvert steps convert
+ * the whole subtree with a compiled conversion plan.
+ */
+struct FieldMappingStep
+{
+  FieldMappingOpcode opcode;
+  std::size_t count;
+  std::size_t src_index;
+  std::size_t end;
+  std::shared_ptr<const ConversionPlan> conversion;
+};
+
+/**
+ * @brief Mapping of the fields of a source type onto a target type that may contain fewer or more
+ * structure members, compiled once from these types.
+ *
+ * @details Compiling the plan resolves all member names to indices and determines the type of the
+ * result. Executing the plan only performs the leaf conversions.
+ */
+class FieldMappingPlan
+{
+public:
+  FieldMappingPlan(const AnyType& src_type, const AnyType& target_type, FieldMappingMode mode);
+  ~FieldMappingPlan();
+
+  FieldMappingPlan(const FieldMappingPlan& other) = delete;
+  FieldMappingPlan(FieldMappingPlan&& other) = delete;
+  FieldMappingPlan& operator=(const FieldMappingPlan& other) = delete;
+  FieldMappingPlan& operator=(FieldMappingPlan&& other) = delete;
+
+  const AnyType& GetSourceType() const;
+  const AnyType& GetTargetType() const;
+  FieldMappingMode GetMode() const;
+
+  /**
+   * @brief Check if the source fields can be mapped onto the target type.
+   */
+  bool IsValid() const;
+
+  /**
+   * @brief Get the type of the result of the mapping. This is the target type when extra source
+   * fields are allowed and the part of the target type that is present in the source otherwise.
+   */
+  const AnyType& GetResultType() const;
+
+  const std::vector<FieldMappingStep>& GetSteps() const;
+
+  /**
+   * @brief Check if the given value can be mapped with this plan, i.e. if its type has the same
+   * shape as the source type (see ShapeHash), not taking into account type names.
+   */
+  bool Matches(const AnyValue& src) const;
+
+  /**
+   * @brief Map the source value onto the destination value, which needs to have the result type.
+   *
+   * @throws InvalidConversionException Thrown when the plan is not valid or when a leaf conversion
+   * fails. In the latter case, the destination can be partially updated.
+   */
+  void Execute(AnyValue& dest, const AnyValue& src) const;
+
+private:
+  bool Compile();
+  bool CompileSourceMapping(const AnyType& dest_type, const AnyType& src_type,
+                            std::size_t src_index);
+  bool CompileConversion(const AnyType& dest_type, const AnyType& src_type,
+                         std::size_t src_index);
+  std::size_t ExecuteStep(std::size_t pos, AnyValue& dest, const AnyValue& src) const;
+  AnyType m_src_type;
+  AnyType m_target_type;
+  FieldMappingMode m_mode;
+  AnyType m_result_type;
+  std::vector<FieldMappingStep> m_steps;
+};
+
+/**
+ * @brief Retrieve the (shared) field mapping plan for the type of the given source value and the
+ * given target type from a global cache, compiling it first when it was not yet cached.
+ *
+ * @details The lookup only walks the structure of the source value and does not construct its
+ * AnyType representation, unless the plan needs to be compiled.
+ *
+ * @note This function is thread safe.
+ */
+std::shared_ptr<const FieldMappingPlan> GetFieldMappingPlan(const AnyValue& src,
+                                                            const AnyType& target_type,
+                                                            FieldMappingMode mode);
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_FIELD_MAPPING_PLAN_H_
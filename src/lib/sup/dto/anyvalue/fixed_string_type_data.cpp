@@ -0,0 +1,77 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "fixed_string_type_data.h"
+
+#include <sup/dto/anyvalue_exceptions.h>
+
+namespace sup
+{
+namespace dto
+{
+
+FixedStringTypeData::FixedStringTypeData(std::size_t capacity)
+  : ITypeData{}
+  , m_capacity{capacity}
+{
+  if (m_capacity == 0)
+  {
+    throw InvalidOperationException("Fixed-capacity string type requires a non-zero capacity");
+  }
+}
+
+FixedStringTypeData::~FixedStringTypeData() = default;
+
+TypeCode FixedStringTypeData::GetTypeCode() const
+{
+  return TypeCode::FixedString;
+}
+
+std::string FixedStringTypeData::GetTypeName() const
+{
+  return kFixedStringTypeName;
+}
+
+bool FixedStringTypeData::IsScalar() const
+{
+  return true;
+}
+
+std::size_t FixedStringTypeData::StringCapacity() const
+{
+  return m_capacity;
+}
+
+std::unique_ptr<ITypeData> FixedStringTypeData::CloneFromChildren(
+  std::vector<std::unique_ptr<AnyType>>&&) const
+{
+  return std::make_unique<FixedStringTypeData>(m_capacity);
+}
+
+bool FixedStringTypeData::ShallowEquals(const AnyType& other) const
+{
+  return other.GetTypeCode() == TypeCode::FixedString && other.StringCapacity() == m_capacity;
+}
+
+}  // namespace dto
+
+}  // namespace sup
@@ -0,0 +1,63 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_FIXED_STRING_TYPE_DATA_H_
+#define SUP_DTO_FIXED_STRING_TYPE_DATA_H_
+
+#include <sup/dto/anyvalue/i_type_data.h>
+
+namespace sup
+{
+namespace dto
+{
+class FixedStringTypeData : public ITypeData
+{
+public:
+  explicit FixedStringTypeData(std::size_t capacity);
+  ~FixedStringTypeData() override;
+
+  FixedStringTypeData(const FixedStringTypeData& other) = delete;
+  FixedStringTypeData(FixedStringTypeData&& other) = delete;
+  FixedStringTypeData& operator=(const FixedStringTypeData& other) = delete;
+  FixedStringTypeData& operator=(FixedStringTypeData&& other) = delete;
+
+  TypeCode GetTypeCode() const override;
+  std::string GetTypeName() const override;
+
+  bool IsScalar() const override;
+
+  std::size_t StringCapacity() const override;
+
+  std::unique_ptr<ITypeData> CloneFromChildren(
+    std::vector<std::unique_ptr<AnyType>>&& children) const override;
+
+  bool ShallowEquals(const AnyType& other) const override;
+
+private:
+  std::size_t m_capacity;
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_FIXED_STRING_TYPE_DATA_H_
@@ -0,0 +1,133 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "fixed_string_value_data.h"
+
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace sup
+{
+namespace dto
+{
+
+FixedStringValueData::FixedStringValueData(std::size_t capacity, Constraints constraints)
+  : ScalarValueDataBase{TypeCode::FixedString, constraints}
+  , m_buffer(capacity, '\0')
+  , m_length{0}
+{}
+
+FixedStringValueData::~FixedStringValueData() = default;
+
+const std::string& FixedStringValueData::GetTypeName() const
+{
+  return kFixedStringTypeName;
+}
+
+std::size_t FixedStringValueData::StringCapacity() const
+{
+  return m_buffer.size();
+}
+
+std::string FixedStringValueData::AsString() const
+{
+  return std::string(m_buffer.data(), m_length);
+}
+
+std::unique_ptr<IValueData> FixedStringValueData::CloneFromChildren(
+  std::vector<std::unique_ptr<AnyValue>>&& children, Constraints constraints) const
+{
+  if (!children.empty())
+  {
+    const std::string error =
+      "FixedStringValueData::CloneFromChildren(): Trying to clone scalar value with child values";
+    throw InvalidOperationException(error);
+  }
+  auto result = std::make_unique<FixedStringValueData>(m_buffer.size(), constraints);
+  result->Assign(m_buffer.data(), m_length);
+  return result;
+}
+
+bool FixedStringValueData::ShallowSameType(const IValueData* other) const
+{
+  return other->GetTypeCode() == TypeCode::FixedString &&
+         other->StringCapacity() == m_buffer.size();
+}
+
+bool FixedStringValueData::ScalarEquals(const IValueData* other) const
+{
+  if (other->GetTypeCode() == TypeCode::FixedString)
+  {
+    const auto* other_string = static_cast<const FixedStringValueData*>(other);
+    return m_length == other_string->m_length &&
+           std::equal(m_buffer.data(), m_buffer.data() + m_length, other_string->m_buffer.data());
+  }
+  try
+  {
+    return AsString() == other->AsString();
+  }
+  catch(const MessageException&)
+  {
+    return false;
+  }
+}
+
+void FixedStringValueData::ShallowConvertFrom(const AnyValue& value)
+{
+  const auto str = value.As<std::string>();
+  Assign(str.data(), str.size());
+}
+
+const char8* FixedStringValueData::GetData() const
+{
+  return m_buffer.data();
+}
+
+std::size_t FixedStringValueData::GetLength() const
+{
+  return m_length;
+}
+
+void FixedStringValueData::Assign(const char8* str, std::size_t length)
+{
+  if (length >= m_buffer.size())
+  {
+    throw InvalidConversionException(
+      "FixedStringValueData::Assign(): string does not fit into fixed-capacity string");
+  }
+  // Only clear the part of the tail that was occupied by the previous content
+  if (length < m_length)
+  {
+    std::fill(m_buffer.data() + length, m_buffer.data() + m_length, '\0');
+  }
+  if (length > 0)
+  {
+    std::memmove(m_buffer.data(), str, length);
+  }
+  m_length = length;
+}
+
+}  // namespace dto
+
+}  // namespace sup
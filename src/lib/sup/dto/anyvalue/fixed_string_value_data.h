@@ -0,0 +1,86 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_FIXED_STRING_VALUE_DATA_H_
+#define SUP_DTO_FIXED_STRING_VALUE_DATA_H_
+
+#include <sup/dto/anyvalue/scalar_value_data_base.h>
+
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+
+/**
+ * @brief Value node of a fixed-capacity string.
+ *
+ * @details The character buffer is allocated once at construction and has exactly the capacity of
+ * the type. All bytes after the string's content are kept zero, so that the buffer can be copied
+ * as is to a C char array of the same capacity. Assigning a new string never allocates memory.
+ */
+class FixedStringValueData : public ScalarValueDataBase
+{
+public:
+  FixedStringValueData(std::size_t capacity, Constraints constraints);
+  ~FixedStringValueData() override;
+
+  FixedStringValueData(const FixedStringValueData& other) = delete;
+  FixedStringValueData(FixedStringValueData&& other) = delete;
+  FixedStringValueData& operator=(const FixedStringValueData& other) = delete;
+  FixedStringValueData& operator=(FixedStringValueData&& other) = delete;
+
+  const std::string& GetTypeName() const override;
+
+  std::size_t StringCapacity() const override;
+
+  std::string AsString() const override;
+
+  std::unique_ptr<IValueData> CloneFromChildren(std::vector<std::unique_ptr<AnyValue>>&& children,
+                                                Constraints constraints) const override;
+  bool ShallowSameType(const IValueData* other) const override;
+  bool ScalarEquals(const IValueData* other) const override;
+  void ShallowConvertFrom(const AnyValue& value) override;
+
+  // Direct access to the buffer, used by compiled conversion plans, C layouts and bindings
+  const char8* GetData() const;
+  std::size_t GetLength() const;
+
+  /**
+   * @brief Replace the content of the string.
+   *
+   * @throws InvalidConversionException Thrown when the string does not fit into the buffer,
+   * including its terminating null character.
+   */
+  void Assign(const char8* str, std::size_t length);
+
+private:
+  std::vector<char8> m_buffer;
+  std::size_t m_length;
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_FIXED_STRING_VALUE_DATA_H_
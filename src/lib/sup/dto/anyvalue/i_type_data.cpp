@@ -51,6 +51,11 @@ std::size_t ITypeData::NumberOfMembers() const
   return 0u;
 }
 
+const std::string& ITypeData::GetMemberName(std::size_t) const
+{
+  throw InvalidOperationException("This type does not support members");
+}
+
 AnyType ITypeData::ElementType() const
 {
   throw InvalidOperationException("Element type only supported for array types");
@@ -61,6 +66,11 @@ std::size_t ITypeData::NumberOfElements() const
   return 0u;
 }
 
+std::size_t ITypeData::StringCapacity() const
+{
+  return 0u;
+}
+
 std::size_t ITypeData::NumberOfChildren() const
 {
   return 0u;
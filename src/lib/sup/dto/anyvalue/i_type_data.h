@@ -49,9 +49,11 @@ public:
   virtual void AddMember(const std::string&, AnyType&&);
   virtual std::vector<std::string> MemberNames() const;
   virtual std::size_t NumberOfMembers() const;
+  virtual const std::string& GetMemberName(std::size_t idx) const;
 
   virtual AnyType ElementType() const;
   virtual std::size_t NumberOfElements() const;
+  virtual std::size_t StringCapacity() const;
 
   virtual std::size_t NumberOfChildren() const;
   virtual bool HasChild(const std::string& child_name) const;
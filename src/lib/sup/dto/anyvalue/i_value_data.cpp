@@ -57,6 +57,11 @@ std::size_t IValueData::NumberOfMembers() const
   return 0u;
 }
 
+const std::string& IValueData::GetMemberName(std::size_t) const
+{
+  throw InvalidOperationException("This value does not support members");
+}
+
 void IValueData::AddElement(std::unique_ptr<AnyValue>&&)
 {
   throw InvalidOperationException("Add element only supported for array types");
@@ -162,6 +167,16 @@ AnyValue* IValueData::GetChildValue(std::size_t)
   throw InvalidOperationException("This value does not support members or elements");
 }
 
+std::size_t IValueData::StringCapacity() const
+{
+  return 0u;
+}
+
+bool IValueData::ShallowSameType(const IValueData* other) const
+{
+  return other->GetTypeCode() == GetTypeCode();
+}
+
 bool IValueData::ScalarEquals(const IValueData*) const
 {
   return false;
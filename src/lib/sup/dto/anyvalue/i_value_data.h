@@ -47,7 +47,7 @@ public:
   IValueData& operator=(IValueData&&) = delete;
 
   virtual TypeCode GetTypeCode() const = 0;
-  virtual std::string GetTypeName() const = 0;
+  virtual const std::string& GetTypeName() const = 0;
 
   // Faster way to assess if a an AnyValue is scalar
   virtual bool IsScalar() const;
@@ -58,9 +58,11 @@ public:
   virtual void AddMember(const std::string&, std::unique_ptr<AnyValue>&&);
   virtual std::vector<std::string> MemberNames() const;
   virtual std::size_t NumberOfMembers() const;
+  virtual const std::string& GetMemberName(std::size_t idx) const;
   virtual void AddElement(std::unique_ptr<AnyValue>&&);
   virtual std::size_t NumberOfElements() const;
   virtual AnyType ElementType() const;
+  virtual std::size_t StringCapacity() const;
 
   virtual boolean AsBoolean() const;
   virtual char8 AsCharacter8() const;
@@ -85,6 +87,10 @@ public:
   virtual std::unique_ptr<IValueData> CloneFromChildren(
     std::vector<std::unique_ptr<AnyValue>>&& children, Constraints constraints) const = 0;
   virtual bool ShallowEquals(const IValueData* other) const = 0;
+
+  // Check if the other node has the same type, not taking into account the types of its children
+  // (except for the element type of empty arrays). This check does not allocate memory.
+  virtual bool ShallowSameType(const IValueData* other) const;
   virtual bool ScalarEquals(const IValueData* other) const;
   virtual void ShallowConvertFrom(const AnyValue&);
 };
@@ -0,0 +1,234 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "leaf_payload_access.h"
+
+#include <sup/dto/anyvalue/fixed_string_value_data.h>
+#include <sup/dto/anyvalue/scalar_value_data_t.h>
+
+#include <cstring>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+template <typename T>
+T& Payload(IValueData& value_data, TypeCode type_code);
+
+template <typename T>
+const T& Payload(const IValueData& value_data, TypeCode type_code);
+}  // unnamed namespace
+
+void LeafPayloadAccess::Store(AnyValue& leaf, boolean val)
+{
+  Payload<boolean>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, char8 val)
+{
+  Payload<char8>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, int8 val)
+{
+  Payload<int8>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, uint8 val)
+{
+  Payload<uint8>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, int16 val)
+{
+  Payload<int16>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, uint16 val)
+{
+  Payload<uint16>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, int32 val)
+{
+  Payload<int32>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, uint32 val)
+{
+  Payload<uint32>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, int64 val)
+{
+  Payload<int64>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, uint64 val)
+{
+  Payload<uint64>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, float32 val)
+{
+  Payload<float32>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::Store(AnyValue& leaf, float64 val)
+{
+  Payload<float64>(*leaf.m_data, leaf.GetTypeCode()) = val;
+}
+
+void LeafPayloadAccess::StoreString(AnyValue& leaf, const char8* str, std::size_t capacity)
+{
+  if (leaf.GetTypeCode() == TypeCode::FixedString)
+  {
+    // Throws when the string does not fit in the leaf's own capacity
+    static_cast<FixedStringValueData&>(*leaf.m_data).Assign(str, strnlen(str, capacity));
+    return;
+  }
+  auto& payload = Payload<std::string>(*leaf.m_data, leaf.GetTypeCode());
+  // Assignment reuses the capacity of the payload
+  (void)payload.assign(str, strnlen(str, capacity));
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, boolean& val)
+{
+  val = Payload<boolean>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, char8& val)
+{
+  val = Payload<char8>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, int8& val)
+{
+  val = Payload<int8>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, uint8& val)
+{
+  val = Payload<uint8>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, int16& val)
+{
+  val = Payload<int16>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, uint16& val)
+{
+  val = Payload<uint16>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, int32& val)
+{
+  val = Payload<int32>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, uint32& val)
+{
+  val = Payload<uint32>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, int64& val)
+{
+  val = Payload<int64>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, uint64& val)
+{
+  val = Payload<uint64>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, float32& val)
+{
+  val = Payload<float32>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::Load(const AnyValue& leaf, float64& val)
+{
+  val = Payload<float64>(*leaf.m_data, leaf.GetTypeCode());
+}
+
+void LeafPayloadAccess::LoadString(const AnyValue& leaf, char8* str, std::size_t capacity)
+{
+  const char8* data = nullptr;
+  std::size_t size = 0;
+  if (leaf.GetTypeCode() == TypeCode::FixedString)
+  {
+    const auto& fixed_string = static_cast<const FixedStringValueData&>(*leaf.m_data);
+    data = fixed_string.GetData();
+    size = fixed_string.GetLength();
+  }
+  else
+  {
+    const auto& payload = Payload<std::string>(*leaf.m_data, leaf.GetTypeCode());
+    data = payload.data();
+    size = payload.size();
+  }
+  if (size >= capacity)
+  {
+    throw InvalidConversionException("String doesn't fit in char array");
+  }
+  (void)std::memcpy(str, data, size);
+  (void)std::memset(str + size, 0, capacity - size);
+}
+
+std::size_t LeafPayloadAccess::StringLength(const AnyValue& leaf)
+{
+  if (leaf.GetTypeCode() == TypeCode::FixedString)
+  {
+    return static_cast<const FixedStringValueData&>(*leaf.m_data).GetLength();
+  }
+  return Payload<std::string>(*leaf.m_data, leaf.GetTypeCode()).size();
+}
+
+namespace
+{
+template <typename T>
+T& Payload(IValueData& value_data, TypeCode type_code)
+{
+  if (type_code != TypeToCode<T>::code)
+  {
+    throw InvalidConversionException("Value doesn't match the type of the AnyValue leaf");
+  }
+  return static_cast<ScalarValueDataT<T>&>(value_data).GetValue();
+}
+
+template <typename T>
+const T& Payload(const IValueData& value_data, TypeCode type_code)
+{
+  if (type_code != TypeToCode<T>::code)
+  {
+    throw InvalidConversionException("Value doesn't match the type of the AnyValue leaf");
+  }
+  return static_cast<const ScalarValueDataT<T>&>(value_data).GetValue();
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
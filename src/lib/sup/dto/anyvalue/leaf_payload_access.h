@@ -0,0 +1,99 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_LEAF_PAYLOAD_ACCESS_H_
+#define SUP_DTO_LEAF_PAYLOAD_ACCESS_H_
+
+#include <sup/dto/anyvalue.h>
+
+namespace sup
+{
+namespace dto
+{
+
+/**
+ * @brief Direct access to the payload of scalar leaves of AnyValues, without going through the
+ * type conversions of AnyValue assignment and casting.
+ *
+ * @details This is the common building block of the byte level kernels, the record decoders and
+ * the struct bindings. All functions throw InvalidConversionException when the leaf does not have
+ * the exact scalar type of the C++ value.
+ */
+class LeafPayloadAccess
+{
+public:
+  static void Store(AnyValue& leaf, boolean val);
+  static void Store(AnyValue& leaf, char8 val);
+  static void Store(AnyValue& leaf, int8 val);
+  static void Store(AnyValue& leaf, uint8 val);
+  static void Store(AnyValue& leaf, int16 val);
+  static void Store(AnyValue& leaf, uint16 val);
+  static void Store(AnyValue& leaf, int32 val);
+  static void Store(AnyValue& leaf, uint32 val);
+  static void Store(AnyValue& leaf, int64 val);
+  static void Store(AnyValue& leaf, uint64 val);
+  static void Store(AnyValue& leaf, float32 val);
+  static void Store(AnyValue& leaf, float64 val);
+
+  /**
+   * @brief Store a zero-terminated string from a char array with the given capacity.
+   *
+   * @note Fixed-capacity string leaves are updated in place without allocating memory.
+   *
+   * @throws InvalidConversionException Thrown when the leaf is a fixed-capacity string that cannot
+   * hold the string.
+   */
+  static void StoreString(AnyValue& leaf, const char8* str, std::size_t capacity);
+
+  static void Load(const AnyValue& leaf, boolean& val);
+  static void Load(const AnyValue& leaf, char8& val);
+  static void Load(const AnyValue& leaf, int8& val);
+  static void Load(const AnyValue& leaf, uint8& val);
+  static void Load(const AnyValue& leaf, int16& val);
+  static void Load(const AnyValue& leaf, uint16& val);
+  static void Load(const AnyValue& leaf, int32& val);
+  static void Load(const AnyValue& leaf, uint32& val);
+  static void Load(const AnyValue& leaf, int64& val);
+  static void Load(const AnyValue& leaf, uint64& val);
+  static void Load(const AnyValue& leaf, float32& val);
+  static void Load(const AnyValue& leaf, float64& val);
+
+  /**
+   * @brief Load a string into a char array with the given capacity. The remaining characters are
+   * set to zero.
+   *
+   * @throws InvalidConversionException Also thrown when the string and its terminating zero do not
+   * fit in the array.
+   */
+  static void LoadString(const AnyValue& leaf, char8* str, std::size_t capacity);
+
+  /**
+   * @brief Get the length of a string leaf, without copying the string.
+   */
+  static std::size_t StringLength(const AnyValue& leaf);
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_LEAF_PAYLOAD_ACCESS_H_
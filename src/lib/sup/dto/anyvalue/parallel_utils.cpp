@@ -0,0 +1,69 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "parallel_utils.h"
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/thread_pool.h>
+
+#include <algorithm>
+
+namespace sup
+{
+namespace dto
+{
+namespace utils
+{
+namespace
+{
+// Number of chunks per thread, to balance items with different processing times:
+const std::size_t kChunksPerThread = 4;
+}  // unnamed namespace
+
+bool IsParallelArray(const AnyValue& anyvalue)
+{
+  return IsArrayValue(anyvalue) && anyvalue.NumberOfElements() >= kMinParallelElements;
+}
+
+std::size_t NumberOfChunks(const ThreadPool& thread_pool, std::size_t n_items)
+{
+  return std::min(n_items, thread_pool.NumberOfThreads() * kChunksPerThread);
+}
+
+void ParallelForChunks(
+  ThreadPool& thread_pool, std::size_t n_items,
+  const std::function<void(std::size_t, std::size_t, std::size_t)>& chunk_task)
+{
+  const auto n_chunks = NumberOfChunks(thread_pool, n_items);
+  auto run_chunk = [n_items, n_chunks, &chunk_task](std::size_t chunk_idx) {
+    const auto first = (chunk_idx * n_items) / n_chunks;
+    const auto last = ((chunk_idx + 1) * n_items) / n_chunks;
+    chunk_task(chunk_idx, first, last);
+  };
+  thread_pool.ParallelFor(n_chunks, run_chunk);
+}
+
+}  // namespace utils
+
+}  // namespace dto
+
+}  // namespace sup
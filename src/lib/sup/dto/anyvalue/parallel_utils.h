@@ -0,0 +1,70 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_PARALLEL_UTILS_H_
+#define SUP_DTO_PARALLEL_UTILS_H_
+
+#include <cstddef>
+#include <functional>
+
+namespace sup
+{
+namespace dto
+{
+class AnyValue;
+class ThreadPool;
+
+namespace utils
+{
+// Arrays with fewer elements are not worth the overhead of distributing them over the threads:
+const std::size_t kMinParallelElements = 64;
+
+/**
+ * @brief Check if the elements of the given value should be processed in parallel, i.e. if it is
+ * an array with at least kMinParallelElements elements.
+ */
+bool IsParallelArray(const AnyValue& anyvalue);
+
+/**
+ * @brief Get the number of chunks ParallelForChunks will use for the given number of items. This is
+ * a small multiple of the number of threads, to balance items with different processing times.
+ */
+std::size_t NumberOfChunks(const ThreadPool& thread_pool, std::size_t n_items);
+
+/**
+ * @brief Split the range [0, n_items) into contiguous chunks and call
+ * chunk_task(chunk_idx, first, last) for each of them on the threads of the pool. Chunks with a
+ * higher index contain items with a higher index, so per-chunk results can be combined in order.
+ *
+ * @throws Rethrows the first exception thrown by any of the chunk tasks.
+ */
+void ParallelForChunks(
+  ThreadPool& thread_pool, std::size_t n_items,
+  const std::function<void(std::size_t, std::size_t, std::size_t)>& chunk_task);
+
+}  // namespace utils
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_PARALLEL_UTILS_H_
@@ -77,6 +77,10 @@ std::unique_ptr<ITypeData> CreateScalarData(TypeCode type_code)
   {
     throw InvalidOperationException("Not a known scalar type code");
   }
+  if (type_code == TypeCode::FixedString)
+  {
+    throw InvalidOperationException("Fixed-capacity string types require a capacity");
+  }
   return std::make_unique<ScalarTypeData>(type_code);
 }
 
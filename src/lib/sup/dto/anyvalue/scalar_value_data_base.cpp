@@ -41,6 +41,8 @@ std::unique_ptr<IValueData> ScalarValueConstructor(Constraints constraints)
   return std::make_unique<ScalarValueDataT<T>>(T{}, constraints);
 }
 
+// Name of a scalar type as a reference into the static scalar type definitions:
+const std::string& ScalarTypeName(TypeCode type_code);
 }  // unnamed namespace
 
 ScalarValueDataBase::ScalarValueDataBase(TypeCode type_code, Constraints constraints)
@@ -56,9 +58,9 @@ TypeCode ScalarValueDataBase::GetTypeCode() const
   return m_type_code;
 }
 
-std::string ScalarValueDataBase::GetTypeName() const
+const std::string& ScalarValueDataBase::GetTypeName() const
 {
-  return AnyType{m_type_code}.GetTypeName();
+  return ScalarTypeName(m_type_code);
 }
 
 bool ScalarValueDataBase::IsScalar() const
@@ -102,6 +104,21 @@ std::unique_ptr<IValueData> CreateScalarValueData(TypeCode type_code, Constraint
   return it->second(constraints);
 }
 
+namespace
+{
+const std::string& ScalarTypeName(TypeCode type_code)
+{
+  for (const auto& [scalar_code, scalar_name] : ScalarTypeDefinitions())
+  {
+    if (scalar_code == type_code)
+    {
+      return scalar_name;
+    }
+  }
+  throw InvalidOperationException("Not a known scalar type code");
+}
+}  // unnamed namespace
+
 }  // namespace dto
 
 }  // namespace sup
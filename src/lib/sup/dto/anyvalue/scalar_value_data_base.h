@@ -40,7 +40,7 @@ public:
   ScalarValueDataBase& operator=(ScalarValueDataBase&&) = delete;
 
   TypeCode GetTypeCode() const override;
-  std::string GetTypeName() const override;
+  const std::string& GetTypeName() const override;
 
   bool IsScalar() const override;
 
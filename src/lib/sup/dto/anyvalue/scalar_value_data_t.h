@@ -63,6 +63,10 @@ public:
   bool ScalarEquals(const IValueData* other) const override;
   void ShallowConvertFrom(const AnyValue& value) override;
 
+  // Direct access to the payload, used by compiled conversion plans
+  T& GetValue();
+  const T& GetValue() const;
+
 private:
   T m_value;
 };
@@ -188,6 +192,18 @@ void ScalarValueDataT<T>::ShallowConvertFrom(const AnyValue& value)
   m_value = value.As<T>();
 }
 
+template <typename T>
+T& ScalarValueDataT<T>::GetValue()
+{
+  return m_value;
+}
+
+template <typename T>
+const T& ScalarValueDataT<T>::GetValue() const
+{
+  return m_value;
+}
+
 }  // namespace dto
 
 }  // namespace sup
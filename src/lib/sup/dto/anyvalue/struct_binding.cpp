@@ -0,0 +1,164 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/struct_binding.h>
+
+#include <sup/dto/anyvalue/leaf_payload_access.h>
+
+namespace sup
+{
+namespace dto
+{
+
+void BoundLeafAccess::Store(AnyValue& leaf, boolean val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, char8 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, int8 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, uint8 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, int16 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, uint16 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, int32 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, uint32 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, int64 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, uint64 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, float32 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::Store(AnyValue& leaf, float64 val)
+{
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void BoundLeafAccess::StoreString(AnyValue& leaf, const char8* str, std::size_t capacity)
+{
+  LeafPayloadAccess::StoreString(leaf, str, capacity);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, boolean& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, char8& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, int8& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, uint8& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, int16& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, uint16& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, int32& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, uint32& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, int64& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, uint64& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, float32& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::Load(const AnyValue& leaf, float64& val)
+{
+  LeafPayloadAccess::Load(leaf, val);
+}
+
+void BoundLeafAccess::LoadString(const AnyValue& leaf, char8* str, std::size_t capacity)
+{
+  LeafPayloadAccess::LoadString(leaf, str, capacity);
+}
+
+}  // namespace dto
+
+}  // namespace sup
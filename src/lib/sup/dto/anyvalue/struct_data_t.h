@@ -52,11 +52,12 @@ public:
   StructDataT& operator=(StructDataT&& other) = delete;
 
   static TypeCode GetTypeCode();
-  std::string GetTypeName() const;
+  const std::string& GetTypeName() const;
 
   void AddMember(const std::string& name, std::unique_ptr<T>&& val);
   std::vector<std::string> MemberNames() const;
   std::size_t NumberOfMembers() const;
+  const std::string& GetMemberName(std::size_t idx) const;
 
   bool HasChild(const std::string& child_name) const;
   T* GetChild(const std::string& child_name);
@@ -82,7 +83,7 @@ TypeCode StructDataT<T>::GetTypeCode()
 }
 
 template <typename T>
-std::string StructDataT<T>::GetTypeName() const
+const std::string& StructDataT<T>::GetTypeName() const
 {
   return m_name;
 }
@@ -110,6 +111,17 @@ std::size_t StructDataT<T>::NumberOfMembers() const
   return m_members.size();
 }
 
+template <typename T>
+const std::string& StructDataT<T>::GetMemberName(std::size_t idx) const
+{
+  if (idx >= m_members.size())
+  {
+    const std::string error = "StructDataT::GetMemberName(): index out of bounds";
+    throw InvalidOperationException(error);
+  }
+  return m_members[idx].first;
+}
+
 template <typename T>
 bool StructDataT<T>::HasChild(const std::string& child_name) const
 {
@@ -65,6 +65,11 @@ std::size_t StructTypeData::NumberOfMembers() const
   return m_member_data.NumberOfMembers();
 }
 
+const std::string& StructTypeData::GetMemberName(std::size_t idx) const
+{
+  return m_member_data.GetMemberName(idx);
+}
+
 std::size_t StructTypeData::NumberOfChildren() const
 {
   return m_member_data.NumberOfMembers();
@@ -49,6 +49,7 @@ public:
   void AddMember(const std::string& name, AnyType&& type) override;
   std::vector<std::string> MemberNames() const override;
   std::size_t NumberOfMembers() const override;
+  const std::string& GetMemberName(std::size_t idx) const override;
 
   std::size_t NumberOfChildren() const override;
   bool HasChild(const std::string& child_name) const override;
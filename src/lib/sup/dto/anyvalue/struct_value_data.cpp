@@ -42,7 +42,7 @@ TypeCode StructValueData::GetTypeCode() const
   return m_member_data.GetTypeCode();
 }
 
-std::string StructValueData::GetTypeName() const
+const std::string& StructValueData::GetTypeName() const
 {
   return m_member_data.GetTypeName();
 }
@@ -72,6 +72,11 @@ std::size_t StructValueData::NumberOfMembers() const
   return m_member_data.NumberOfMembers();
 }
 
+const std::string& StructValueData::GetMemberName(std::size_t idx) const
+{
+  return m_member_data.GetMemberName(idx);
+}
+
 std::size_t StructValueData::NumberOfChildren() const
 {
   return m_member_data.NumberOfMembers();
@@ -122,6 +127,32 @@ bool StructValueData::ShallowEquals(const IValueData* other) const
   return true;
 }
 
+bool StructValueData::ShallowSameType(const IValueData* other) const
+{
+  if (!IsStructTypeCode(other->GetTypeCode()))
+  {
+    return false;
+  }
+  const auto& other_member_data = static_cast<const StructValueData*>(other)->m_member_data;
+  if (other_member_data.GetTypeName() != m_member_data.GetTypeName())
+  {
+    return false;
+  }
+  const auto n_members = m_member_data.NumberOfMembers();
+  if (other_member_data.NumberOfMembers() != n_members)
+  {
+    return false;
+  }
+  for (std::size_t idx = 0; idx < n_members; ++idx)
+  {
+    if (other_member_data.GetMemberName(idx) != m_member_data.GetMemberName(idx))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 void StructValueData::ShallowConvertFrom(const AnyValue& value)
 {
   if (value.GetTypeCode() != TypeCode::Struct)
@@ -44,13 +44,14 @@ public:
   StructValueData& operator=(StructValueData&& other) = delete;
 
   TypeCode GetTypeCode() const override;
-  std::string GetTypeName() const override;
+  const std::string& GetTypeName() const override;
 
   Constraints GetConstraints() const override;
 
   void AddMember(const std::string& name, std::unique_ptr<AnyValue>&& value) override;
   std::vector<std::string> MemberNames() const override;
   std::size_t NumberOfMembers() const override;
+  const std::string& GetMemberName(std::size_t idx) const override;
 
   std::size_t NumberOfChildren() const override;
   bool HasChild(const std::string& child_name) const override;
@@ -59,6 +60,7 @@ public:
   std::unique_ptr<IValueData> CloneFromChildren(std::vector<std::unique_ptr<AnyValue>>&& children,
                                                 Constraints constraints) const override;
   bool ShallowEquals(const IValueData* other) const override;
+  bool ShallowSameType(const IValueData* other) const override;
   void ShallowConvertFrom(const AnyValue& value) override;
 
 private:
@@ -0,0 +1,202 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/thread_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+// Shared state of a single ParallelFor call. It is kept alive by the queued runner tasks, since
+// these may only get scheduled after the call itself has returned.
+struct ParallelForState
+{
+  ParallelForState(std::size_t n_tasks_, const std::function<void(std::size_t)>& task_);
+
+  void Run();
+
+  const std::size_t n_tasks;
+  const std::function<void(std::size_t)>& task;
+  std::atomic<std::size_t> next_index;
+  std::atomic<bool> cancelled;
+  std::size_t n_finished;
+  std::exception_ptr error;
+  std::mutex mtx;
+  std::condition_variable cv;
+};
+
+std::size_t DefaultNumberOfThreads();
+}  // unnamed namespace
+
+ThreadPool::ThreadPool(std::size_t n_threads)
+  : m_threads{}
+  , m_tasks{}
+  , m_mtx{}
+  , m_cv{}
+  , m_halt{false}
+{
+  const auto n_workers = (n_threads == 0) ? DefaultNumberOfThreads() : n_threads;
+  m_threads.reserve(n_workers);
+  for (std::size_t idx = 0; idx < n_workers; ++idx)
+  {
+    (void)m_threads.emplace_back(&ThreadPool::WorkerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    const std::lock_guard<std::mutex> lk{m_mtx};
+    m_halt = true;
+  }
+  m_cv.notify_all();
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+std::size_t ThreadPool::NumberOfThreads() const
+{
+  return m_threads.size();
+}
+
+void ThreadPool::Submit(std::function<void()> task)
+{
+  {
+    const std::lock_guard<std::mutex> lk{m_mtx};
+    m_tasks.push_back(std::move(task));
+  }
+  m_cv.notify_one();
+}
+
+void ThreadPool::ParallelFor(std::size_t n_tasks, const std::function<void(std::size_t)>& task)
+{
+  if (n_tasks == 0)
+  {
+    return;
+  }
+  auto state = std::make_shared<ParallelForState>(n_tasks, task);
+  const auto n_runners = std::min(n_tasks - 1, NumberOfThreads());
+  for (std::size_t idx = 0; idx < n_runners; ++idx)
+  {
+    Submit([state](){ state->Run(); });
+  }
+  state->Run();
+  std::unique_lock<std::mutex> lk{state->mtx};
+  state->cv.wait(lk, [&state](){ return state->n_finished == state->n_tasks; });
+  if (state->error)
+  {
+    std::rethrow_exception(state->error);
+  }
+}
+
+void ThreadPool::WorkerLoop()
+{
+  while (true)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lk{m_mtx};
+      m_cv.wait(lk, [this](){ return m_halt || !m_tasks.empty(); });
+      if (m_tasks.empty())
+      {
+        return;
+      }
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+    try
+    {
+      task();
+    }
+    catch(...)
+    {
+      // Exceptions are not propagated from asynchronous tasks
+    }
+  }
+}
+
+namespace
+{
+ParallelForState::ParallelForState(std::size_t n_tasks_,
+                                   const std::function<void(std::size_t)>& task_)
+  : n_tasks{n_tasks_}
+  , task{task_}
+  , next_index{0}
+  , cancelled{false}
+  , n_finished{0}
+  , error{}
+  , mtx{}
+  , cv{}
+{}
+
+void ParallelForState::Run()
+{
+  // Every index is claimed exactly once and counted as finished, even when it is skipped due to
+  // cancellation. The task reference is only used for claimed indices, i.e. while the caller of
+  // ParallelFor is still waiting.
+  for (auto idx = next_index++; idx < n_tasks; idx = next_index++)
+  {
+    std::exception_ptr task_error;
+    if (!cancelled)
+    {
+      try
+      {
+        task(idx);
+      }
+      catch(...)
+      {
+        task_error = std::current_exception();
+        cancelled = true;
+      }
+    }
+    const std::lock_guard<std::mutex> lk{mtx};
+    if (task_error && !error)
+    {
+      error = task_error;
+    }
+    if (++n_finished == n_tasks)
+    {
+      cv.notify_all();
+    }
+  }
+}
+
+std::size_t DefaultNumberOfThreads()
+{
+  const auto n_hardware = std::thread::hardware_concurrency();
+  return (n_hardware == 0) ? 1u : static_cast<std::size_t>(n_hardware);
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
@@ -35,6 +35,7 @@ namespace dto
 class AnyValue;
 class AnyType;
 class AnyTypeRegistry;
+class ThreadPool;
 
 /**
  * @brief Try to convert an AnyValue to another AnyValue.
@@ -147,6 +148,21 @@ std::string ValuesToJSONString(const AnyValue& anyvalue, bool pretty);
  */
 std::string ValuesToJSONString(const AnyValue& anyvalue);
 
+/**
+ * @brief Serialize the values of an AnyValue using a JSON serializer (without pretty printing),
+ * serializing the elements of large arrays in parallel.
+ *
+ * @details The elements of arrays with many elements are serialized in chunks by the threads of
+ * the pool and the chunks are concatenated in order, so the result is identical to
+ * ValuesToJSONString(anyvalue).
+ *
+ * @param anyvalue AnyValue object to serialize.
+ * @param thread_pool Thread pool to use.
+ *
+ * @return JSON string.
+ */
+std::string ValuesToJSONString(const AnyValue& anyvalue, ThreadPool& thread_pool);
+
 /**
  * @brief Serialize an AnyValue to a JSON string.
  *
@@ -0,0 +1,274 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_ANYVALUE_LEAVES_H_
+#define SUP_DTO_ANYVALUE_LEAVES_H_
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+
+/**
+ * @brief Single step in the path from the root of an AnyValue to one of its leaves.
+ */
+struct LeafPathComponent
+{
+  // Name of the member or nullptr for an array element.
+  const std::string* member_name;
+  // Index of the member or array element.
+  std::size_t index;
+};
+
+/**
+ * @brief Non-owning view on the path components from the root of an AnyValue to one of its leaves.
+ *
+ * @details The view is only valid as long as the object it was obtained from (leaf iterator or
+ * leaf index) and the AnyValue/AnyType it refers to are not modified or destroyed.
+ */
+class LeafPath
+{
+public:
+  LeafPath(const LeafPathComponent* components, std::size_t size);
+
+  std::size_t size() const;
+  bool empty() const;
+  const LeafPathComponent& operator[](std::size_t idx) const;
+  const LeafPathComponent* begin() const;
+  const LeafPathComponent* end() const;
+
+  /**
+   * @brief Build the fieldname of the leaf, e.g. "a.b[2].c". This is the only method that
+   * allocates memory.
+   *
+   * @return Fieldname that can be used to access the leaf with AnyValue::operator[].
+   */
+  std::string ToString() const;
+
+private:
+  const LeafPathComponent* m_components;
+  std::size_t m_size;
+};
+
+/**
+ * @brief Leaf of an AnyValue, as produced by the leaf iterator.
+ */
+template <typename T>
+struct LeafT
+{
+  // Position of the leaf in depth-first order.
+  std::size_t ordinal;
+  LeafPath path;
+  T& value;
+};
+
+/**
+ * @brief Forward iterator over the scalar leaves of an AnyValue, in depth-first order.
+ *
+ * @details The iterator keeps its own stack of ancestor nodes and path components, so that
+ * iterating does not allocate memory, unless the value is nested deeper than kInlineDepth levels.
+ * Empty values, empty arrays and structures are skipped, since they do not contain scalar leaves.
+ * The iterator dereferences to a LeafT proxy object. The path of that proxy is only valid until
+ * the iterator is incremented.
+ */
+template <typename T>
+class LeafIteratorT
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = LeafT<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = LeafT<T>;
+
+  static const std::size_t kInlineDepth = 32;
+
+  /**
+   * @brief Construct an end iterator.
+   */
+  LeafIteratorT();
+
+  /**
+   * @brief Construct an iterator pointing to the first leaf of the given value.
+   */
+  explicit LeafIteratorT(T& root);
+
+  LeafIteratorT(const LeafIteratorT& other) = default;
+  LeafIteratorT& operator=(const LeafIteratorT& other) = default;
+
+  reference operator*() const;
+  LeafIteratorT& operator++();
+  LeafIteratorT operator++(int);
+
+  bool operator==(const LeafIteratorT& other) const;
+  bool operator!=(const LeafIteratorT& other) const;
+
+private:
+  void Push(std::size_t idx);
+  void SetChild(std::size_t idx);
+  bool Next();
+  void Settle();
+  T* GetNode(std::size_t level) const;
+  void SetNode(std::size_t level, T* node);
+  LeafPathComponent& ComponentAt(std::size_t level);
+  const LeafPathComponent* PathData() const;
+  T* m_inline_nodes[kInlineDepth];
+  LeafPathComponent m_inline_path[kInlineDepth];
+  std::vector<T*> m_overflow_nodes;
+  std::vector<LeafPathComponent> m_overflow_path;
+  std::size_t m_depth;
+  std::size_t m_ordinal;
+  bool m_end;
+};
+
+/**
+ * @brief Range over the scalar leaves of an AnyValue, for use in range-based for loops.
+ */
+template <typename T>
+class LeafRangeT
+{
+public:
+  explicit LeafRangeT(T& root);
+
+  LeafIteratorT<T> begin() const;
+  LeafIteratorT<T> end() const;
+
+private:
+  T& m_root;
+};
+
+using Leaf = LeafT<AnyValue>;
+using ConstLeaf = LeafT<const AnyValue>;
+using LeafIterator = LeafIteratorT<AnyValue>;
+using ConstLeafIterator = LeafIteratorT<const AnyValue>;
+
+/**
+ * @brief Get a range over the scalar leaves of the given value.
+ *
+ * @param anyvalue Value to iterate over. It must outlive the range and its iterators and its
+ * structure may not be changed while iterating. Leaf values can be assigned to, but not replaced
+ * by values of a different type.
+ */
+LeafRangeT<AnyValue> Leaves(AnyValue& anyvalue);
+LeafRangeT<const AnyValue> Leaves(const AnyValue& anyvalue);
+
+/**
+ * @brief Precomputed flat index of the scalar leaves of an AnyType.
+ *
+ * @details The index lists all scalar leaves of the type in depth-first order, together with their
+ * paths and type codes. The k-th leaf of any value of that type can then be accessed directly,
+ * without visiting the preceding leaves: the cost only depends on the nesting depth of the leaf,
+ * not on the size of the value.
+ */
+class LeafIndex
+{
+public:
+  /**
+   * @brief Construct the leaf index for the given type.
+   *
+   * @param anytype Type to index.
+   *
+   * @throws InvalidOperationException when the type contains unbounded arrays, since values of
+   * such types do not have a fixed number of leaves.
+   */
+  explicit LeafIndex(const AnyType& anytype);
+  ~LeafIndex();
+
+  LeafIndex(const LeafIndex& other) = delete;
+  LeafIndex(LeafIndex&& other) = delete;
+  LeafIndex& operator=(const LeafIndex& other) = delete;
+  LeafIndex& operator=(LeafIndex&& other) = delete;
+
+  /**
+   * @brief Get the indexed type.
+   */
+  const AnyType& GetType() const;
+
+  /**
+   * @brief Get the number of scalar leaves.
+   */
+  std::size_t NumberOfLeaves() const;
+
+  /**
+   * @brief Get the path of the leaf with the given ordinal.
+   *
+   * @throws InvalidOperationException when the ordinal is out of bounds.
+   */
+  LeafPath GetLeafPath(std::size_t ordinal) const;
+
+  /**
+   * @brief Get the type code of the leaf with the given ordinal.
+   *
+   * @throws InvalidOperationException when the ordinal is out of bounds.
+   */
+  TypeCode GetLeafTypeCode(std::size_t ordinal) const;
+
+  /**
+   * @brief Get the type of the leaf with the given ordinal.
+   *
+   * @throws InvalidOperationException when the ordinal is out of bounds.
+   */
+  const AnyType& GetLeafType(std::size_t ordinal) const;
+
+  /**
+   * @brief Get the leaf with the given ordinal from a value of the indexed type.
+   *
+   * @param anyvalue Value of the indexed type.
+   * @param ordinal Ordinal of the leaf.
+   * @return Leaf value.
+   *
+   * @throws InvalidOperationException when the ordinal is out of bounds or when the value does not
+   * have the structure of the indexed type.
+   */
+  AnyValue& GetLeaf(AnyValue& anyvalue, std::size_t ordinal) const;
+  const AnyValue& GetLeaf(const AnyValue& anyvalue, std::size_t ordinal) const;
+
+private:
+  struct LeafEntry
+  {
+    std::size_t path_offset;
+    std::size_t path_size;
+    TypeCode type_code;
+    const AnyType* type;
+  };
+  void AddLeaves(const AnyType& anytype, std::vector<LeafPathComponent>& path);
+  const LeafEntry& GetEntry(std::size_t ordinal) const;
+  // Member name pointers in m_components and leaf type pointers in m_leaves point into m_anytype,
+  // hence the deleted copy/move
+  const AnyType m_anytype;
+  std::vector<LeafPathComponent> m_components;
+  std::vector<LeafEntry> m_leaves;
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_ANYVALUE_LEAVES_H_
@@ -74,6 +74,20 @@ bool Increment(AnyValue& value);
 */
 bool Decrement(AnyValue& value);
 
+/**
+ * @brief Structural hash function.
+ *
+ * @details The hash covers the structure (type names, member names and number of elements) and the
+ * contents of all leaves. It is consistent with AnyValue equality: values that compare equal have
+ * the same hash. Since equality between scalars is defined on their numeric value, numeric leaves
+ * are hashed on their value and not on their type, e.g. 'int8' 3, 'uint64' 3 and 'float64' 3.0
+ * have the same hash. Likewise, 'string' and 'fixed_string' leaves are hashed on their content.
+ *
+ * @note The hash value is not guaranteed to be stable across library versions and should not be
+ * persisted.
+*/
+std::size_t Hash(const AnyValue& value);
+
 }  // namespace dto
 
 }  // namespace sup
@@ -0,0 +1,176 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_ANYVALUE_PUBLISHER_H_
+#define SUP_DTO_ANYVALUE_PUBLISHER_H_
+
+#include <sup/dto/basic_scalar_types.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace sup
+{
+namespace dto
+{
+class AnyValue;
+
+/**
+ * @brief Maximum number of buffers of an AnyValuePublisher.
+ */
+const std::size_t kMaxPublisherBuffers = 256;
+
+/**
+ * @brief Read-only handle to a value published by an AnyValuePublisher.
+ *
+ * @details The value remains unchanged and valid for as long as the handle exists, independent of
+ * later publications. Handles can be moved, but not copied. They must be destroyed before the
+ * publisher that created them.
+ */
+class AnyValueSnapshot
+{
+public:
+  ~AnyValueSnapshot();
+
+  AnyValueSnapshot(const AnyValueSnapshot& other) = delete;
+  AnyValueSnapshot& operator=(const AnyValueSnapshot& other) = delete;
+  AnyValueSnapshot(AnyValueSnapshot&& other) noexcept;
+  AnyValueSnapshot& operator=(AnyValueSnapshot&& other) & noexcept;
+
+  /**
+   * @brief Access the published value.
+   *
+   * @note The behavior is undefined for a handle that was moved from.
+   */
+  const AnyValue& operator*() const;
+  const AnyValue* operator->() const;
+
+  /**
+   * @brief Get the version of the published value: zero for the initial value, which is
+   * incremented for every publication.
+   */
+  uint64 GetVersion() const;
+
+private:
+  friend class AnyValuePublisher;
+  AnyValueSnapshot(const AnyValue* value, std::atomic<int64>* references, uint64 version);
+  void Release();
+  const AnyValue* m_value;
+  std::atomic<int64>* m_references;
+  uint64 m_version;
+};
+
+/**
+ * @brief Publishes successive values of a fixed type from a single writer to any number of
+ * concurrent readers.
+ *
+ * @details The writer copies each value into a preallocated buffer that no reader is using and
+ * then atomically switches readers over to it. Readers take snapshots of the latest published
+ * value without locking: taking and releasing a snapshot are wait-free operations that never block
+ * the writer or other readers, and never allocate memory.
+ *
+ * A buffer is reused for a new publication as soon as all snapshots of its previous value are
+ * released. When readers still hold snapshots of all buffers that are not current, the writer adds
+ * a new buffer instead of waiting, up to kMaxPublisherBuffers.
+ *
+ * Publishing a value with exactly the same type as the buffers copies it in place and does not
+ * allocate memory when a buffer is available. Values of other types are converted.
+ */
+class AnyValuePublisher
+{
+public:
+  /**
+   * @brief Construct a publisher with three buffers.
+   *
+   * @param initial_value Initial published value. Its type is the type of all published values.
+   */
+  explicit AnyValuePublisher(const AnyValue& initial_value);
+
+  /**
+   * @brief Construct a publisher with a given number of preallocated buffers.
+   *
+   * @param initial_value Initial published value. Its type is the type of all published values.
+   * @param n_buffers Number of preallocated buffers, which is typically one more than the number
+   * of snapshots readers hold at the same time.
+   *
+   * @throws InvalidOperationException Thrown when the number of buffers is smaller than two or
+   * larger than kMaxPublisherBuffers.
+   */
+  AnyValuePublisher(const AnyValue& initial_value, std::size_t n_buffers);
+
+  /**
+   * @brief Destructor.
+   *
+   * @note All snapshots need to be released before the publisher is destroyed.
+   */
+  ~AnyValuePublisher();
+
+  AnyValuePublisher(const AnyValuePublisher& other) = delete;
+  AnyValuePublisher(AnyValuePublisher&& other) = delete;
+  AnyValuePublisher& operator=(const AnyValuePublisher& other) = delete;
+  AnyValuePublisher& operator=(AnyValuePublisher&& other) = delete;
+
+  /**
+   * @brief Take a snapshot of the latest published value. This is safe to call concurrently from
+   * any number of threads and concurrently with Publish.
+   */
+  AnyValueSnapshot GetSnapshot() const;
+
+  /**
+   * @brief Publish a new value. Only a single thread may publish at a time.
+   *
+   * @param value Value to publish.
+   *
+   * @throws InvalidConversionException Thrown when the value cannot be converted to the published
+   * type. The previously published value then remains the latest one.
+   * @throws InvalidOperationException Thrown when all buffers are in use by readers and no new
+   * buffer can be added.
+   */
+  void Publish(const AnyValue& value);
+
+  /**
+   * @brief Get the version of the latest published value.
+   */
+  uint64 GetVersion() const;
+
+  /**
+   * @brief Get the current number of buffers. Only the publishing thread can rely on the result.
+   */
+  std::size_t NumberOfBuffers() const;
+
+private:
+  struct Buffer;
+  std::size_t AcquireFreeBuffer();
+  std::unique_ptr<std::unique_ptr<Buffer>[]> m_buffers;
+  std::size_t m_n_buffers;
+  // Index of the current buffer in the upper half and the number of snapshots taken from it in the
+  // lower half, so that readers select and reference the buffer with a single atomic operation
+  mutable std::atomic<uint64> m_current;
+  std::atomic<uint64> m_version;
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_ANYVALUE_PUBLISHER_H_
@@ -0,0 +1,126 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_ASYNC_ANY_FUNCTOR_H_
+#define SUP_DTO_ASYNC_ANY_FUNCTOR_H_
+
+#include <sup/dto/anyvalue.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+
+namespace sup
+{
+namespace dto
+{
+class AnyFunctor;
+class ThreadPool;
+
+/**
+ * @brief Executor that runs submitted tasks, e.g. on a thread pool.
+ */
+using AnyFunctorExecutor = std::function<void(std::function<void()>)>;
+
+/**
+ * @brief Completion callback for asynchronous calls. It receives the output of the call, or an
+ * empty value and the exception that was thrown by the call.
+ */
+using AnyFunctorCallback = std::function<void(AnyValue&& output, std::exception_ptr error)>;
+
+/**
+ * @brief Asynchronous invocation of an AnyFunctor on an executor.
+ *
+ * @details Calls return immediately and the functor is called later by the executor. Since
+ * multiple calls can run at the same time, the functor needs to be thread safe when the executor
+ * runs tasks concurrently (see ThreadsafeAnyFunctorDecorator and its alternatives). The destructor
+ * waits until all pending calls have finished.
+ */
+class AsyncAnyFunctor
+{
+public:
+  /**
+   * @brief Construct an asynchronous functor that runs calls on the worker threads of a pool.
+   *
+   * @param functor Functor to call. It needs to outlive this object.
+   * @param thread_pool Thread pool to use. It needs to outlive this object.
+   */
+  AsyncAnyFunctor(AnyFunctor& functor, ThreadPool& thread_pool);
+
+  /**
+   * @brief Construct an asynchronous functor that runs calls with a custom executor.
+   *
+   * @param functor Functor to call. It needs to outlive this object.
+   * @param executor Executor to use. It needs to run every submitted task exactly once.
+   */
+  AsyncAnyFunctor(AnyFunctor& functor, AnyFunctorExecutor executor);
+
+  ~AsyncAnyFunctor();
+
+  AsyncAnyFunctor(const AsyncAnyFunctor& other) = delete;
+  AsyncAnyFunctor(AsyncAnyFunctor&& other) = delete;
+  AsyncAnyFunctor& operator=(const AsyncAnyFunctor& other) = delete;
+  AsyncAnyFunctor& operator=(AsyncAnyFunctor&& other) = delete;
+
+  /**
+   * @brief Call the functor asynchronously.
+   *
+   * @param input Input of the call. Pass an rvalue to avoid copying it.
+   *
+   * @return Future for the output of the call. Exceptions thrown by the functor are rethrown by
+   * the future.
+   */
+  std::future<AnyValue> CallAsync(AnyValue input);
+
+  /**
+   * @brief Call the functor asynchronously and pass its output to a completion callback.
+   *
+   * @param input Input of the call. Pass an rvalue to avoid copying it.
+   * @param callback Completion callback, called by the executor.
+   *
+   * @note Exceptions thrown by the callback are discarded.
+   */
+  void CallAsync(AnyValue input, AnyFunctorCallback callback);
+
+  /**
+   * @brief Get the number of calls that have not finished yet.
+   */
+  std::size_t NumberOfPendingCalls() const;
+
+private:
+  void RunCall(const AnyValue& input, const AnyFunctorCallback& callback);
+  void FinishCall();
+  AnyFunctor& m_functor;
+  AnyFunctorExecutor m_executor;
+  std::size_t m_n_pending;
+  mutable std::mutex m_mtx;
+  std::condition_variable m_cv;
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_ASYNC_ANY_FUNCTOR_H_
@@ -143,6 +143,11 @@ void AnyTypeComposer::String()
   p_impl->AddScalarTypeComponent(::sup::dto::StringType);
 }
 
+void AnyTypeComposer::FixedString(std::size_t capacity)
+{
+  p_impl->AddScalarTypeComponent(::sup::dto::FixedStringType(capacity));
+}
+
 void AnyTypeComposer::StartStruct(const std::string &struct_name)
 {
   p_impl->ProcessComponent<StartStructTypeComposerComponent>(struct_name);
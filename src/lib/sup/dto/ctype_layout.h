@@ -0,0 +1,183 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_CTYPE_LAYOUT_H_
+#define SUP_DTO_CTYPE_LAYOUT_H_
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/basic_scalar_types.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+class AnyValue;
+struct CLayoutStep;
+
+/**
+ * @brief Memory layout of a plain C structure that corresponds to a given AnyType.
+ *
+ * @details The layout is computed once from the type and follows the rules of the C ABI: every
+ * scalar leaf is aligned to its natural alignment (or to the maximum alignment set with an
+ * explicit pack value, as with `#pragma pack(n)`), structures are aligned to their most aligned
+ * member and padded to a multiple of that alignment, and arrays are contiguous sequences of their
+ * element layout. String leaves are mapped to zero-terminated char arrays of kStringMaxLength
+ * characters and fixed-capacity string leaves to char arrays of their capacity. A pack value of
+ * one results in the packed representation used by ToBytes.
+ *
+ * Copying between values and C objects uses the precomputed offsets to load or store each leaf
+ * directly, without intermediate buffers or memory allocations (apart from the allocations of
+ * string payloads when reading; fixed-capacity strings never allocate).
+ */
+class CLayout
+{
+public:
+  /**
+   * @brief Compute the natural C layout for the given type.
+   *
+   * @param anytype Type of the values to map.
+   */
+  explicit CLayout(const AnyType& anytype);
+
+  /**
+   * @brief Compute the C layout for the given type and maximum member alignment.
+   *
+   * @param anytype Type of the values to map.
+   * @param pack Maximum member alignment: zero for natural alignment, otherwise a power of two.
+   *
+   * @throws InvalidOperationException Thrown when pack is not zero or a power of two.
+   */
+  CLayout(const AnyType& anytype, std::size_t pack);
+
+  ~CLayout();
+
+  CLayout(const CLayout& other) = delete;
+  CLayout(CLayout&& other) = delete;
+  CLayout& operator=(const CLayout& other) = delete;
+  CLayout& operator=(CLayout&& other) = delete;
+
+  /**
+   * @brief Get the type this layout was computed for.
+   */
+  const AnyType& GetType() const;
+
+  /**
+   * @brief Get the maximum member alignment used (zero for natural alignment).
+   */
+  std::size_t GetPack() const;
+
+  /**
+   * @brief Get the size in bytes of the corresponding C structure, including padding.
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * @brief Get the alignment in bytes of the corresponding C structure.
+   */
+  std::size_t GetAlignment() const;
+
+  /**
+   * @brief Copy the content of a value into a C object with this layout.
+   *
+   * @param anyvalue Value to copy. Its structure needs to match the type of this layout, while
+   * type names and member names are not checked.
+   * @param object Pointer to the C object.
+   * @param size Size of the C object.
+   *
+   * @throws SerializeException Thrown when the size differs from the layout's size, the structure
+   * of the value doesn't match or a string is too long. The C object can then be partially written.
+   *
+   * @note Padding bytes are left untouched.
+   */
+  void Write(const AnyValue& anyvalue, void* object, std::size_t size) const;
+
+  /**
+   * @brief Assign the content of a C object with this layout to a value.
+   *
+   * @param anyvalue Value to assign to. Its structure needs to match the type of this layout, while
+   * type names and member names are not checked.
+   * @param object Pointer to the C object.
+   * @param size Size of the C object.
+   *
+   * @throws ParseException Thrown when the size differs from the layout's size, the structure of
+   * the value doesn't match or a string is not zero-terminated. The value can then be partially
+   * assigned.
+   */
+  void Read(AnyValue& anyvalue, const void* object, std::size_t size) const;
+
+private:
+  std::size_t Compile(const AnyType& anytype, std::size_t& alignment);
+  std::size_t WriteNode(std::size_t pos, const AnyValue& anyvalue, uint8* base) const;
+  std::size_t ReadNode(std::size_t pos, AnyValue& anyvalue, const uint8* base) const;
+  AnyType m_anytype;
+  std::size_t m_pack;
+  std::size_t m_size;
+  std::size_t m_alignment;
+  std::vector<CLayoutStep> m_steps;
+};
+
+/**
+ * @brief Cast an AnyValue to a C structure with the given layout.
+ *
+ * @param anyvalue Value to cast.
+ * @param layout Layout of T.
+ *
+ * @return C structure with the content of the value. Padding bytes are zero.
+ *
+ * @throws SerializeException Thrown when the value could not be written with the given layout or
+ * when the layout's size differs from the size of T.
+ */
+template <typename T>
+T ToCType(const AnyValue& anyvalue, const CLayout& layout)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "C type must be trivially copyable");
+  T result{};
+  layout.Write(anyvalue, &result, sizeof(T));
+  return result;
+}
+
+/**
+ * @brief Assigns to an AnyValue using a C structure with the given layout.
+ *
+ * @param anyvalue AnyValue to assign to.
+ * @param object C type source object.
+ * @param layout Layout of T.
+ *
+ * @throws ParseException Thrown when the object could not be read with the given layout or
+ * when the layout's size differs from the size of T.
+ */
+template <typename T>
+void AssignFromCType(AnyValue& anyvalue, const T& object, const CLayout& layout)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "C type must be trivially copyable");
+  layout.Read(anyvalue, &object, sizeof(T));
+}
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_CTYPE_LAYOUT_H_
@@ -0,0 +1,138 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_FIXED_STRING_H_
+#define SUP_DTO_FIXED_STRING_H_
+
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/basic_scalar_types.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+namespace sup
+{
+namespace dto
+{
+/**
+ * @brief String with inline storage of a fixed capacity, for use in bound C++ structures.
+ *
+ * @details The object consists of exactly N characters, which always contain a terminating null
+ * character and are zero after the string's content. It therefore has the same layout as a C char
+ * array of N characters and maps to an AnyValue leaf of type FixedStringType(N). Assigning to it
+ * never allocates memory.
+ */
+template <std::size_t N>
+class FixedString
+{
+  static_assert(N > 0, "FixedString requires a non-zero capacity");
+public:
+  static constexpr std::size_t kCapacity = N;
+
+  FixedString() noexcept
+    : m_data{}
+  {}
+
+  /**
+   * @throws InvalidConversionException Thrown when the string does not fit.
+   */
+  FixedString(const char8* str)
+    : m_data{}
+  {
+    Assign(str, std::char_traits<char8>::length(str));
+  }
+
+  /**
+   * @throws InvalidConversionException Thrown when the string does not fit.
+   */
+  FixedString(const std::string& str)
+    : m_data{}
+  {
+    Assign(str.data(), str.size());
+  }
+
+  /**
+   * @brief Replace the content of the string.
+   *
+   * @throws InvalidConversionException Thrown when the string and its terminating null character
+   * do not fit. The content is then left unchanged.
+   */
+  void Assign(const char8* str, std::size_t length)
+  {
+    if (length >= N)
+    {
+      throw InvalidConversionException("String doesn't fit in FixedString");
+    }
+    (void)std::copy(str, str + length, m_data);
+    (void)std::fill(m_data + length, m_data + N, '\0');
+  }
+
+  /**
+   * @brief Get the zero-terminated character array.
+   */
+  const char8* GetData() const
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief Get mutable access to the character array. The caller needs to keep the array zero
+   * after the string's content.
+   */
+  char8* GetData()
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief Get the number of characters, without the terminating null character.
+   */
+  std::size_t GetSize() const
+  {
+    return static_cast<std::size_t>(std::find(m_data, m_data + N, '\0') - m_data);
+  }
+
+  std::string ToString() const
+  {
+    return std::string(m_data, GetSize());
+  }
+
+  bool operator==(const FixedString& other) const
+  {
+    return std::equal(m_data, m_data + N, other.m_data);
+  }
+
+  bool operator!=(const FixedString& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  char8 m_data[N];
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_FIXED_STRING_H_
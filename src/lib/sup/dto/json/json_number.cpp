@@ -0,0 +1,176 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "json_number.h"
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <system_error>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+bool IsIntegerLiteral(const char* str, std::size_t length);
+
+template <typename T>
+bool TryParseExact(const char* str, std::size_t length, T& result);
+
+template <typename T>
+bool TryAssignExact(AnyValue& anyvalue, const char* str, std::size_t length);
+}  // unnamed namespace
+
+std::size_t FormatJSONFloat32(float32 f, char* buffer)
+{
+  // Leave room for the appended ".0"
+  const auto result = std::to_chars(buffer, buffer + kJSONFloat32BufferSize - 2, f);
+  auto end = result.ptr;
+  if (std::find_if(buffer, end, [](char c){ return c == '.' || c == 'e'; }) == end)
+  {
+    *end++ = '.';
+    *end++ = '0';
+  }
+  return static_cast<std::size_t>(end - buffer);
+}
+
+AnyValue ParseJSONNumber(const char* str, std::size_t length)
+{
+  if (IsIntegerLiteral(str, length))
+  {
+    if (str[0] == '-')
+    {
+      int64 i = 0;
+      if (TryParseExact(str, length, i))
+      {
+        if (i >= std::numeric_limits<int32>::min())
+        {
+          return static_cast<int32>(i);
+        }
+        return i;
+      }
+    }
+    else
+    {
+      uint64 u = 0;
+      if (TryParseExact(str, length, u))
+      {
+        if (u <= std::numeric_limits<uint32>::max())
+        {
+          return static_cast<uint32>(u);
+        }
+        return u;
+      }
+    }
+    // Integers that do not fit in 64 bits are parsed as float64
+  }
+  float64 d = 0.0;
+  if (!TryParseExact(str, length, d))
+  {
+    throw ParseException("ParseJSONNumber(): could not parse number");
+  }
+  return d;
+}
+
+void AssignJSONNumber(AnyValue& anyvalue, TypeCode type_code, const char* str,
+                      std::size_t length)
+{
+  bool assigned = false;
+  switch (type_code)
+  {
+  case TypeCode::Int8:
+    assigned = TryAssignExact<int8>(anyvalue, str, length);
+    break;
+  case TypeCode::UInt8:
+    assigned = TryAssignExact<uint8>(anyvalue, str, length);
+    break;
+  case TypeCode::Int16:
+    assigned = TryAssignExact<int16>(anyvalue, str, length);
+    break;
+  case TypeCode::UInt16:
+    assigned = TryAssignExact<uint16>(anyvalue, str, length);
+    break;
+  case TypeCode::Int32:
+    assigned = TryAssignExact<int32>(anyvalue, str, length);
+    break;
+  case TypeCode::UInt32:
+    assigned = TryAssignExact<uint32>(anyvalue, str, length);
+    break;
+  case TypeCode::Int64:
+    assigned = TryAssignExact<int64>(anyvalue, str, length);
+    break;
+  case TypeCode::UInt64:
+    assigned = TryAssignExact<uint64>(anyvalue, str, length);
+    break;
+  case TypeCode::Float32:
+    assigned = TryAssignExact<float32>(anyvalue, str, length);
+    break;
+  case TypeCode::Float64:
+    assigned = TryAssignExact<float64>(anyvalue, str, length);
+    break;
+  default:
+    break;
+  }
+  if (!assigned)
+  {
+    // Out of range or different kind of number: use the generic conversion rules
+    anyvalue.ConvertFrom(ParseJSONNumber(str, length));
+  }
+}
+
+namespace
+{
+bool IsIntegerLiteral(const char* str, std::size_t length)
+{
+  const auto end = str + length;
+  return std::find_if(str, end, [](char c){ return c == '.' || c == 'e' || c == 'E'; }) == end;
+}
+
+template <typename T>
+bool TryParseExact(const char* str, std::size_t length, T& result)
+{
+  const auto end = str + length;
+  const auto parse_result = std::from_chars(str, end, result);
+  return parse_result.ec == std::errc{} && parse_result.ptr == end;
+}
+
+template <typename T>
+bool TryAssignExact(AnyValue& anyvalue, const char* str, std::size_t length)
+{
+  T value{};
+  if (!TryParseExact(str, length, value))
+  {
+    return false;
+  }
+  anyvalue.ConvertFrom(value);
+  return true;
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
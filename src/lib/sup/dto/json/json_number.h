@@ -0,0 +1,78 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_JSON_NUMBER_H_
+#define SUP_DTO_JSON_NUMBER_H_
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/basic_scalar_types.h>
+
+#include <cstddef>
+
+namespace sup
+{
+namespace dto
+{
+class AnyValue;
+
+// Buffer size that can hold any shortest round-trip representation of a finite float32.
+const std::size_t kJSONFloat32BufferSize = 32;
+
+/**
+ * @brief Write the shortest decimal representation of a finite float32 that parses back to the
+ * same float32 value.
+ *
+ * @details The representation always contains a decimal point or an exponent, so it is
+ * recognized as a floating point number.
+ *
+ * @return Number of characters written (no zero termination).
+ */
+std::size_t FormatJSONFloat32(float32 f, char* buffer);
+
+/**
+ * @brief Parse the literal text of a JSON number into the most appropriate scalar value.
+ *
+ * @details Numbers are classified in the same way as the default rapidjson parser does: integers
+ * become (unsigned) 32 or 64 bit integers and all other numbers become float64.
+ *
+ * @throws ParseException Thrown when the text is not a valid number or is out of range.
+ */
+AnyValue ParseJSONNumber(const char* str, std::size_t length);
+
+/**
+ * @brief Assign the literal text of a JSON number to a scalar value.
+ *
+ * @details Numeric leaf types are parsed directly from the text (float32 leaves in particular are
+ * correctly rounded, without an intermediate float64). Other cases fall back to ParseJSONNumber
+ * followed by a conversion, so the result is the same as for numbers parsed by rapidjson.
+ *
+ * @param anyvalue Value to assign to.
+ * @param type_code Type code of the value, passed explicitly so it can be cached for arrays.
+ */
+void AssignJSONNumber(AnyValue& anyvalue, TypeCode type_code, const char* str,
+                      std::size_t length);
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_JSON_NUMBER_H_
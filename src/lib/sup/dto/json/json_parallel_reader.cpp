@@ -0,0 +1,413 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "json_parallel_reader.h"
+
+#include <sup/dto/anyvalue/parallel_utils.h>
+#include <sup/dto/json/json_reader.h>
+#include <sup/dto/parse/anyvalue_value_builder.h>
+#include <sup/dto/rapidjson/memorystream.h>
+#include <sup/dto/rapidjson/reader.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/thread_pool.h>
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+// Documents smaller than this are not worth the overhead of the pre-scan:
+const std::size_t kMinParallelSize = 4096;
+
+struct JSONSpan
+{
+  const char* begin;
+  const char* end;
+};
+
+/**
+ * @brief Part of the JSON document that can be parsed independently into its destination value.
+ */
+struct ParseJob
+{
+  JSONSpan span;
+  AnyValue* target;
+};
+
+/**
+ * @brief Structural pre-scan of a typed JSON document that preallocates the destination and splits
+ * the document into independent parse jobs.
+ *
+ * @details Structures are descended into, while every element of a non-trivial array becomes a
+ * separate job. The pre-scan only checks the structural tokens it needs to split the document;
+ * all remaining validation is done when parsing the individual jobs.
+ */
+class JSONParseJobPlanner
+{
+public:
+  JSONParseJobPlanner();
+  ~JSONParseJobPlanner();
+
+  JSONParseJobPlanner(const JSONParseJobPlanner& other) = delete;
+  JSONParseJobPlanner(JSONParseJobPlanner&& other) = delete;
+  JSONParseJobPlanner& operator=(const JSONParseJobPlanner& other) = delete;
+  JSONParseJobPlanner& operator=(JSONParseJobPlanner&& other) = delete;
+
+  void PlanDocument(JSONSpan span, AnyValue& target);
+
+  const std::vector<ParseJob>& GetJobs() const;
+
+private:
+  void PlanValue(JSONSpan span, AnyValue& target);
+  void PlanArray(JSONSpan span, AnyValue& target);
+  bool PlanStructure(JSONSpan span, AnyValue& target);
+  std::vector<ParseJob> m_jobs;
+};
+
+bool IsWhitespace(char c);
+
+bool IsValueDelimiter(char c);
+
+const char* SkipWhitespace(const char* it, const char* end);
+
+const char* SkipString(const char* it, const char* end);
+
+const char* SkipValue(const char* it, const char* end);
+
+std::vector<JSONSpan> SplitArray(JSONSpan span);
+
+bool SplitStructure(JSONSpan span, std::vector<std::pair<JSONSpan, JSONSpan>>& members);
+
+void ParseJobSequentially(const ParseJob& job);
+}  // unnamed namespace
+
+AnyValue JSONParallelParseTypedAnyValue(const AnyType& anytype, const char* json_str,
+                                        std::size_t size, ThreadPool& thread_pool)
+{
+  if (size < kMinParallelSize)
+  {
+    return JSONParseTypedAnyValue(anytype, json_str, size);
+  }
+  AnyValue result{anytype};
+  JSONParseJobPlanner planner;
+  try
+  {
+    planner.PlanDocument({json_str, json_str + size}, result);
+    const auto& jobs = planner.GetJobs();
+    auto parse_chunk = [&jobs](std::size_t, std::size_t first, std::size_t last) {
+      for (auto idx = first; idx < last; ++idx)
+      {
+        ParseJobSequentially(jobs[idx]);
+      }
+    };
+    utils::ParallelForChunks(thread_pool, jobs.size(), parse_chunk);
+  }
+  catch(const MessageException&)
+  {
+    throw ParseException("Parsing typed AnyValue from JSON failed");
+  }
+  return result;
+}
+
+namespace
+{
+JSONParseJobPlanner::JSONParseJobPlanner()
+  : m_jobs{}
+{}
+
+JSONParseJobPlanner::~JSONParseJobPlanner() = default;
+
+void JSONParseJobPlanner::PlanDocument(JSONSpan span, AnyValue& target)
+{
+  const auto value_begin = SkipWhitespace(span.begin, span.end);
+  const auto value_end = SkipValue(value_begin, span.end);
+  if (SkipWhitespace(value_end, span.end) != span.end)
+  {
+    throw ParseException("JSONParseJobPlanner::PlanDocument(): trailing characters");
+  }
+  PlanValue({value_begin, value_end}, target);
+}
+
+const std::vector<ParseJob>& JSONParseJobPlanner::GetJobs() const
+{
+  return m_jobs;
+}
+
+void JSONParseJobPlanner::PlanValue(JSONSpan span, AnyValue& target)
+{
+  if (IsArrayValue(target) && *span.begin == '[')
+  {
+    PlanArray(span, target);
+    return;
+  }
+  if (IsStructValue(target) && *span.begin == '{' && PlanStructure(span, target))
+  {
+    return;
+  }
+  m_jobs.push_back({span, &target});
+}
+
+void JSONParseJobPlanner::PlanArray(JSONSpan span, AnyValue& target)
+{
+  const auto elements = SplitArray(span);
+  const auto n_elements = elements.size();
+  // Grow unbounded arrays, as the sequential array build node does:
+  if (target.NumberOfElements() == 0)
+  {
+    const auto element_type = target.GetType().ElementType();
+    for (std::size_t idx = 0; idx < n_elements; ++idx)
+    {
+      target.AddElement(AnyValue{element_type});
+    }
+  }
+  if (n_elements > target.NumberOfElements())
+  {
+    throw ParseException("JSONParseJobPlanner::PlanArray(): more elements than allowed");
+  }
+  // A single element is not worth splitting: look for parallelism inside it instead
+  if (n_elements == 1)
+  {
+    PlanValue(elements[0], target[0]);
+    return;
+  }
+  for (std::size_t idx = 0; idx < n_elements; ++idx)
+  {
+    m_jobs.push_back({elements[idx], &target[idx]});
+  }
+}
+
+bool JSONParseJobPlanner::PlanStructure(JSONSpan span, AnyValue& target)
+{
+  std::vector<std::pair<JSONSpan, JSONSpan>> members;
+  if (!SplitStructure(span, members))
+  {
+    return false;
+  }
+  // Only descend when all keys denote distinct direct members, so that no two jobs can write to
+  // the same value:
+  std::set<std::string> member_names;
+  for (const auto& member : members)
+  {
+    const std::string name{member.first.begin, member.first.end};
+    if (name.find_first_of(".[") != std::string::npos || !target.HasField(name))
+    {
+      return false;
+    }
+    if (!member_names.insert(name).second)
+    {
+      return false;
+    }
+  }
+  for (const auto& member : members)
+  {
+    const std::string name{member.first.begin, member.first.end};
+    PlanValue(member.second, target[name]);
+  }
+  return true;
+}
+
+bool IsWhitespace(char c)
+{
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+bool IsValueDelimiter(char c)
+{
+  return IsWhitespace(c) || c == ',' || c == ':' || c == ']' || c == '}';
+}
+
+const char* SkipWhitespace(const char* it, const char* end)
+{
+  while (it != end && IsWhitespace(*it))
+  {
+    ++it;
+  }
+  return it;
+}
+
+const char* SkipString(const char* it, const char* end)
+{
+  // it points to the opening quote
+  ++it;
+  while (it != end)
+  {
+    if (*it == '\\')
+    {
+      it += (end - it > 1) ? 2 : 1;
+      continue;
+    }
+    if (*it == '"')
+    {
+      return it + 1;
+    }
+    ++it;
+  }
+  throw ParseException("SkipString(): unterminated string");
+}
+
+const char* SkipValue(const char* it, const char* end)
+{
+  if (it == end)
+  {
+    throw ParseException("SkipValue(): missing value");
+  }
+  if (*it == '"')
+  {
+    return SkipString(it, end);
+  }
+  if (*it == '{' || *it == '[')
+  {
+    std::size_t depth = 0;
+    while (it != end)
+    {
+      switch (*it)
+      {
+      case '"':
+        it = SkipString(it, end);
+        continue;
+      case '{':
+      case '[':
+        ++depth;
+        break;
+      case '}':
+      case ']':
+        if (--depth == 0)
+        {
+          return it + 1;
+        }
+        break;
+      default:
+        break;
+      }
+      ++it;
+    }
+    throw ParseException("SkipValue(): unbalanced structure");
+  }
+  // Literal or number: scan up to the next structural character or whitespace
+  const auto begin = it;
+  while (it != end && !IsValueDelimiter(*it))
+  {
+    ++it;
+  }
+  if (it == begin)
+  {
+    throw ParseException("SkipValue(): missing value");
+  }
+  return it;
+}
+
+std::vector<JSONSpan> SplitArray(JSONSpan span)
+{
+  std::vector<JSONSpan> result;
+  const auto last = span.end - 1;  // points to ']'
+  auto it = SkipWhitespace(span.begin + 1, last);
+  while (it != last)
+  {
+    const auto element_end = SkipValue(it, last);
+    result.push_back({it, element_end});
+    it = SkipWhitespace(element_end, last);
+    if (it == last)
+    {
+      break;
+    }
+    if (*it != ',')
+    {
+      throw ParseException("SplitArray(): expected ',' between array elements");
+    }
+    it = SkipWhitespace(it + 1, last);
+    if (it == last)
+    {
+      throw ParseException("SplitArray(): trailing ',' in array");
+    }
+  }
+  return result;
+}
+
+bool SplitStructure(JSONSpan span, std::vector<std::pair<JSONSpan, JSONSpan>>& members)
+{
+  const auto last = span.end - 1;  // points to '}'
+  auto it = SkipWhitespace(span.begin + 1, last);
+  while (it != last)
+  {
+    if (*it != '"')
+    {
+      throw ParseException("SplitStructure(): expected member name");
+    }
+    const auto key_end = SkipString(it, last);
+    const JSONSpan key{it + 1, key_end - 1};
+    if (std::find(key.begin, key.end, '\\') != key.end)
+    {
+      // Escaped member names are left to the sequential parser
+      return false;
+    }
+    it = SkipWhitespace(key_end, last);
+    if (it == last || *it != ':')
+    {
+      throw ParseException("SplitStructure(): expected ':' after member name");
+    }
+    const auto value_begin = SkipWhitespace(it + 1, last);
+    const auto value_end = SkipValue(value_begin, last);
+    members.emplace_back(key, JSONSpan{value_begin, value_end});
+    it = SkipWhitespace(value_end, last);
+    if (it == last)
+    {
+      break;
+    }
+    if (*it != ',')
+    {
+      throw ParseException("SplitStructure(): expected ',' between members");
+    }
+    it = SkipWhitespace(it + 1, last);
+    if (it == last)
+    {
+      throw ParseException("SplitStructure(): trailing ',' in structure");
+    }
+  }
+  return true;
+}
+
+void ParseJobSequentially(const ParseJob& job)
+{
+  AnyValueValueBuilder builder(*job.target);
+  rapidjson::MemoryStream mstream(job.span.begin, job.span.end - job.span.begin);
+  rapidjson::Reader reader;
+  (void)reader.Parse<kJSONValueParseFlags>(mstream, builder);
+  if (reader.HasParseError())
+  {
+    throw ParseException("ParseJobSequentially(): parsing JSON failed");
+  }
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
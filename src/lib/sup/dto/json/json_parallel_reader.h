@@ -0,0 +1,54 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_JSON_PARALLEL_READER_H_
+#define SUP_DTO_JSON_PARALLEL_READER_H_
+
+#include <cstddef>
+
+namespace sup
+{
+namespace dto
+{
+class AnyType;
+class AnyValue;
+class ThreadPool;
+
+/**
+ * @brief Parse a typed AnyValue from a JSON character buffer, parsing the elements of arrays in
+ * parallel.
+ *
+ * @details A structural pre-scan locates the outermost arrays (top-level or nested inside
+ * structures) and the boundaries of their elements. The destination value is preallocated and
+ * the elements are then parsed directly into their slots by the threads of the pool. The result
+ * is identical to the one of JSONParseTypedAnyValue.
+ *
+ * @throws ParseException Thrown when the JSON could not be parsed into the given type.
+ */
+AnyValue JSONParallelParseTypedAnyValue(const AnyType& anytype, const char* json_str,
+                                        std::size_t size, ThreadPool& thread_pool);
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_JSON_PARALLEL_READER_H_
@@ -25,36 +25,42 @@
 #include <sup/dto/parse/anytype_builder.h>
 #include <sup/dto/parse/anyvalue_builder.h>
 #include <sup/dto/parse/anyvalue_value_builder.h>
+#include <sup/dto/parse/field_projection.h>
+#include <sup/dto/parse/projection_filter_t.h>
 #include <sup/dto/rapidjson/istreamwrapper.h>
+#include <sup/dto/rapidjson/memorystream.h>
 #include <sup/dto/rapidjson/reader.h>
 
 #include <sup/dto/anytype.h>
 #include <sup/dto/anyvalue.h>
 #include <sup/dto/anyvalue_exceptions.h>
 
+#include <string>
+
 namespace sup
 {
 namespace dto
 {
+namespace
+{
+template <unsigned parseFlags, typename Builder, typename InputStream>
+void ParseWithBuilder(Builder& builder, InputStream& input_stream, const std::string& error_msg);
+
+template <typename InputStream>
+AnyValue ParseProjectedAnyValue(const AnyTypeRegistry* anytype_registry,
+                                InputStream& input_stream, const FieldProjection& projection);
+
+template <typename InputStream>
+AnyValue ParseProjectedTypedAnyValue(const AnyType& anytype, InputStream& input_stream,
+                                     const FieldProjection& projection);
+}
 
 AnyType JSONParseAnyType(const AnyTypeRegistry* anytype_registry, std::istream& json_stream)
 {
   AnyTypeBuilder builder(anytype_registry);
   rapidjson::IStreamWrapper istream(json_stream);
-  rapidjson::Reader reader;
-
-  try
-  {
-    (void)reader.Parse(istream, builder);
-  }
-  catch(const MessageException&)
-  {
-    throw ParseException("Parsing AnyType from JSON failed");
-  }
-  if (reader.HasParseError())
-  {
-    throw ParseException("Parsing AnyType from JSON failed");
-  }
+  ParseWithBuilder<rapidjson::kParseDefaultFlags>(builder, istream,
+                                                  "Parsing AnyType from JSON failed");
   return builder.MoveAnyType();
 }
 
@@ -62,43 +68,117 @@ AnyValue JSONParseAnyValue(const AnyTypeRegistry* anytype_registry, std::istream
 {
   AnyValueBuilder builder(anytype_registry);
   rapidjson::IStreamWrapper istream(json_stream);
+  ParseWithBuilder<kJSONValueParseFlags>(builder, istream, "Parsing AnyValue from JSON failed");
+  return builder.MoveAnyValue();
+}
+
+AnyValue JSONParseTypedAnyValue(const AnyType& anytype, std::istream& json_stream)
+{
+  AnyValueValueBuilder builder(anytype);
+  rapidjson::IStreamWrapper istream(json_stream);
+  ParseWithBuilder<kJSONValueParseFlags>(builder, istream,
+                                         "Parsing typed AnyValue from JSON failed");
+  return builder.MoveAnyValue();
+}
+
+AnyValue JSONParseAnyValue(const AnyTypeRegistry* anytype_registry, const char* json_str,
+                           std::size_t size)
+{
+  AnyValueBuilder builder(anytype_registry);
+  rapidjson::MemoryStream mstream(json_str, size);
+  ParseWithBuilder<kJSONValueParseFlags>(builder, mstream, "Parsing AnyValue from JSON failed");
+  return builder.MoveAnyValue();
+}
+
+AnyValue JSONParseTypedAnyValue(const AnyType& anytype, const char* json_str, std::size_t size)
+{
+  AnyValueValueBuilder builder(anytype);
+  rapidjson::MemoryStream mstream(json_str, size);
+  ParseWithBuilder<kJSONValueParseFlags>(builder, mstream,
+                                         "Parsing typed AnyValue from JSON failed");
+  return builder.MoveAnyValue();
+}
+
+AnyValue JSONParseAnyValue(const AnyTypeRegistry* anytype_registry, std::istream& json_stream,
+                           const FieldProjection& projection)
+{
+  rapidjson::IStreamWrapper istream(json_stream);
+  return ParseProjectedAnyValue(anytype_registry, istream, projection);
+}
+
+AnyValue JSONParseTypedAnyValue(const AnyType& anytype, std::istream& json_stream,
+                                const FieldProjection& projection)
+{
+  rapidjson::IStreamWrapper istream(json_stream);
+  return ParseProjectedTypedAnyValue(anytype, istream, projection);
+}
+
+AnyValue JSONParseAnyValue(const AnyTypeRegistry* anytype_registry, const char* json_str,
+                           std::size_t size, const FieldProjection& projection)
+{
+  rapidjson::MemoryStream mstream(json_str, size);
+  return ParseProjectedAnyValue(anytype_registry, mstream, projection);
+}
+
+AnyValue JSONParseTypedAnyValue(const AnyType& anytype, const char* json_str, std::size_t size,
+                                const FieldProjection& projection)
+{
+  rapidjson::MemoryStream mstream(json_str, size);
+  return ParseProjectedTypedAnyValue(anytype, mstream, projection);
+}
+
+namespace
+{
+template <unsigned parseFlags, typename Builder, typename InputStream>
+void ParseWithBuilder(Builder& builder, InputStream& input_stream, const std::string& error_msg)
+{
   rapidjson::Reader reader;
 
   try
   {
-    (void)reader.Parse(istream, builder);
+    (void)reader.Parse<parseFlags>(input_stream, builder);
   }
   catch(const MessageException&)
   {
-    throw ParseException("Parsing AnyValue from JSON failed");
+    throw ParseException(error_msg);
   }
   if (reader.HasParseError())
   {
-    throw ParseException("Parsing AnyValue from JSON failed");
+    throw ParseException(error_msg);
   }
-  return builder.MoveAnyValue();
 }
 
-AnyValue JSONParseTypedAnyValue(const AnyType& anytype, std::istream& json_stream)
+template <typename InputStream>
+AnyValue ParseProjectedAnyValue(const AnyTypeRegistry* anytype_registry,
+                                InputStream& input_stream, const FieldProjection& projection)
 {
-  AnyValueValueBuilder builder(anytype);
-  rapidjson::IStreamWrapper istream(json_stream);
-  rapidjson::Reader reader;
+  AnyValueBuilder builder(anytype_registry, &projection);
+  ProjectionFilter<AnyValueBuilder> filter(builder, projection, false);
+  ParseWithBuilder<kJSONValueParseFlags>(filter, input_stream,
+                                         "Parsing projected AnyValue from JSON failed");
+  return builder.MoveAnyValue();
+}
 
+template <typename InputStream>
+AnyValue ParseProjectedTypedAnyValue(const AnyType& anytype, InputStream& input_stream,
+                                     const FieldProjection& projection)
+{
+  AnyValue result;
   try
   {
-    (void)reader.Parse(istream, builder);
+    result = AnyValue{projection.ProjectType(anytype)};
   }
   catch(const MessageException&)
   {
-    throw ParseException("Parsing typed AnyValue from JSON failed");
+    throw ParseException("Parsing projected typed AnyValue from JSON failed");
   }
-  if (reader.HasParseError())
-  {
-    throw ParseException("Parsing typed AnyValue from JSON failed");
-  }
-  return builder.MoveAnyValue();
+  AnyValueValueBuilder builder(result);
+  ProjectionFilter<AnyValueValueBuilder> filter(builder, projection, true);
+  ParseWithBuilder<kJSONValueParseFlags>(filter, input_stream,
+                                         "Parsing projected typed AnyValue from JSON failed");
+  return result;
 }
+}  // unnamed namespace
 
 }  // namespace dto
 
@@ -23,6 +23,9 @@
 #ifndef SUP_DTO_JSON_READER_H_
 #define SUP_DTO_JSON_READER_H_
 
+#include <sup/dto/rapidjson/reader.h>
+
+#include <cstddef>
 #include <istream>
 
 namespace sup
@@ -32,6 +35,11 @@ namespace dto
 class AnyType;
 class AnyTypeRegistry;
 class AnyValue;
+class FieldProjection;
+
+// Values are parsed with numbers passed as their literal text, so the builders can parse them
+// directly into the type of the destination (e.g. float32 without rounding twice).
+const unsigned kJSONValueParseFlags = rapidjson::kParseNumbersAsStringsFlag;
 
 AnyType JSONParseAnyType(const AnyTypeRegistry* anytype_registry, std::istream& json_stream);
 
@@ -39,6 +47,26 @@ AnyValue JSONParseAnyValue(const AnyTypeRegistry* anytype_registry, std::istream
 
 AnyValue JSONParseTypedAnyValue(const AnyType& anytype, std::istream& json_stream);
 
+// Overloads that parse directly from a character buffer (not necessarily zero-terminated).
+AnyValue JSONParseAnyValue(const AnyTypeRegistry* anytype_registry, const char* json_str,
+                           std::size_t size);
+
+AnyValue JSONParseTypedAnyValue(const AnyType& anytype, const char* json_str, std::size_t size);
+
+// Overloads that only build the fields selected by the projection: all other values are skipped
+// during tokenization.
+AnyValue JSONParseAnyValue(const AnyTypeRegistry* anytype_registry, std::istream& json_stream,
+                           const FieldProjection& projection);
+
+AnyValue JSONParseTypedAnyValue(const AnyType& anytype, std::istream& json_stream,
+                                const FieldProjection& projection);
+
+AnyValue JSONParseAnyValue(const AnyTypeRegistry* anytype_registry, const char* json_str,
+                           std::size_t size, const FieldProjection& projection);
+
+AnyValue JSONParseTypedAnyValue(const AnyType& anytype, const char* json_str, std::size_t size,
+                                const FieldProjection& projection);
+
 }  // namespace dto
 
 }  // namespace sup
@@ -0,0 +1,163 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/json_value_stream.h>
+
+#include <sup/dto/json/json_reader.h>
+#include <sup/dto/json/json_writer.h>
+
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <utility>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+bool IsBlank(const std::string& line);
+}
+
+JSONAnyValueStreamWriter::JSONAnyValueStreamWriter(std::ostream& json_stream)
+  : m_json_stream{json_stream}
+  , m_anytype{}
+  , m_typed{false}
+  , m_n_records{0}
+{}
+
+JSONAnyValueStreamWriter::JSONAnyValueStreamWriter(std::ostream& json_stream,
+                                                   const AnyType& anytype)
+  : m_json_stream{json_stream}
+  , m_anytype{anytype}
+  , m_typed{true}
+  , m_n_records{0}
+{}
+
+JSONAnyValueStreamWriter::~JSONAnyValueStreamWriter() = default;
+
+void JSONAnyValueStreamWriter::Write(const AnyValue& anyvalue)
+{
+  if (m_typed)
+  {
+    if (anyvalue.GetType() != m_anytype)
+    {
+      const std::string error = "JSONAnyValueStreamWriter::Write(): type of record "
+                                + std::to_string(m_n_records) + " differs from the stream's type";
+      throw SerializeException(error);
+    }
+    JSONSerializeAnyValueValues(m_json_stream, anyvalue);
+  }
+  else
+  {
+    JSONSerializeAnyValue(m_json_stream, anyvalue);
+  }
+  (void)m_json_stream.put('\n');
+  if (!m_json_stream)
+  {
+    const std::string error = "JSONAnyValueStreamWriter::Write(): could not write record "
+                              + std::to_string(m_n_records);
+    throw SerializeException(error);
+  }
+  ++m_n_records;
+}
+
+std::size_t JSONAnyValueStreamWriter::NumberOfRecords() const
+{
+  return m_n_records;
+}
+
+JSONAnyValueStreamReader::JSONAnyValueStreamReader(std::istream& json_stream)
+  : JSONAnyValueStreamReader{json_stream, nullptr}
+{}
+
+JSONAnyValueStreamReader::JSONAnyValueStreamReader(std::istream& json_stream,
+                                                   const AnyTypeRegistry* type_registry)
+  : m_json_stream{json_stream}
+  , m_line{}
+  , m_empty_registry{}
+  , m_type_registry{type_registry == nullptr ? &m_empty_registry : type_registry}
+  , m_anytype{}
+  , m_typed{false}
+  , m_n_records{0}
+{}
+
+JSONAnyValueStreamReader::JSONAnyValueStreamReader(std::istream& json_stream,
+                                                   const AnyType& anytype)
+  : m_json_stream{json_stream}
+  , m_line{}
+  , m_empty_registry{}
+  , m_type_registry{&m_empty_registry}
+  , m_anytype{anytype}
+  , m_typed{true}
+  , m_n_records{0}
+{}
+
+JSONAnyValueStreamReader::~JSONAnyValueStreamReader() = default;
+
+bool JSONAnyValueStreamReader::ReadNext(AnyValue& anyvalue)
+{
+  while (std::getline(m_json_stream, m_line))
+  {
+    if (IsBlank(m_line))
+    {
+      continue;
+    }
+    const auto record_idx = m_n_records++;
+    AnyValue record;
+    try
+    {
+      record = m_typed ? JSONParseTypedAnyValue(m_anytype, m_line.data(), m_line.size())
+                       : JSONParseAnyValue(m_type_registry, m_line.data(), m_line.size());
+    }
+    catch(const MessageException&)
+    {
+      const std::string error = "JSONAnyValueStreamReader::ReadNext(): could not parse record "
+                                + std::to_string(record_idx);
+      throw ParseException(error);
+    }
+    anyvalue = std::move(record);
+    return true;
+  }
+  return false;
+}
+
+std::size_t JSONAnyValueStreamReader::NumberOfRecords() const
+{
+  return m_n_records;
+}
+
+namespace
+{
+bool IsBlank(const std::string& line)
+{
+  return std::all_of(line.begin(), line.end(),
+                     [](char c){ return std::isspace(static_cast<unsigned char>(c)) != 0; });
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
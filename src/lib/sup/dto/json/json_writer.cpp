@@ -22,13 +22,22 @@
 
 #include "json_writer.h"
 
+#include <sup/dto/anyvalue/parallel_utils.h>
 #include <sup/dto/json/json_writer_t.h>
 #include <sup/dto/parse/serialization_constants.h>
+#include <sup/dto/serialize/serialization_plan.h>
 #include <sup/dto/serialize/writer_serializer.h>
 #include <sup/dto/visit/visit_t.h>
 
 #include <sup/dto/anytype.h>
 #include <sup/dto/anyvalue.h>
+#include <sup/dto/thread_pool.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace sup
 {
@@ -43,6 +52,16 @@ void ToJSONWriter(IWriter& writer, const AnyValue& anyvalue);
 void AddEncodingInformation(IWriter& writer);
 void AddDatatypeStart(IWriter& writer);
 void AddValueStart(IWriter& writer);
+
+using ParallelSubtrees = std::unordered_set<const AnyValue*>;
+
+// Collect the values that are, or contain, arrays to serialize in parallel. The elements of such
+// arrays are not visited:
+bool CollectParallelSubtrees(const AnyValue& anyvalue, ParallelSubtrees& parallel_subtrees);
+void SerializeParallelSubtree(std::ostream& json_stream, const AnyValue& anyvalue,
+                              const ParallelSubtrees& parallel_subtrees, ThreadPool& thread_pool);
+void ParallelSerializeArrayValues(std::ostream& json_stream, const AnyValue& anyvalue,
+                                  ThreadPool& thread_pool);
 }
 
 
@@ -54,7 +73,7 @@ void JSONSerializeAnyType(std::ostream& json_stream, const AnyType& anytype, boo
   auto writer = pretty ? CreatePrettyJSONWriter(json_stream)
                        : CreateJSONWriter(json_stream);
   WriterTypeSerializer serializer(writer.get());
-  Visit(anytype, serializer);
+  VisitStatic<WriterTypeSerializer>(anytype, serializer);
 }
 
 void JSONSerializeAnyType(std::ostream& json_stream, const AnyType& anytype)
@@ -78,8 +97,9 @@ void JSONSerializeAnyValueValues(std::ostream& json_stream, const AnyValue& anyv
 {
   auto writer = pretty ? CreatePrettyJSONWriter(json_stream)
                        : CreateJSONWriter(json_stream);
+  const auto plan = GetSerializationPlan(anyvalue);
   WriterValueSerializer serializer(writer.get());
-  Visit(anyvalue, serializer);
+  plan->Execute<WriterValueSerializer>(anyvalue, serializer);
 }
 
 void JSONSerializeAnyValueValues(std::ostream& json_stream, const AnyValue& anyvalue)
@@ -87,6 +107,18 @@ void JSONSerializeAnyValueValues(std::ostream& json_stream, const AnyValue& anyv
   JSONSerializeAnyValueValues(json_stream, anyvalue, false);
 }
 
+void JSONSerializeAnyValueValues(std::ostream& json_stream, const AnyValue& anyvalue,
+                                 ThreadPool& thread_pool)
+{
+  ParallelSubtrees parallel_subtrees;
+  if (!CollectParallelSubtrees(anyvalue, parallel_subtrees))
+  {
+    JSONSerializeAnyValueValues(json_stream, anyvalue, false);
+    return;
+  }
+  SerializeParallelSubtree(json_stream, anyvalue, parallel_subtrees, thread_pool);
+}
+
 namespace
 {
 std::unique_ptr<IWriter> CreateJSONWriter(std::ostream& out_stream)
@@ -104,12 +136,15 @@ void ToJSONWriter(IWriter& writer, const AnyValue& anyvalue)
   (void)writer.StartArray();
   AddEncodingInformation(writer);
   AddDatatypeStart(writer);
+  // Cached plans can be shared with types that only differ in their type names:
+  const auto anytype = anyvalue.GetType();
   WriterTypeSerializer type_serializer(&writer);
-  Visit<const AnyType>(anyvalue.GetType(), type_serializer);
+  VisitStatic<WriterTypeSerializer, const AnyType>(anytype, type_serializer);
   (void)writer.EndStructure();
   AddValueStart(writer);
+  const auto plan = GetSerializationPlan(anytype);
   WriterValueSerializer value_serializer(&writer);
-  Visit<const AnyValue>(anyvalue, value_serializer);
+  plan->Execute<WriterValueSerializer>(anyvalue, value_serializer);
   (void)writer.EndStructure();
   (void)writer.EndArray();
 }
@@ -133,6 +168,98 @@ void AddValueStart(IWriter& writer)
   (void)writer.StartStructure();
   (void)writer.Member(serialization::INSTANCE_KEY);
 }
+
+bool CollectParallelSubtrees(const AnyValue& anyvalue, ParallelSubtrees& parallel_subtrees)
+{
+  if (utils::IsParallelArray(anyvalue))
+  {
+    (void)parallel_subtrees.insert(std::addressof(anyvalue));
+    return true;
+  }
+  bool contains_parallel_array = false;
+  for (std::size_t idx = 0; idx < anyvalue.NumberOfChildren(); ++idx)
+  {
+    if (CollectParallelSubtrees(*anyvalue.GetChildValue(idx), parallel_subtrees))
+    {
+      contains_parallel_array = true;
+    }
+  }
+  if (contains_parallel_array)
+  {
+    (void)parallel_subtrees.insert(std::addressof(anyvalue));
+  }
+  return contains_parallel_array;
+}
+
+void SerializeParallelSubtree(std::ostream& json_stream, const AnyValue& anyvalue,
+                              const ParallelSubtrees& parallel_subtrees, ThreadPool& thread_pool)
+{
+  if (utils::IsParallelArray(anyvalue))
+  {
+    ParallelSerializeArrayValues(json_stream, anyvalue, thread_pool);
+    return;
+  }
+  const bool is_struct = IsStructValue(anyvalue);
+  json_stream << (is_struct ? '{' : '[');
+  for (std::size_t idx = 0; idx < anyvalue.NumberOfChildren(); ++idx)
+  {
+    if (idx > 0)
+    {
+      json_stream << ',';
+    }
+    if (is_struct)
+    {
+      auto writer = CreateJSONWriter(json_stream);
+      (void)writer->String(anyvalue.GetMemberName(idx));
+      json_stream << ':';
+    }
+    const auto& child = *anyvalue.GetChildValue(idx);
+    if (parallel_subtrees.count(std::addressof(child)) > 0)
+    {
+      SerializeParallelSubtree(json_stream, child, parallel_subtrees, thread_pool);
+    }
+    else
+    {
+      JSONSerializeAnyValueValues(json_stream, child, false);
+    }
+  }
+  json_stream << (is_struct ? '}' : ']');
+}
+
+void ParallelSerializeArrayValues(std::ostream& json_stream, const AnyValue& anyvalue,
+                                  ThreadPool& thread_pool)
+{
+  // All elements share the same type and thus the same plan. Every chunk is serialized as a
+  // separate JSON array, whose brackets are dropped when concatenating the chunks in order.
+  const auto plan = GetSerializationPlan(anyvalue[0]);
+  const auto n_elements = anyvalue.NumberOfElements();
+  std::vector<std::string> chunks(utils::NumberOfChunks(thread_pool, n_elements));
+  auto serialize_chunk = [&anyvalue, &plan, &chunks](std::size_t chunk_idx, std::size_t first,
+                                                     std::size_t last) {
+    std::ostringstream oss;
+    auto writer = CreateJSONWriter(oss);
+    WriterValueSerializer serializer(writer.get());
+    (void)writer->StartArray();
+    for (auto idx = first; idx < last; ++idx)
+    {
+      plan->Execute<WriterValueSerializer>(anyvalue[idx], serializer);
+    }
+    (void)writer->EndArray();
+    chunks[chunk_idx] = oss.str();
+  };
+  utils::ParallelForChunks(thread_pool, n_elements, serialize_chunk);
+  json_stream << '[';
+  for (std::size_t idx = 0; idx < chunks.size(); ++idx)
+  {
+    if (idx > 0)
+    {
+      json_stream << ',';
+    }
+    (void)json_stream.write(chunks[idx].data() + 1,
+                            static_cast<std::streamsize>(chunks[idx].size() - 2));
+  }
+  json_stream << ']';
+}
 }  // unnamed namespace
 
 }  // namespace dto
@@ -31,6 +31,7 @@ namespace dto
 {
 class AnyType;
 class AnyValue;
+class ThreadPool;
 
 void JSONSerializeAnyType(std::ostream& json_stream, const AnyType& anytype, bool pretty);
 void JSONSerializeAnyType(std::ostream& json_stream, const AnyType& anytype);
@@ -41,6 +42,11 @@ void JSONSerializeAnyValue(std::ostream& json_stream, const AnyValue& anyvalue);
 void JSONSerializeAnyValueValues(std::ostream& json_stream, const AnyValue& anyvalue, bool pretty);
 void JSONSerializeAnyValueValues(std::ostream& json_stream, const AnyValue& anyvalue);
 
+// Compact serialization of the values, where the elements of large arrays are serialized in
+// chunks by the threads of the pool. The output is identical to the sequential one.
+void JSONSerializeAnyValueValues(std::ostream& json_stream, const AnyValue& anyvalue,
+                                 ThreadPool& thread_pool);
+
 }  // namespace dto
 
 }  // namespace sup
@@ -23,11 +23,13 @@
 #ifndef SUP_DTO_JSON_WRITER_T_H_
 #define SUP_DTO_JSON_WRITER_T_H_
 
+#include <sup/dto/json/json_number.h>
 #include <sup/dto/rapidjson/prettywriter.h>
 #include <sup/dto/rapidjson/ostreamwrapper.h>
 #include <sup/dto/rapidjson/writer.h>
 #include <sup/dto/serialize/i_writer.h>
 
+#include <cmath>
 #include <ostream>
 
 namespace FormatConstants
@@ -168,7 +170,14 @@ bool JSONStringWriterT<WriterImpl>::Uint64(uint64 u)
 template <typename WriterImpl>
 bool JSONStringWriterT<WriterImpl>::Float(float32 f)
 {
-  return m_json_writer.Double(f);
+  // Non-finite values are left to the writer's own handling
+  if (!std::isfinite(f))
+  {
+    return m_json_writer.Double(f);
+  }
+  char buffer[kJSONFloat32BufferSize];
+  const auto length = FormatJSONFloat32(f, buffer);
+  return m_json_writer.RawValue(buffer, length, rapidjson::kNumberType);
 }
 
 template <typename WriterImpl>
@@ -25,11 +25,15 @@
 
 #include <sup/dto/anyvalue.h>
 
+#include <string>
+#include <vector>
+
 namespace sup
 {
 namespace dto
 {
 class AnyTypeRegistry;
+class ThreadPool;
 
 class JSONAnyValueParser
 {
@@ -100,6 +104,94 @@ public:
    */
   bool TypedParseFile(const AnyType& anytype, const std::string& filename);
 
+  /**
+   * @brief Parse an AnyValue with given type from a JSON string, parsing the elements of arrays on
+   * multiple threads.
+   *
+   * @details A fast structural pre-scan locates the element boundaries of the outermost arrays
+   * (top-level or nested inside structures). Chunks of elements are then parsed in parallel,
+   * directly into the preallocated elements of the resulting value.
+   *
+   * @param anytype Type to use for resulting value.
+   * @param json_str JSON string.
+   * @param thread_pool Thread pool to use for parsing.
+   *
+   * @return true on successful parsing, false otherwise.
+   *
+   * @note The parsed value is identical to the one obtained from parsing on a single thread.
+   */
+  bool TypedParseString(const AnyType& anytype, const std::string& json_str,
+                        ThreadPool& thread_pool);
+
+  /**
+   * @brief Parse an AnyValue with given type from a JSON file, parsing the elements of arrays on
+   * multiple threads.
+   *
+   * @param anytype Type to use for resulting value.
+   * @param filename name of the file containing the JSON representation.
+   * @param thread_pool Thread pool to use for parsing.
+   *
+   * @return true on successful parsing, false otherwise.
+   *
+   * @note The whole file is read into memory before parsing.
+   */
+  bool TypedParseFile(const AnyType& anytype, const std::string& filename,
+                      ThreadPool& thread_pool);
+
+  /**
+   * @brief Parse only selected fields of an AnyValue from a JSON string.
+   *
+   * @details The fields are given as paths in the syntax of AnyValue::operator[] and can only
+   * denote structure members (e.g. "setpoint.limits.high"). The resulting value contains only the
+   * selected members, in their original order. Non-selected members are skipped while tokenizing
+   * the JSON, without building any nodes or strings for them. An empty path selects the whole value.
+   *
+   * @param json_str JSON string.
+   * @param type_registry AnyType registry to use during parsing.
+   * @param fieldnames Paths of the fields to select.
+   *
+   * @return true on successful parsing, false otherwise (including paths that contain array
+   * indices or that do not denote existing fields).
+   */
+  bool ParseString(const std::string& json_str, const AnyTypeRegistry* type_registry,
+                   const std::vector<std::string>& fieldnames);
+
+  /**
+   * @brief Parse only selected fields of an AnyValue from a JSON file.
+   *
+   * @param filename name of the file containing the JSON representation.
+   * @param type_registry AnyType registry to use during parsing.
+   * @param fieldnames Paths of the fields to select.
+   *
+   * @return true on successful parsing, false otherwise.
+   */
+  bool ParseFile(const std::string& filename, const AnyTypeRegistry* type_registry,
+                 const std::vector<std::string>& fieldnames);
+
+  /**
+   * @brief Parse only selected fields of an AnyValue with given type from a JSON string.
+   *
+   * @param anytype Type of the complete value represented by the JSON string.
+   * @param json_str JSON string.
+   * @param fieldnames Paths of the fields to select.
+   *
+   * @return true on successful parsing, false otherwise.
+   */
+  bool TypedParseString(const AnyType& anytype, const std::string& json_str,
+                        const std::vector<std::string>& fieldnames);
+
+  /**
+   * @brief Parse only selected fields of an AnyValue with given type from a JSON file.
+   *
+   * @param anytype Type of the complete value represented by the JSON file.
+   * @param filename name of the file containing the JSON representation.
+   * @param fieldnames Paths of the fields to select.
+   *
+   * @return true on successful parsing, false otherwise.
+   */
+  bool TypedParseFile(const AnyType& anytype, const std::string& filename,
+                      const std::vector<std::string>& fieldnames);
+
   /**
    * @brief Return the parsed AnyValue with move semantics.
    *
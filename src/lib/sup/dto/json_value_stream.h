@@ -0,0 +1,182 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_JSON_VALUE_STREAM_H_
+#define SUP_DTO_JSON_VALUE_STREAM_H_
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anytype_registry.h>
+#include <sup/dto/anyvalue.h>
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace sup
+{
+namespace dto
+{
+
+/**
+ * @brief Writer for newline-delimited JSON (NDJSON) streams of AnyValue records.
+ *
+ * @details Each record is written as a single line of compact JSON, directly to the underlying
+ * stream. Nothing is buffered by the writer itself, so arbitrarily long sequences of records can
+ * be written with constant memory usage.
+ *
+ * When constructed without a type, every record is written in the reversible format of
+ * AnyValueToJSONString. When constructed with a type, only the values are written (see
+ * ValuesToJSONString) and the type is assumed to be known to the reader of the stream.
+ */
+class JSONAnyValueStreamWriter
+{
+public:
+  /**
+   * @brief Construct a writer that writes self-describing records (type and value).
+   *
+   * @param json_stream Output stream to write to.
+   */
+  explicit JSONAnyValueStreamWriter(std::ostream& json_stream);
+
+  /**
+   * @brief Construct a writer that writes records of a known type as values only.
+   *
+   * @param json_stream Output stream to write to.
+   * @param anytype Type shared by all records.
+   */
+  JSONAnyValueStreamWriter(std::ostream& json_stream, const AnyType& anytype);
+
+  ~JSONAnyValueStreamWriter();
+
+  JSONAnyValueStreamWriter(const JSONAnyValueStreamWriter& other) = delete;
+  JSONAnyValueStreamWriter(JSONAnyValueStreamWriter&& other) = delete;
+  JSONAnyValueStreamWriter& operator=(const JSONAnyValueStreamWriter& other) = delete;
+  JSONAnyValueStreamWriter& operator=(JSONAnyValueStreamWriter&& other) = delete;
+
+  /**
+   * @brief Write a single record, followed by a newline.
+   *
+   * @param anyvalue AnyValue to write.
+   *
+   * @throws SerializeException Thrown when the writer was constructed with a type that differs
+   * from the record's type or when the underlying stream is in a failed state after writing the
+   * record.
+   */
+  void Write(const AnyValue& anyvalue);
+
+  /**
+   * @brief Get the number of records written so far.
+   *
+   * @return Number of records written.
+   */
+  std::size_t NumberOfRecords() const;
+
+private:
+  std::ostream& m_json_stream;
+  AnyType m_anytype;
+  bool m_typed;
+  std::size_t m_n_records;
+};
+
+/**
+ * @brief Reader for newline-delimited JSON (NDJSON) streams of AnyValue records.
+ *
+ * @details Every non-blank line of the stream contains exactly one record. Records are read and
+ * parsed one line at a time, reusing the same line buffer, so memory usage is bounded by the
+ * longest record and streams of any size can be processed. Blank lines are ignored.
+ *
+ * When constructed without a type, every record needs to be in the reversible format of
+ * AnyValueToJSONString. When constructed with a type, the records only contain the values (see
+ * ValuesToJSONString) and are parsed directly into values of the given type, without having to
+ * parse and reconstruct the type for each record.
+ */
+class JSONAnyValueStreamReader
+{
+public:
+  /**
+   * @brief Construct a reader for self-describing records (type and value).
+   *
+   * @param json_stream Input stream to read from.
+   */
+  explicit JSONAnyValueStreamReader(std::istream& json_stream);
+
+  /**
+   * @brief Construct a reader for self-describing records (type and value), using a registry to
+   * resolve type names.
+   *
+   * @param json_stream Input stream to read from.
+   * @param type_registry AnyType registry to use during parsing.
+   */
+  JSONAnyValueStreamReader(std::istream& json_stream, const AnyTypeRegistry* type_registry);
+
+  /**
+   * @brief Construct a reader for value-only records of a known type.
+   *
+   * @param json_stream Input stream to read from.
+   * @param anytype Type shared by all records.
+   */
+  JSONAnyValueStreamReader(std::istream& json_stream, const AnyType& anytype);
+
+  ~JSONAnyValueStreamReader();
+
+  JSONAnyValueStreamReader(const JSONAnyValueStreamReader& other) = delete;
+  JSONAnyValueStreamReader(JSONAnyValueStreamReader&& other) = delete;
+  JSONAnyValueStreamReader& operator=(const JSONAnyValueStreamReader& other) = delete;
+  JSONAnyValueStreamReader& operator=(JSONAnyValueStreamReader&& other) = delete;
+
+  /**
+   * @brief Read the next record from the stream.
+   *
+   * @param anyvalue AnyValue to assign the parsed record to.
+   *
+   * @return true when a record was read, false when the end of the stream was reached.
+   *
+   * @throws ParseException Thrown when the next record could not be parsed. The offending line is
+   * consumed, so reading can continue with the next record.
+   *
+   * @note The record is assigned with move semantics, so the usual assignment rules apply when the
+   * provided AnyValue has a locked type (e.g. it is an array element).
+   */
+  bool ReadNext(AnyValue& anyvalue);
+
+  /**
+   * @brief Get the number of records read so far (including the ones that failed to parse).
+   *
+   * @return Number of records read.
+   */
+  std::size_t NumberOfRecords() const;
+
+private:
+  std::istream& m_json_stream;
+  std::string m_line;
+  const AnyTypeRegistry m_empty_registry;
+  const AnyTypeRegistry* m_type_registry;
+  AnyType m_anytype;
+  bool m_typed;
+  std::size_t m_n_records;
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_JSON_VALUE_STREAM_H_
@@ -23,10 +23,12 @@
 #include "binary_parser_functions.h"
 
 #include "arithmetic_from_bytes_t.h"
+#include "scalar_from_bytes.h"
 
 #include <sup/dto/serialize/binary_tokens.h>
 #include <sup/dto/anyvalue_exceptions.h>
 
+#include <algorithm>
 #include <array>
 #include <functional>
 
@@ -34,6 +36,7 @@ namespace
 {
 using sup::dto::AnyValue;
 using sup::dto::ByteIterator;
+using sup::dto::TypeCode;
 
 template <typename T>
 void AssignBinaryScalarFromLittleEndianOrderT(AnyValue& anyvalue, ByteIterator& it, ByteIterator end)
@@ -63,9 +66,21 @@ void AssignBinaryString(AnyValue& anyvalue, ByteIterator& it, ByteIterator end)
 
 void InvalidAssignFunction(AnyValue&, ByteIterator&, ByteIterator);
 
-const sup::dto::uint32 kMaxScalarCode = 13u;
+constexpr sup::dto::uint32 TypeCodeIndex(TypeCode type_code)
+{
+  return static_cast<sup::dto::uint32>(type_code);
+}
+
+// Largest type code value, so the array below doesn't depend on the order of the enumerators.
+constexpr sup::dto::uint32 kMaxTypeCode = std::max({
+  TypeCodeIndex(TypeCode::Empty), TypeCodeIndex(TypeCode::Bool), TypeCodeIndex(TypeCode::Char8),
+  TypeCodeIndex(TypeCode::Int8), TypeCodeIndex(TypeCode::UInt8), TypeCodeIndex(TypeCode::Int16),
+  TypeCodeIndex(TypeCode::UInt16), TypeCodeIndex(TypeCode::Int32), TypeCodeIndex(TypeCode::UInt32),
+  TypeCodeIndex(TypeCode::Int64), TypeCodeIndex(TypeCode::UInt64), TypeCodeIndex(TypeCode::Float32),
+  TypeCodeIndex(TypeCode::Float64), TypeCodeIndex(TypeCode::String), TypeCodeIndex(TypeCode::Struct),
+  TypeCodeIndex(TypeCode::Array), TypeCodeIndex(TypeCode::FixedString)});
 
-std::array<ScalarParserFunction, kMaxScalarCode + 1> CreateScalarParserFunctionArray();
+std::array<ScalarParserFunction, kMaxTypeCode + 1> CreateScalarParserFunctionArray();
 
 }  // unnamed namespace
 
@@ -121,6 +136,22 @@ void ParseBinaryScalar(AnyValue& anyvalue, ByteIterator& it, ByteIterator end)
   parse_func(anyvalue, it, end);
 }
 
+void ParseBinaryScalar(AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                       ByteIterator& it, ByteIterator end)
+{
+  if (type_code == TypeCode::String || type_code == TypeCode::FixedString)
+  {
+    ParseBinaryScalar(anyvalue, it, end);
+    return;
+  }
+  if (static_cast<std::size_t>(std::distance(it, end)) < width)
+  {
+    throw ParseException("End of byte stream encountered during scalar value parsing");
+  }
+  ReadScalarFromLittleEndianOrder(anyvalue, type_code, width, std::addressof(*it));
+  it += width;
+}
+
 }  // namespace dto
 
 }  // namespace sup
@@ -138,10 +169,10 @@ void InvalidAssignFunction(AnyValue&, ByteIterator&, ByteIterator)
   throw sup::dto::ParseException(error);
 }
 
-std::array<ScalarParserFunction, kMaxScalarCode + 1> CreateScalarParserFunctionArray()
+std::array<ScalarParserFunction, kMaxTypeCode + 1> CreateScalarParserFunctionArray()
 {
-  std::array<ScalarParserFunction, kMaxScalarCode + 1> result;
-  result.at(static_cast<uint32>(TypeCode::Empty)) = InvalidAssignFunction;
+  std::array<ScalarParserFunction, kMaxTypeCode + 1> result;
+  result.fill(InvalidAssignFunction);
   result.at(static_cast<uint32>(TypeCode::Bool)) = GetScalarParserFunction<sup::dto::boolean>();
   result.at(static_cast<uint32>(TypeCode::Char8)) = GetScalarParserFunction<sup::dto::char8>();
   result.at(static_cast<uint32>(TypeCode::Int8)) = GetScalarParserFunction<sup::dto::int8>();
@@ -155,6 +186,7 @@ std::array<ScalarParserFunction, kMaxScalarCode + 1> CreateScalarParserFunctionA
   result.at(static_cast<uint32>(TypeCode::Float32)) = GetScalarParserFunction<sup::dto::float32>();
   result.at(static_cast<uint32>(TypeCode::Float64)) = GetScalarParserFunction<sup::dto::float64>();
   result.at(static_cast<uint32>(TypeCode::String)) = AssignBinaryString;
+  result.at(static_cast<uint32>(TypeCode::FixedString)) = AssignBinaryString;
   return result;
 }
 
@@ -38,6 +38,13 @@ sup::dto::uint64 ParseSize(ByteIterator& it, ByteIterator end);
 
 void ParseBinaryScalar(AnyValue& anyvalue, ByteIterator& it, ByteIterator end);
 
+/**
+ * @brief Parse a scalar with the given type code and C-type width (e.g. from a SerializationPlan).
+ * Arithmetic scalars are assigned directly from the byte stream.
+ */
+void ParseBinaryScalar(AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                       ByteIterator& it, ByteIterator end);
+
 }  // namespace dto
 
 }  // namespace sup
@@ -23,6 +23,7 @@
 #include "binary_serialization_functions.h"
 #include "scalar_to_bytes.h"
 
+#include <sup/dto/anyvalue/leaf_payload_access.h>
 #include <sup/dto/serialize/binary_tokens.h>
 
 #include <sup/dto/anyvalue.h>
@@ -67,7 +68,8 @@ void AppendScalarToken(std::vector<uint8>& representation, const TypeCode& type_
     {TypeCode::UInt64, UINT64_TOKEN },
     {TypeCode::Float32, FLOAT32_TOKEN },
     {TypeCode::Float64, FLOAT64_TOKEN },
-    {TypeCode::String, STRING_TOKEN }
+    {TypeCode::String, STRING_TOKEN },
+    {TypeCode::FixedString, FIXED_STRING_TOKEN }
   };
   const auto it = token_map.find(type_code);
   if (it == token_map.end())
@@ -94,7 +96,8 @@ void AppendSize(std::vector<sup::dto::uint8>& representation, sup::dto::uint64 s
 void AppendBinaryScalar(std::vector<uint8>& representation, const AnyValue& anyvalue)
 {
   // It has to call AppendBinaryStringAnyValue if it's a string
-  if (anyvalue.GetTypeCode() == TypeCode::String)
+  const auto type_code = anyvalue.GetTypeCode();
+  if (type_code == TypeCode::String || type_code == TypeCode::FixedString)
   {
     AppendBinaryStringAnyValue(representation, anyvalue);
   }
@@ -105,6 +108,26 @@ void AppendBinaryScalar(std::vector<uint8>& representation, const AnyValue& anyv
   }
 }
 
+void AppendBinaryScalar(std::vector<uint8>& representation, const AnyValue& anyvalue,
+                        TypeCode type_code, std::size_t width)
+{
+  const auto position = representation.size();
+  if (type_code == TypeCode::String || type_code == TypeCode::FixedString)
+  {
+    const auto str_size = LeafPayloadAccess::StringLength(anyvalue);
+    AppendSize(representation, str_size);
+    // Load the string including its terminating zero, which is dropped afterwards
+    const auto str_position = representation.size();
+    representation.resize(str_position + str_size + 1);
+    LeafPayloadAccess::LoadString(
+      anyvalue, reinterpret_cast<char8*>(representation.data() + str_position), str_size + 1);
+    representation.pop_back();
+    return;
+  }
+  representation.resize(position + width);
+  WriteScalarToLittleEndianOrder(anyvalue, type_code, width, representation.data() + position);
+}
+
 void AppendBinaryString(std::vector<uint8>& representation, const std::string& str)
 {
   representation.push_back(STRING_TOKEN);
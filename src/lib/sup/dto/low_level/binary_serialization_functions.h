@@ -43,6 +43,13 @@ void AppendBinaryString(std::vector<sup::dto::uint8>& representation, const std:
 
 void AppendBinaryScalar(std::vector<sup::dto::uint8>& representation, const AnyValue& anyvalue);
 
+/**
+ * @brief Append the binary representation of a scalar with the given type code and C-type width
+ * (e.g. from a SerializationPlan), writing directly into the representation.
+ */
+void AppendBinaryScalar(std::vector<sup::dto::uint8>& representation, const AnyValue& anyvalue,
+                        TypeCode type_code, std::size_t width);
+
 }  // namespace dto
 
 }  // namespace sup
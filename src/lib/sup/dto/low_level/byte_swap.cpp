@@ -0,0 +1,230 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "byte_swap.h"
+
+#include <cstring>
+#include <memory>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SUP_DTO_BYTE_SWAP_X86
+#include <immintrin.h>
+#endif
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+/**
+ * @brief Shuffle control that reverses the bytes of each value of the given width in a 16-byte
+ * vector.
+ */
+template <std::size_t Width>
+struct ShuffleMask
+{
+  constexpr ShuffleMask()
+    : bytes{}
+  {
+    for (std::size_t idx = 0; idx < sizeof(bytes); ++idx)
+    {
+      bytes[idx] = static_cast<uint8>((idx / Width) * Width + (Width - 1 - idx % Width));
+    }
+  }
+  uint8 bytes[16];
+};
+
+void ByteSwapRunWith(uint8* data, std::size_t n, std::size_t width,
+                     ByteSwapImplementation implementation);
+
+template <typename U>
+void ByteSwapRunT(uint8* data, std::size_t n, ByteSwapImplementation implementation);
+
+// Swap the values in [pos, n_bytes) one by one:
+template <typename U>
+void ByteSwapTail(uint8* data, std::size_t pos, std::size_t n_bytes);
+
+#if defined(SUP_DTO_BYTE_SWAP_X86)
+// The vector kernels swap whole blocks and return the position after the last swapped block:
+template <std::size_t Width>
+__attribute__((target("ssse3"))) std::size_t ByteSwapBlocksSSSE3(uint8* data, std::size_t n_bytes);
+
+template <std::size_t Width>
+__attribute__((target("avx2"))) std::size_t ByteSwapBlocksAVX2(uint8* data, std::size_t n_bytes);
+#endif
+
+ByteSwapImplementation SelectByteSwapImplementation();
+
+}  // unnamed namespace
+
+void ByteSwapRun(uint8* data, std::size_t n, std::size_t width)
+{
+  ByteSwapRunWith(data, n, width, GetByteSwapImplementation());
+}
+
+void ByteSwapRun(uint8* data, std::size_t n, std::size_t width,
+                 ByteSwapImplementation implementation)
+{
+  if (!IsByteSwapImplementationSupported(implementation))
+  {
+    implementation = ByteSwapImplementation::kScalar;
+  }
+  ByteSwapRunWith(data, n, width, implementation);
+}
+
+bool IsByteSwapImplementationSupported(ByteSwapImplementation implementation)
+{
+  switch (implementation)
+  {
+  case ByteSwapImplementation::kScalar:
+    return true;
+#if defined(SUP_DTO_BYTE_SWAP_X86)
+  case ByteSwapImplementation::kSSSE3:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+  case ByteSwapImplementation::kAVX2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+  default:
+    break;
+  }
+  return false;
+}
+
+ByteSwapImplementation GetByteSwapImplementation()
+{
+  static const auto implementation = SelectByteSwapImplementation();
+  return implementation;
+}
+
+namespace
+{
+void ByteSwapRunWith(uint8* data, std::size_t n, std::size_t width,
+                     ByteSwapImplementation implementation)
+{
+  switch (width)
+  {
+  case sizeof(uint16):
+    ByteSwapRunT<uint16>(data, n, implementation);
+    break;
+  case sizeof(uint32):
+    ByteSwapRunT<uint32>(data, n, implementation);
+    break;
+  case sizeof(uint64):
+    ByteSwapRunT<uint64>(data, n, implementation);
+    break;
+  default:
+    break;
+  }
+}
+
+template <typename U>
+void ByteSwapRunT(uint8* data, std::size_t n, ByteSwapImplementation implementation)
+{
+  const auto n_bytes = n * sizeof(U);
+  std::size_t pos = 0;
+#if defined(SUP_DTO_BYTE_SWAP_X86)
+  switch (implementation)
+  {
+  case ByteSwapImplementation::kAVX2:
+    pos = ByteSwapBlocksAVX2<sizeof(U)>(data, n_bytes);
+    break;
+  case ByteSwapImplementation::kSSSE3:
+    pos = ByteSwapBlocksSSSE3<sizeof(U)>(data, n_bytes);
+    break;
+  default:
+    break;
+  }
+#else
+  (void)implementation;
+#endif
+  ByteSwapTail<U>(data, pos, n_bytes);
+}
+
+template <typename U>
+void ByteSwapTail(uint8* data, std::size_t pos, std::size_t n_bytes)
+{
+  for (; pos < n_bytes; pos += sizeof(U))
+  {
+    U val{};
+    (void)std::memcpy(std::addressof(val), data + pos, sizeof(U));
+    val = ByteSwap(val);
+    (void)std::memcpy(data + pos, std::addressof(val), sizeof(U));
+  }
+}
+
+#if defined(SUP_DTO_BYTE_SWAP_X86)
+template <std::size_t Width>
+__attribute__((target("ssse3"))) std::size_t ByteSwapBlocksSSSE3(uint8* data, std::size_t n_bytes)
+{
+  static constexpr ShuffleMask<Width> kMask{};
+  const auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kMask.bytes));
+  std::size_t pos = 0;
+  for (; pos + sizeof(__m128i) <= n_bytes; pos += sizeof(__m128i))
+  {
+    auto* block = reinterpret_cast<__m128i*>(data + pos);
+    _mm_storeu_si128(block, _mm_shuffle_epi8(_mm_loadu_si128(block), mask));
+  }
+  return pos;
+}
+
+template <std::size_t Width>
+__attribute__((target("avx2"))) std::size_t ByteSwapBlocksAVX2(uint8* data, std::size_t n_bytes)
+{
+  static constexpr ShuffleMask<Width> kMask{};
+  const auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kMask.bytes));
+  const auto wide_mask = _mm256_broadcastsi128_si256(mask);
+  std::size_t pos = 0;
+  for (; pos + sizeof(__m256i) <= n_bytes; pos += sizeof(__m256i))
+  {
+    auto* block = reinterpret_cast<__m256i*>(data + pos);
+    _mm256_storeu_si256(block, _mm256_shuffle_epi8(_mm256_loadu_si256(block), wide_mask));
+  }
+  // AVX2 implies SSSE3, so a remaining 16-byte block is swapped with a narrow shuffle
+  for (; pos + sizeof(__m128i) <= n_bytes; pos += sizeof(__m128i))
+  {
+    auto* block = reinterpret_cast<__m128i*>(data + pos);
+    _mm_storeu_si128(block, _mm_shuffle_epi8(_mm_loadu_si128(block), mask));
+  }
+  return pos;
+}
+#endif
+
+ByteSwapImplementation SelectByteSwapImplementation()
+{
+  if (IsByteSwapImplementationSupported(ByteSwapImplementation::kAVX2))
+  {
+    return ByteSwapImplementation::kAVX2;
+  }
+  if (IsByteSwapImplementationSupported(ByteSwapImplementation::kSSSE3))
+  {
+    return ByteSwapImplementation::kSSSE3;
+  }
+  return ByteSwapImplementation::kScalar;
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
@@ -0,0 +1,156 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_BYTE_SWAP_H_
+#define SUP_DTO_BYTE_SWAP_H_
+
+#include <sup/dto/basic_scalar_types.h>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace sup
+{
+namespace dto
+{
+/**
+ * @brief Implementations of the byte swapping kernels.
+ */
+enum class ByteSwapImplementation : sup::dto::uint32
+{
+  kScalar = 0,  // Portable scalar loop
+  kSSSE3,       // 16-byte vector shuffles
+  kAVX2         // 32-byte vector shuffles
+};
+
+/**
+ * @brief Unsigned integer type with the given size in bytes.
+ */
+template <std::size_t Size>
+struct UnsignedOfSize;
+
+template <>
+struct UnsignedOfSize<1>
+{
+  using type = uint8;
+};
+
+template <>
+struct UnsignedOfSize<2>
+{
+  using type = uint16;
+};
+
+template <>
+struct UnsignedOfSize<4>
+{
+  using type = uint32;
+};
+
+template <>
+struct UnsignedOfSize<8>
+{
+  using type = uint64;
+};
+
+/**
+ * @brief Reverse the byte order of a single unsigned integer. These compile to a single byte
+ * swap instruction and are meant for per value swapping, where the runtime dispatch of
+ * ByteSwapRun would dominate.
+ */
+inline uint8 ByteSwap(uint8 val)
+{
+  return val;
+}
+
+inline uint16 ByteSwap(uint16 val)
+{
+  return static_cast<uint16>((val >> 8) | (val << 8));
+}
+
+inline uint32 ByteSwap(uint32 val)
+{
+  return ((val & 0x000000FFu) << 24) | ((val & 0x0000FF00u) << 8) |
+         ((val & 0x00FF0000u) >> 8) | ((val & 0xFF000000u) >> 24);
+}
+
+inline uint64 ByteSwap(uint64 val)
+{
+  return (static_cast<uint64>(ByteSwap(static_cast<uint32>(val))) << 32) |
+         ByteSwap(static_cast<uint32>(val >> 32));
+}
+
+/**
+ * @brief Reverse the byte order of a single arithmetic value, including floating point values.
+ */
+template <typename T>
+T ByteSwapValue(T val)
+{
+  static_assert(std::is_arithmetic<T>::value, "Only arithmetic values can be byte swapped");
+  using U = typename UnsignedOfSize<sizeof(T)>::type;
+  U bits{};
+  (void)std::memcpy(std::addressof(bits), std::addressof(val), sizeof(T));
+  bits = ByteSwap(bits);
+  (void)std::memcpy(std::addressof(val), std::addressof(bits), sizeof(T));
+  return val;
+}
+
+/**
+ * @brief Reverse the byte order of n consecutive values of the given width in place.
+ *
+ * @details Widths of 2, 4 and 8 bytes are swapped with vector shuffles on x86 processors that
+ * support SSSE3 or AVX2, using a scalar loop for the remaining values. The implementation is
+ * selected once at runtime (see GetByteSwapImplementation), so no special compiler flags are
+ * needed. Other widths leave the data untouched.
+ *
+ * @param data Pointer to the first value. No alignment is required.
+ * @param n Number of values.
+ * @param width Width of the values in bytes.
+ */
+void ByteSwapRun(uint8* data, std::size_t n, std::size_t width);
+
+/**
+ * @brief Reverse the byte order of n consecutive values with the given implementation.
+ *
+ * @note Implementations that are not supported by the processor fall back to the scalar loop.
+ */
+void ByteSwapRun(uint8* data, std::size_t n, std::size_t width,
+                 ByteSwapImplementation implementation);
+
+/**
+ * @brief Check if the given implementation can be used on the current processor.
+ */
+bool IsByteSwapImplementationSupported(ByteSwapImplementation implementation);
+
+/**
+ * @brief Get the fastest implementation supported by the current processor, which is used by
+ * ByteSwapRun.
+ */
+ByteSwapImplementation GetByteSwapImplementation();
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_BYTE_SWAP_H_
@@ -0,0 +1,168 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_SCALAR_ARRAY_CONVERSION_H_
+#define SUP_DTO_SCALAR_ARRAY_CONVERSION_H_
+
+#include <sup/dto/low_level/scalar_conversion.h>
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace sup
+{
+namespace dto
+{
+// Number of elements that are range checked together. The constant trip count of the inner loops
+// allows the compiler to vectorize them with the instruction set of the target (e.g. SSE2 or AVX2
+// on x86-64), while the plain loops remain the portable fallback.
+constexpr std::size_t kScalarArrayBlockSize = 64;
+
+// Conversions between arithmetic types that can never fail, i.e. that do not need the range checks
+// of ConvertScalar
+template <typename To, typename From>
+struct IsWideningConversion
+{
+  static constexpr bool value =
+    std::is_same<To, bool>::value || std::is_same<From, bool>::value ||
+    (std::is_floating_point<To>::value && IsStrictlyInteger<From>::value) ||
+    (std::is_floating_point<To>::value && std::is_floating_point<From>::value &&
+     sizeof(To) >= sizeof(From)) ||
+    (IsStrictlyInteger<To>::value && IsStrictlyInteger<From>::value &&
+     ((std::is_signed<To>::value == std::is_signed<From>::value) ? sizeof(To) >= sizeof(From)
+                                                                 : (std::is_signed<To>::value &&
+                                                                    sizeof(To) > sizeof(From))));
+};
+
+template <typename To, typename From>
+constexpr bool IsWideningConversion<To, From>::value;
+
+// Range checks of ConvertScalar for narrowing conversions, without throwing
+template <typename To, typename From,
+  typename std::enable_if<IsSignedInteger<To>::value &&
+                          IsSignedInteger<From>::value, bool>::type = true>
+bool ScalarFits(const From& value)
+{
+  return !(value < std::numeric_limits<To>::min()) && !(value > std::numeric_limits<To>::max());
+}
+
+template <typename To, typename From,
+  typename std::enable_if<IsUnsignedInteger<To>::value &&
+                          IsUnsignedInteger<From>::value, bool>::type = true>
+bool ScalarFits(const From& value)
+{
+  return !(value > std::numeric_limits<To>::max());
+}
+
+template <typename To, typename From,
+  typename std::enable_if<IsUnsignedInteger<To>::value &&
+                          IsSignedInteger<From>::value, bool>::type = true>
+bool ScalarFits(const From& value)
+{
+  return !(value < 0) &&
+    !(static_cast<typename std::make_unsigned<From>::type>(value) > std::numeric_limits<To>::max());
+}
+
+template <typename To, typename From,
+  typename std::enable_if<IsSignedInteger<To>::value &&
+                          IsUnsignedInteger<From>::value, bool>::type = true>
+bool ScalarFits(const From& value)
+{
+  return !(value > static_cast<typename std::make_unsigned<To>::type>(
+                     std::numeric_limits<To>::max()));
+}
+
+template <typename To, typename From,
+  typename std::enable_if<IsStrictlyArithmetic<To>::value &&
+    std::is_floating_point<From>::value, bool>::type = true>
+bool ScalarFits(const From& value)
+{
+  return !(value < static_cast<To>(std::numeric_limits<To>::lowest())) &&
+         !(value > static_cast<To>(std::numeric_limits<To>::max()));
+}
+
+/**
+ * @brief Convert an array of arithmetic values that can never fail.
+ *
+ * @return Number of converted values, i.e. n.
+ */
+template <typename To, typename From,
+  typename std::enable_if<IsWideningConversion<To, From>::value, bool>::type = true>
+std::size_t ConvertScalarArray(To* dest, const From* src, std::size_t n)
+{
+  for (std::size_t idx = 0; idx < n; ++idx)
+  {
+    dest[idx] = static_cast<To>(src[idx]);
+  }
+  return n;
+}
+
+/**
+ * @brief Convert an array of arithmetic values, checking that every value fits into the destination
+ * type, with the same rules as ConvertScalar.
+ *
+ * @details Blocks of values are first range checked as a whole and then converted. Only a block that
+ * contains a value that doesn't fit is checked value by value.
+ *
+ * @return Number of converted values. When this is less than n, it is the index of the first
+ * value that doesn't fit, and none of the following values were converted.
+ */
+template <typename To, typename From,
+  typename std::enable_if<!IsWideningConversion<To, From>::value &&
+                          std::is_arithmetic<To>::value &&
+                          std::is_arithmetic<From>::value, bool>::type = true>
+std::size_t ConvertScalarArray(To* dest, const From* src, std::size_t n)
+{
+  std::size_t first = 0;
+  for (; first + kScalarArrayBlockSize <= n; first += kScalarArrayBlockSize)
+  {
+    bool all_fit = true;
+    for (std::size_t idx = 0; idx < kScalarArrayBlockSize; ++idx)
+    {
+      all_fit = all_fit & ScalarFits<To, From>(src[first + idx]);
+    }
+    if (!all_fit)
+    {
+      break;
+    }
+    for (std::size_t idx = 0; idx < kScalarArrayBlockSize; ++idx)
+    {
+      dest[first + idx] = static_cast<To>(src[first + idx]);
+    }
+  }
+  for (; first < n; ++first)
+  {
+    if (!ScalarFits<To, From>(src[first]))
+    {
+      return first;
+    }
+    dest[first] = static_cast<To>(src[first]);
+  }
+  return n;
+}
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_SCALAR_ARRAY_CONVERSION_H_
@@ -23,10 +23,14 @@
 #include "scalar_from_bytes.h"
 
 #include "arithmetic_from_bytes_t.h"
+#include "byte_swap.h"
+
+#include <sup/dto/anyvalue/leaf_payload_access.h>
 
 #include <sup/dto/anyvalue_exceptions.h>
 
 #include <algorithm>
+#include <cstring>
 #include <map>
 
 namespace
@@ -43,7 +47,7 @@ std::size_t AssignFromHostOrderT(AnyValue& anyvalue, const uint8* bytes, std::si
   }
   auto begin_it = bytes + position;
   auto val = ParseFromHostOrderT<T>(begin_it, bytes + position + sizeof(T));
-  anyvalue = val;
+  anyvalue.AssignScalar(val);
   return position + sizeof(T);
 }
 
@@ -61,8 +65,24 @@ std::size_t AssignFromHostOrderT<std::string>(AnyValue& anyvalue, const uint8* b
   {
     throw ParseException("C-type string is not null-terminated");
   }
-  const std::string val = reinterpret_cast<const char*>(&bytes[position]);
-  anyvalue = val;
+  anyvalue.AssignScalar(reinterpret_cast<const char*>(&bytes[position]));
+  return end_position;
+}
+
+std::size_t AssignFixedStringFromBytes(AnyValue& anyvalue, const uint8* bytes, std::size_t size,
+                                       std::size_t position)
+{
+  auto end_position = position + anyvalue.StringCapacity();
+  if (end_position > size)
+  {
+    throw ParseException("Trying to parse beyond size of byte array");
+  }
+  auto null_pos = std::find(&bytes[position], &bytes[end_position], '\0');
+  if (null_pos == &bytes[end_position])
+  {
+    throw ParseException("C-type string is not null-terminated");
+  }
+  anyvalue.AssignScalar(reinterpret_cast<const char*>(&bytes[position]));
   return end_position;
 }
 
@@ -76,7 +96,7 @@ std::size_t AssignFromLittleEndianOrderT(AnyValue& anyvalue, const uint8* bytes,
   }
   auto begin_it = bytes + position;
   auto val = ParseFromLittleEndianOrderT<T>(begin_it, bytes + position + sizeof(T));
-  anyvalue = val;
+  anyvalue.AssignScalar(val);
   return position + sizeof(T);
 }
 
@@ -90,7 +110,7 @@ std::size_t AssignFromNetworkOrderT(AnyValue& anyvalue, const uint8* bytes, std:
   }
   auto begin_it = bytes + position;
   auto val = ParseFromNetworkOrderT<T>(begin_it, bytes + position + sizeof(T));
-  anyvalue = val;
+  anyvalue.AssignScalar(val);
   return position + sizeof(T);
 }
 
@@ -112,7 +132,8 @@ GetFromHostOrderMap()
           {TypeCode::UInt64, AssignFromHostOrderT<uint64>},
           {TypeCode::Float32, AssignFromHostOrderT<float32>},
           {TypeCode::Float64, AssignFromHostOrderT<float64>},
-          {TypeCode::String, AssignFromHostOrderT<std::string>}};
+          {TypeCode::String, AssignFromHostOrderT<std::string>},
+          {TypeCode::FixedString, AssignFixedStringFromBytes}};
   return map;
 }
 
@@ -134,7 +155,8 @@ GetFromLittleEndianOrderMap()
           {TypeCode::UInt64, AssignFromLittleEndianOrderT<uint64>},
           {TypeCode::Float32, AssignFromLittleEndianOrderT<float32>},
           {TypeCode::Float64, AssignFromLittleEndianOrderT<float64>},
-          {TypeCode::String, AssignFromHostOrderT<std::string>}};
+          {TypeCode::String, AssignFromHostOrderT<std::string>},
+          {TypeCode::FixedString, AssignFixedStringFromBytes}};
   return map;
 }
 
@@ -156,10 +178,82 @@ GetFromNetworkOrderMap()
           {TypeCode::UInt64, AssignFromNetworkOrderT<uint64>},
           {TypeCode::Float32, AssignFromNetworkOrderT<float32>},
           {TypeCode::Float64, AssignFromNetworkOrderT<float64>},
-          {TypeCode::String, AssignFromHostOrderT<std::string>}};
+          {TypeCode::String, AssignFromHostOrderT<std::string>},
+          {TypeCode::FixedString, AssignFixedStringFromBytes}};
   return map;
 }
 
+template <typename T>
+void ReadArithmeticLeafT(AnyValue& anyvalue, const uint8* src, bool swap_bytes)
+{
+  T val{};
+  (void)std::memcpy(std::addressof(val), src, sizeof(T));
+  if (swap_bytes)
+  {
+    val = ByteSwapValue(val);
+  }
+  LeafPayloadAccess::Store(anyvalue, val);
+}
+
+void ReadStringLeaf(AnyValue& anyvalue, std::size_t width, const uint8* src)
+{
+  if (std::memchr(src, 0, width) == nullptr)
+  {
+    throw ParseException("C-type string is not null-terminated");
+  }
+  LeafPayloadAccess::StoreString(anyvalue, reinterpret_cast<const char8*>(src), width);
+}
+
+void ReadScalarLeaf(AnyValue& anyvalue, TypeCode type_code, std::size_t width, const uint8* src,
+                    bool swap_bytes)
+{
+  switch (type_code)
+  {
+  case TypeCode::Bool:
+    ReadArithmeticLeafT<boolean>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::Char8:
+    ReadArithmeticLeafT<char8>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::Int8:
+    ReadArithmeticLeafT<int8>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::UInt8:
+    ReadArithmeticLeafT<uint8>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::Int16:
+    ReadArithmeticLeafT<int16>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::UInt16:
+    ReadArithmeticLeafT<uint16>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::Int32:
+    ReadArithmeticLeafT<int32>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::UInt32:
+    ReadArithmeticLeafT<uint32>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::Int64:
+    ReadArithmeticLeafT<int64>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::UInt64:
+    ReadArithmeticLeafT<uint64>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::Float32:
+    ReadArithmeticLeafT<float32>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::Float64:
+    ReadArithmeticLeafT<float64>(anyvalue, src, swap_bytes);
+    break;
+  case TypeCode::String:
+  case TypeCode::FixedString:
+    ReadStringLeaf(anyvalue, width, src);
+    break;
+  default:
+    throw ParseException("ReadScalar: unknown scalar type code");
+  }
+}
+
 }  // unnamed namespace
 
 namespace sup
@@ -204,6 +298,24 @@ std::size_t AssignFromNetworkOrder(AnyValue& anyvalue, const uint8* bytes, std::
   return it->second(anyvalue, bytes, size, position);
 }
 
+void ReadScalarFromHostOrder(AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                             const uint8* src)
+{
+  ReadScalarLeaf(anyvalue, type_code, width, src, false);
+}
+
+void ReadScalarFromLittleEndianOrder(AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                                     const uint8* src)
+{
+  ReadScalarLeaf(anyvalue, type_code, width, src, !IsLittleEndian());
+}
+
+void ReadScalarFromNetworkOrder(AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                                const uint8* src)
+{
+  ReadScalarLeaf(anyvalue, type_code, width, src, IsLittleEndian());
+}
+
 }  // namespace dto
 
 }  // namespace sup
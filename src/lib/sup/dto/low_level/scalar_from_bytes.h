@@ -39,6 +39,24 @@ std::size_t AssignFromLittleEndianOrder(AnyValue& anyvalue, const uint8* bytes,
 std::size_t AssignFromNetworkOrder(AnyValue& anyvalue, const uint8* bytes, std::size_t size,
                                    std::size_t position);
 
+/**
+ * @brief Read a scalar from its C-type representation of width bytes.
+ *
+ * @details Mirror image of WriteScalarToHostOrder and friends: the type code and width of the
+ * scalar are passed explicitly, so that the leaf is assigned without map lookups or intermediate
+ * buffers. The caller is responsible for checking that width bytes are available.
+ *
+ * @throws ParseException Thrown when a string is not zero-terminated.
+ */
+void ReadScalarFromHostOrder(AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                             const uint8* src);
+
+void ReadScalarFromLittleEndianOrder(AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                                     const uint8* src);
+
+void ReadScalarFromNetworkOrder(AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                                const uint8* src);
+
 }  // namespace dto
 
 }  // namespace sup
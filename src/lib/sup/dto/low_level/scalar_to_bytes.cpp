@@ -22,6 +22,9 @@
 
 #include "scalar_to_bytes.h"
 #include "arithmetic_to_bytes_t.h"
+#include "byte_swap.h"
+
+#include <sup/dto/anyvalue/leaf_payload_access.h>
 
 #include <sup/dto/anyvalue.h>
 #include <sup/dto/anyvalue_exceptions.h>
@@ -54,6 +57,20 @@ std::vector<uint8> ScalarToHostOrderT<std::string>(const AnyValue& anyvalue)
   return result;
 }
 
+std::vector<uint8> FixedStringToBytes(const AnyValue& anyvalue)
+{
+  auto str = anyvalue.As<std::string>();
+  auto size = str.size();
+  const auto capacity = anyvalue.StringCapacity();
+  if ((size + 1) > capacity)
+  {
+    throw SerializeException("Strings should not exceed capacity for C-type casting");
+  }
+  std::vector<uint8> result(capacity, 0);
+  (void)std::memcpy(result.data(), str.data(), size);
+  return result;
+}
+
 template <typename T>
 std::vector<uint8> ScalarToLittleEndianOrderT(const AnyValue& anyvalue)
 {
@@ -84,7 +101,8 @@ GetToHostOrderMap()
     {TypeCode::UInt64, ScalarToHostOrderT<uint64> },
     {TypeCode::Float32, ScalarToHostOrderT<float32> },
     {TypeCode::Float64, ScalarToHostOrderT<float64> },
-    {TypeCode::String, ScalarToHostOrderT<std::string> }
+    {TypeCode::String, ScalarToHostOrderT<std::string> },
+    {TypeCode::FixedString, FixedStringToBytes }
   };
   return map;
 }
@@ -105,7 +123,8 @@ GetToLittleEndianOrderMap()
     {TypeCode::UInt64, ScalarToLittleEndianOrderT<uint64> },
     {TypeCode::Float32, ScalarToLittleEndianOrderT<float32> },
     {TypeCode::Float64, ScalarToLittleEndianOrderT<float64> },
-    {TypeCode::String, ScalarToHostOrderT<std::string> }
+    {TypeCode::String, ScalarToHostOrderT<std::string> },
+    {TypeCode::FixedString, FixedStringToBytes }
   };
   return map;
 }
@@ -126,11 +145,83 @@ GetToNetworkOrderMap()
     {TypeCode::UInt64, ScalarToNetworkOrderT<uint64> },
     {TypeCode::Float32, ScalarToNetworkOrderT<float32> },
     {TypeCode::Float64, ScalarToNetworkOrderT<float64> },
-    {TypeCode::String, ScalarToHostOrderT<std::string> }
+    {TypeCode::String, ScalarToHostOrderT<std::string> },
+    {TypeCode::FixedString, FixedStringToBytes }
   };
   return map;
 }
 
+template <typename T>
+void WriteArithmeticLeafT(const AnyValue& anyvalue, uint8* dest, bool swap_bytes)
+{
+  T val{};
+  LeafPayloadAccess::Load(anyvalue, val);
+  if (swap_bytes)
+  {
+    val = ByteSwapValue(val);
+  }
+  (void)std::memcpy(dest, std::addressof(val), sizeof(T));
+}
+
+void WriteStringLeaf(const AnyValue& anyvalue, std::size_t width, uint8* dest)
+{
+  if ((LeafPayloadAccess::StringLength(anyvalue) + 1) > width)
+  {
+    throw SerializeException("Strings should not exceed max length for C-type casting");
+  }
+  LeafPayloadAccess::LoadString(anyvalue, reinterpret_cast<char8*>(dest), width);
+}
+
+void WriteScalarLeaf(const AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                     uint8* dest, bool swap_bytes)
+{
+  switch (type_code)
+  {
+  case TypeCode::Bool:
+    WriteArithmeticLeafT<boolean>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::Char8:
+    WriteArithmeticLeafT<char8>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::Int8:
+    WriteArithmeticLeafT<int8>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::UInt8:
+    WriteArithmeticLeafT<uint8>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::Int16:
+    WriteArithmeticLeafT<int16>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::UInt16:
+    WriteArithmeticLeafT<uint16>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::Int32:
+    WriteArithmeticLeafT<int32>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::UInt32:
+    WriteArithmeticLeafT<uint32>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::Int64:
+    WriteArithmeticLeafT<int64>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::UInt64:
+    WriteArithmeticLeafT<uint64>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::Float32:
+    WriteArithmeticLeafT<float32>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::Float64:
+    WriteArithmeticLeafT<float64>(anyvalue, dest, swap_bytes);
+    break;
+  case TypeCode::String:
+  case TypeCode::FixedString:
+    WriteStringLeaf(anyvalue, width, dest);
+    break;
+  default:
+    throw SerializeException("Not a known scalar type code");
+  }
+}
+
 }  // unnamed namespace
 
 namespace sup
@@ -173,6 +264,24 @@ std::vector<uint8> ScalarToNetworkOrder(const AnyValue& anyvalue)
   return it->second(anyvalue);
 }
 
+void WriteScalarToHostOrder(const AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                            uint8* dest)
+{
+  WriteScalarLeaf(anyvalue, type_code, width, dest, false);
+}
+
+void WriteScalarToLittleEndianOrder(const AnyValue& anyvalue, TypeCode type_code,
+                                    std::size_t width, uint8* dest)
+{
+  WriteScalarLeaf(anyvalue, type_code, width, dest, !IsLittleEndian());
+}
+
+void WriteScalarToNetworkOrder(const AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                               uint8* dest)
+{
+  WriteScalarLeaf(anyvalue, type_code, width, dest, IsLittleEndian());
+}
+
 }  // namespace dto
 
 }  // namespace sup
@@ -23,6 +23,7 @@
 #ifndef SUP_DTO_SCALAR_TO_BYTES_H_
 #define SUP_DTO_SCALAR_TO_BYTES_H_
 
+#include <sup/dto/anytype.h>
 #include <sup/dto/basic_scalar_types.h>
 
 #include <vector>
@@ -39,6 +40,26 @@ std::vector<uint8> ScalarToLittleEndianOrder(const AnyValue& anyvalue);
 
 std::vector<uint8> ScalarToNetworkOrder(const AnyValue& anyvalue);
 
+/**
+ * @brief Write the C-type representation of a scalar directly into the destination, which needs
+ * to hold width bytes.
+ *
+ * @details The type code and width of the scalar are passed explicitly (e.g. from a
+ * SerializationPlan), so that the representation is written without map lookups or intermediate
+ * buffers.
+ *
+ * @throws SerializeException Thrown when a string does not fit in width bytes, including its
+ * terminating zero.
+ */
+void WriteScalarToHostOrder(const AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                            uint8* dest);
+
+void WriteScalarToLittleEndianOrder(const AnyValue& anyvalue, TypeCode type_code,
+                                    std::size_t width, uint8* dest);
+
+void WriteScalarToNetworkOrder(const AnyValue& anyvalue, TypeCode type_code, std::size_t width,
+                               uint8* dest);
+
 }  // namespace dto
 
 }  // namespace sup
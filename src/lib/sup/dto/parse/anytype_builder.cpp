@@ -32,9 +32,12 @@ namespace dto
 {
 
 AnyTypeBuilder::AnyTypeBuilder(const AnyTypeRegistry* anytype_registry)
-  : m_root{std::make_unique<AnyTypeRootBuildNode>(anytype_registry)}
+  : m_arena{}
+  , m_root{std::make_unique<AnyTypeRootBuildNode>(anytype_registry)}
   , m_current{m_root.get()}
-{}
+{
+  m_root->SetArena(&m_arena);
+}
 
 AnyTypeBuilder::~AnyTypeBuilder() = default;
 
@@ -90,8 +93,7 @@ bool AnyTypeBuilder::RawNumber(const char*, std::size_t, bool)
 
 bool AnyTypeBuilder::String(const char* str, std::size_t length, bool)
 {
-  const std::string arg(str, length);
-  return m_current->String(arg);
+  return m_current->String(std::string_view{str, length});
 }
 
 bool AnyTypeBuilder::StartObject()
@@ -102,8 +104,7 @@ bool AnyTypeBuilder::StartObject()
 
 bool AnyTypeBuilder::Key(const char* str, std::size_t length, bool)
 {
-  const std::string arg(str, length);
-  return m_current->Member(arg);
+  return m_current->Member(std::string_view{str, length});
 }
 
 bool AnyTypeBuilder::EndObject(std::size_t)
@@ -23,6 +23,8 @@
 #ifndef SUP_DTO_ANYTYPE_BUILDER_H_
 #define SUP_DTO_ANYTYPE_BUILDER_H_
 
+#include <sup/dto/parse/build_node_arena.h>
+
 #include <sup/dto/anytype.h>
 #include <sup/dto/basic_scalar_types.h>
 
@@ -65,6 +67,7 @@ public:
   bool EndArray(std::size_t elementCount);
 
 private:
+  BuildNodeArena m_arena;
   std::unique_ptr<AnyTypeRootBuildNode> m_root;
   IAnyBuildNode* m_current;
 };
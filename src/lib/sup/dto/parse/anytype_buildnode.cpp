@@ -45,6 +45,7 @@ AnyTypeBuildNode::AnyTypeBuildNode(const AnyTypeRegistry* anytype_registry,
   , m_array_type{false}
   , m_type_name{}
   , m_number_elements{}
+  , m_string_capacity{0}
   , m_member_types{}
   , m_element_type{}
 {}
@@ -73,17 +74,23 @@ bool AnyTypeBuildNode::Int64(int64 i)
 
 bool AnyTypeBuildNode::Uint64(uint64 u)
 {
+  if (m_current_member_name == serialization::CAPACITY_KEY)
+  {
+    m_current_member_name.clear();
+    m_string_capacity = u;
+    return true;
+  }
   if (m_current_member_name != serialization::MULTIPLICITY_KEY)
   {
     throw ParseException(
-        "AnyTypeBuildNode::Uint64 must be called after \"multiplicity\" key");
+        "AnyTypeBuildNode::Uint64 must be called after \"multiplicity\" or \"capacity\" key");
   }
   m_current_member_name.clear();
   m_number_elements = u;
   return true;
 }
 
-bool AnyTypeBuildNode::String(const std::string& str)
+bool AnyTypeBuildNode::String(std::string_view str)
 {
   if (m_current_member_name != serialization::TYPE_KEY)
   {
@@ -95,7 +102,7 @@ bool AnyTypeBuildNode::String(const std::string& str)
   return true;
 }
 
-bool AnyTypeBuildNode::Member(const std::string& str)
+bool AnyTypeBuildNode::Member(std::string_view str)
 {
   m_current_member_name = str;
   return true;
@@ -110,7 +117,7 @@ IAnyBuildNode* AnyTypeBuildNode::GetStructureNode()
         "empty child nodes");
   }
   m_array_type = true;
-  m_element_node = std::make_unique<AnyTypeBuildNode>(GetTypeRegistry(), this);
+  m_element_node = CreateBuildNode<AnyTypeBuildNode>(GetArena(), GetTypeRegistry(), this);
   return m_element_node.get();
 }
 
@@ -123,7 +130,8 @@ IAnyBuildNode* AnyTypeBuildNode::GetArrayNode()
         "empty child nodes");
   }
   m_struct_type = true;
-  m_member_array_node = std::make_unique<MemberTypeArrayBuildNode>(GetTypeRegistry(), this);
+  m_member_array_node =
+      CreateBuildNode<MemberTypeArrayBuildNode>(GetArena(), GetTypeRegistry(), this);
   return m_member_array_node.get();
 }
 
@@ -153,6 +161,10 @@ AnyType AnyTypeBuildNode::GetAnyType()
   {
     return GetArrayType();
   }
+  if (m_type_name == kFixedStringTypeName)
+  {
+    return GetFixedStringType();
+  }
   return GetTypeFromRegistry();
 }
 
@@ -176,6 +188,16 @@ AnyType AnyTypeBuildNode::GetArrayType()
   return AnyType(m_number_elements, std::move(m_element_type), m_type_name);
 }
 
+AnyType AnyTypeBuildNode::GetFixedStringType() const
+{
+  if (m_string_capacity == 0)
+  {
+    throw ParseException(
+      "AnyTypeBuildNode::GetFixedStringType called without a non-zero \"capacity\"");
+  }
+  return FixedStringType(m_string_capacity);
+}
+
 AnyType AnyTypeBuildNode::GetTypeFromRegistry() const
 {
   try
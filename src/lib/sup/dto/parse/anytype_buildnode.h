@@ -23,6 +23,7 @@
 #ifndef SUP_DTO_ANYTYPE_BUILDNODE_H_
 #define SUP_DTO_ANYTYPE_BUILDNODE_H_
 
+#include <sup/dto/parse/build_node_arena.h>
 #include <sup/dto/parse/i_any_buildnode.h>
 
 #include <sup/dto/anytype.h>
@@ -53,8 +54,8 @@ public:
   bool Uint32(uint32 u) override;
   bool Int64(int64 i) override;
   bool Uint64(uint64 u) override;
-  bool String(const std::string& str) override;
-  bool Member(const std::string& str) override;
+  bool String(std::string_view str) override;
+  bool Member(std::string_view str) override;
 
   IAnyBuildNode* GetStructureNode() override;
   IAnyBuildNode* GetArrayNode() override;
@@ -67,14 +68,16 @@ private:
   bool IsComplexType() const;
   AnyType GetStructuredType();
   AnyType GetArrayType();
+  AnyType GetFixedStringType() const;
   AnyType GetTypeFromRegistry() const;
-  std::unique_ptr<AnyTypeBuildNode> m_element_node;
-  std::unique_ptr<MemberTypeArrayBuildNode> m_member_array_node;
+  BuildNodePtr<AnyTypeBuildNode> m_element_node;
+  BuildNodePtr<MemberTypeArrayBuildNode> m_member_array_node;
   std::string m_current_member_name;
   bool m_struct_type;  // true if structure
   bool m_array_type;  // true if array
   std::string m_type_name;
   std::size_t m_number_elements;
+  std::size_t m_string_capacity;  // zero if not present
   std::vector<std::pair<std::string, AnyType>> m_member_types;
   AnyType m_element_type;
 };
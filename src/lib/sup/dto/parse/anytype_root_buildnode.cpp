@@ -51,7 +51,7 @@ IAnyBuildNode* AnyTypeRootBuildNode::GetStructureNode()
     throw ParseException(
         "AnyTypeRootBuildNode::GetStructureNode must be called with empty child node");
   }
-  m_type_node = std::make_unique<AnyTypeBuildNode>(GetTypeRegistry(), this);
+  m_type_node = CreateBuildNode<AnyTypeBuildNode>(GetArena(), GetTypeRegistry(), this);
   return m_type_node.get();
 }
 
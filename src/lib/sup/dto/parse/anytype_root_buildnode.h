@@ -23,6 +23,7 @@
 #ifndef SUP_DTO_ANYTYPE_ROOT_BUILDNODE_H_
 #define SUP_DTO_ANYTYPE_ROOT_BUILDNODE_H_
 
+#include <sup/dto/parse/build_node_arena.h>
 #include <sup/dto/parse/i_any_buildnode.h>
 
 #include <sup/dto/anytype.h>
@@ -55,7 +56,7 @@ public:
   AnyType MoveAnyType();
 
 private:
-  std::unique_ptr<AnyTypeBuildNode> m_type_node;
+  BuildNodePtr<AnyTypeBuildNode> m_type_node;
   AnyType m_anytype;
 };
 
@@ -25,6 +25,7 @@
 #include <sup/dto/parse/anyvalue_encodingelement_buildnode.h>
 #include <sup/dto/parse/anyvalue_typeelement_buildnode.h>
 #include <sup/dto/parse/anyvalue_valueelement_buildnode.h>
+#include <sup/dto/parse/field_projection.h>
 
 #include <sup/dto/anyvalue_exceptions.h>
 
@@ -35,10 +36,17 @@ namespace dto
 
 AnyValueArrayBuildNode::AnyValueArrayBuildNode(const AnyTypeRegistry* anytype_registry,
                                                IAnyBuildNode* parent)
+  : AnyValueArrayBuildNode{anytype_registry, parent, nullptr}
+{}
+
+AnyValueArrayBuildNode::AnyValueArrayBuildNode(const AnyTypeRegistry* anytype_registry,
+                                               IAnyBuildNode* parent,
+                                               const FieldProjection* projection)
   : IAnyBuildNode(anytype_registry, parent)
   , m_encoding_node{}
   , m_type_node{}
   , m_value_node{}
+  , m_projection{projection}
   , m_processed_nodes{}
   , m_anyvalue{}
 {}
@@ -56,13 +64,17 @@ IAnyBuildNode* AnyValueArrayBuildNode::GetStructureNode()
   switch (m_processed_nodes)
   {
   case 0:
-    m_encoding_node = std::make_unique<AnyValueEncodingElementBuildNode>(GetTypeRegistry(), this);
+    m_encoding_node =
+        CreateBuildNode<AnyValueEncodingElementBuildNode>(GetArena(), GetTypeRegistry(), this);
     return m_encoding_node.get();
   case 1:
-    m_type_node = std::make_unique<AnyValueTypeElementBuildNode>(GetTypeRegistry(), this);
+    m_type_node =
+        CreateBuildNode<AnyValueTypeElementBuildNode>(GetArena(), GetTypeRegistry(), this);
     return m_type_node.get();
   case 2:
-    m_value_node = std::make_unique<AnyValueValueElementBuildNode>(GetTypeRegistry(), this, m_anyvalue);
+    m_value_node =
+        CreateBuildNode<AnyValueValueElementBuildNode>(GetArena(), GetTypeRegistry(), this,
+                                                       m_anyvalue);
     return m_value_node.get();
   default:
     throw ParseException(
@@ -90,7 +102,9 @@ bool AnyValueArrayBuildNode::PopStructureNode()
           "AnyValueArrayBuildNode::PopStructureNode called second time with empty type node");
     }
     {
-      m_anyvalue = AnyValue(m_type_node->MoveAnyType());
+      const auto anytype = m_type_node->MoveAnyType();
+      m_anyvalue = (m_projection == nullptr) ? AnyValue(anytype)
+                                             : AnyValue(m_projection->ProjectType(anytype));
     }
     m_type_node.reset();
     break;
@@ -23,6 +23,7 @@
 #ifndef SUP_DTO_ANYVALUE_ARRAY_BUILDNODE_H_
 #define SUP_DTO_ANYVALUE_ARRAY_BUILDNODE_H_
 
+#include <sup/dto/parse/build_node_arena.h>
 #include <sup/dto/parse/i_any_buildnode.h>
 
 #include <sup/dto/anyvalue.h>
@@ -34,6 +35,7 @@ namespace sup
 namespace dto
 {
 class AnyValueEncodingElementBuildNode;
+class FieldProjection;
 class AnyValueTypeElementBuildNode;
 class AnyValueValueElementBuildNode;
 
@@ -41,6 +43,9 @@ class AnyValueArrayBuildNode : public IAnyBuildNode
 {
 public:
   AnyValueArrayBuildNode(const AnyTypeRegistry* anytype_registry, IAnyBuildNode* parent);
+  // Only create the fields selected by the projection (if not null).
+  AnyValueArrayBuildNode(const AnyTypeRegistry* anytype_registry, IAnyBuildNode* parent,
+                         const FieldProjection* projection);
   ~AnyValueArrayBuildNode() override;
 
   AnyValueArrayBuildNode(const AnyValueArrayBuildNode& other) = delete;
@@ -55,9 +60,10 @@ public:
   AnyValue MoveAnyValue();
 
 private:
-  std::unique_ptr<AnyValueEncodingElementBuildNode> m_encoding_node;
-  std::unique_ptr<AnyValueTypeElementBuildNode> m_type_node;
-  std::unique_ptr<AnyValueValueElementBuildNode> m_value_node;
+  BuildNodePtr<AnyValueEncodingElementBuildNode> m_encoding_node;
+  BuildNodePtr<AnyValueTypeElementBuildNode> m_type_node;
+  BuildNodePtr<AnyValueValueElementBuildNode> m_value_node;
+  const FieldProjection* m_projection;
   sup::dto::uint64 m_processed_nodes;
   AnyValue m_anyvalue;
 };
@@ -32,10 +32,18 @@ namespace dto
 {
 
 AnyValueBuilder::AnyValueBuilder(const AnyTypeRegistry* anytype_registry)
-  : m_root{std::make_unique<AnyValueRootBuildNode>(anytype_registry)}
-  , m_current{m_root.get()}
+  : AnyValueBuilder{anytype_registry, nullptr}
 {}
 
+AnyValueBuilder::AnyValueBuilder(const AnyTypeRegistry* anytype_registry,
+                                 const FieldProjection* projection)
+  : m_arena{}
+  , m_root{std::make_unique<AnyValueRootBuildNode>(anytype_registry, nullptr, projection)}
+  , m_current{m_root.get()}
+{
+  m_root->SetArena(&m_arena);
+}
+
 AnyValueBuilder::~AnyValueBuilder() = default;
 
 AnyValue AnyValueBuilder::MoveAnyValue()
@@ -83,15 +91,14 @@ bool AnyValueBuilder::Double(float64 d)
   return m_current->Double(d);
 }
 
-bool AnyValueBuilder::RawNumber(const char*, std::size_t, bool)
+bool AnyValueBuilder::RawNumber(const char* str, std::size_t length, bool)
 {
-  throw ParseException("AnyValueBuilder::RawNumber not supported");
+  return m_current->RawNumber(str, length);
 }
 
 bool AnyValueBuilder::String(const char* str, std::size_t length, bool)
 {
-  const std::string arg(str, length);
-  return m_current->String(arg);
+  return m_current->String(std::string_view{str, length});
 }
 
 bool AnyValueBuilder::StartObject()
@@ -102,8 +109,7 @@ bool AnyValueBuilder::StartObject()
 
 bool AnyValueBuilder::Key(const char* str, std::size_t length, bool)
 {
-  const std::string arg(str, length);
-  return m_current->Member(arg);
+  return m_current->Member(std::string_view{str, length});
 }
 
 bool AnyValueBuilder::EndObject(std::size_t)
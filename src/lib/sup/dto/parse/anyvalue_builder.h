@@ -23,6 +23,8 @@
 #ifndef SUP_DTO_ANYVALUE_BUILDER_H_
 #define SUP_DTO_ANYVALUE_BUILDER_H_
 
+#include <sup/dto/parse/build_node_arena.h>
+
 #include <sup/dto/anyvalue.h>
 #include <sup/dto/basic_scalar_types.h>
 
@@ -34,12 +36,15 @@ namespace dto
 {
 class AnyTypeRegistry;
 class AnyValueRootBuildNode;
+class FieldProjection;
 class IAnyBuildNode;
 
 class AnyValueBuilder
 {
 public:
   explicit AnyValueBuilder(const AnyTypeRegistry* anytype_registry);
+  // Build the value with only the fields selected by the projection (if not null).
+  AnyValueBuilder(const AnyTypeRegistry* anytype_registry, const FieldProjection* projection);
   ~AnyValueBuilder();
 
   AnyValueBuilder(const AnyValueBuilder& other) = delete;
@@ -65,6 +70,7 @@ public:
   bool EndArray(std::size_t);
 
 private:
+  BuildNodeArena m_arena;
   std::unique_ptr<AnyValueRootBuildNode> m_root;
   IAnyBuildNode* m_current;
 };
@@ -22,6 +22,7 @@
 
 #include "anyvalue_buildnode.h"
 
+#include <sup/dto/json/json_number.h>
 #include <sup/dto/parse/arrayvalue_buildnode.h>
 
 #include <sup/dto/anyvalue_exceptions.h>
@@ -126,19 +127,32 @@ bool AnyValueBuildNode::Double(float64 d)
   return true;
 }
 
-bool AnyValueBuildNode::String(const std::string& str)
+bool AnyValueBuildNode::RawNumber(const char* str, std::size_t length)
+{
+  if (m_member_name.empty())
+  {
+    throw ParseException(
+        "AnyValueBuildNode::RawNumber must be called after member name");
+  }
+  auto& member_value = m_anyvalue[m_member_name];
+  AssignJSONNumber(member_value, member_value.GetTypeCode(), str, length);
+  m_member_name.clear();
+  return true;
+}
+
+bool AnyValueBuildNode::String(std::string_view str)
 {
   if (m_member_name.empty())
   {
     throw ParseException(
         "AnyValueBuildNode::String must be called after member name");
   }
-  m_anyvalue[m_member_name].ConvertFrom(str);
+  m_anyvalue[m_member_name].ConvertFrom(std::string{str});
   m_member_name.clear();
   return true;
 }
 
-bool AnyValueBuildNode::Member(const std::string& str)
+bool AnyValueBuildNode::Member(std::string_view str)
 {
   if ((!m_member_name.empty()) || (str.empty()))
   {
@@ -158,7 +172,9 @@ IAnyBuildNode* AnyValueBuildNode::GetStructureNode()
         "AnyValueBuildNode::GetStructureNode must be called with non-empty member name "
         "and empty child node");
   }
-  m_value_node = std::make_unique<AnyValueBuildNode>(GetTypeRegistry(), this, m_anyvalue[m_member_name]);
+  m_value_node =
+      CreateBuildNode<AnyValueBuildNode>(GetArena(), GetTypeRegistry(), this,
+                                         m_anyvalue[m_member_name]);
   return m_value_node.get();
 }
 
@@ -23,6 +23,7 @@
 #ifndef SUP_DTO_ANYVALUE_BUILDNODE_H_
 #define SUP_DTO_ANYVALUE_BUILDNODE_H_
 
+#include <sup/dto/parse/build_node_arena.h>
 #include <sup/dto/parse/i_any_buildnode.h>
 
 #include <sup/dto/anyvalue.h>
@@ -52,8 +53,9 @@ public:
   bool Int64(int64 i) override;
   bool Uint64(uint64 u) override;
   bool Double(float64 d) override;
-  bool String(const std::string& str) override;
-  bool Member(const std::string& str) override;
+  bool RawNumber(const char* str, std::size_t length) override;
+  bool String(std::string_view str) override;
+  bool Member(std::string_view str) override;
 
   IAnyBuildNode* GetStructureNode() override;
   IAnyBuildNode* GetArrayNode() override;
@@ -61,8 +63,8 @@ public:
   bool PopArrayNode() override;
 
 private:
-  std::unique_ptr<AnyValueBuildNode> m_value_node;
-  std::unique_ptr<IAnyBuildNode> m_array_node;
+  BuildNodePtr<AnyValueBuildNode> m_value_node;
+  BuildNodePtr<IAnyBuildNode> m_array_node;
   std::string m_member_name;
   AnyValue& m_anyvalue;
 };
@@ -42,7 +42,7 @@ AnyValueEncodingElementBuildNode::AnyValueEncodingElementBuildNode(
 
 AnyValueEncodingElementBuildNode::~AnyValueEncodingElementBuildNode() = default;
 
-bool AnyValueEncodingElementBuildNode::String(const std::string& str)
+bool AnyValueEncodingElementBuildNode::String(std::string_view str)
 {
   if ((m_member_name.empty()) || (str != serialization::JSON_ENCODING_1_0))
   {
@@ -55,7 +55,7 @@ bool AnyValueEncodingElementBuildNode::String(const std::string& str)
   return true;
 }
 
-bool AnyValueEncodingElementBuildNode::Member(const std::string& str)
+bool AnyValueEncodingElementBuildNode::Member(std::string_view str)
 {
   if (((str != serialization::ENCODING_KEY) || (!m_member_name.empty())) || m_encoding_ok)
   {
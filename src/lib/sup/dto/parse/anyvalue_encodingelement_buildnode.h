@@ -47,8 +47,8 @@ public:
   AnyValueEncodingElementBuildNode& operator=(AnyValueEncodingElementBuildNode&& other) = delete;
 
 
-  bool String(const std::string& str) override;
-  bool Member(const std::string& str) override;
+  bool String(std::string_view str) override;
+  bool Member(std::string_view str) override;
 
   bool EncodingOK() const;
 
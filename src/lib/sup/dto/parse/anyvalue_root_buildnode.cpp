@@ -32,14 +32,21 @@ namespace dto
 {
 
 AnyValueRootBuildNode::AnyValueRootBuildNode(const AnyTypeRegistry* anytype_registry,
-                                             IAnyBuildNode* parent)
+                                             IAnyBuildNode* parent,
+                                             const FieldProjection* projection)
   : IAnyBuildNode(anytype_registry, parent)
+  , m_projection{projection}
   , m_array_node{}
   , m_anyvalue{}
 {}
 
+AnyValueRootBuildNode::AnyValueRootBuildNode(const AnyTypeRegistry* anytype_registry,
+                                             IAnyBuildNode* parent)
+  : AnyValueRootBuildNode{anytype_registry, parent, nullptr}
+{}
+
 AnyValueRootBuildNode::AnyValueRootBuildNode(const AnyTypeRegistry* anytype_registry)
-  : AnyValueRootBuildNode{anytype_registry, nullptr}
+  : AnyValueRootBuildNode{anytype_registry, nullptr, nullptr}
 {}
 
 AnyValueRootBuildNode::~AnyValueRootBuildNode() = default;
@@ -51,7 +58,8 @@ IAnyBuildNode* AnyValueRootBuildNode::GetArrayNode()
     throw ParseException(
       "AnyValueRootBuildNode::GetArrayNode must be called with empty child node");
   }
-  m_array_node = std::make_unique<AnyValueArrayBuildNode>(GetTypeRegistry(), this);
+  m_array_node =
+      CreateBuildNode<AnyValueArrayBuildNode>(GetArena(), GetTypeRegistry(), this, m_projection);
   return m_array_node.get();
 }
 
@@ -23,6 +23,7 @@
 #ifndef SUP_DTO_ANYVALUE_ROOT_BUILDNODE_H_
 #define SUP_DTO_ANYVALUE_ROOT_BUILDNODE_H_
 
+#include <sup/dto/parse/build_node_arena.h>
 #include <sup/dto/parse/i_any_buildnode.h>
 #include <sup/dto/anyvalue.h>
 
@@ -33,12 +34,16 @@ namespace sup
 namespace dto
 {
 class AnyValueArrayBuildNode;
+class FieldProjection;
 
 class AnyValueRootBuildNode : public IAnyBuildNode
 {
 public:
   AnyValueRootBuildNode(const AnyTypeRegistry* anytype_registry, IAnyBuildNode* parent);
   explicit AnyValueRootBuildNode(const AnyTypeRegistry* anytype_registry);
+  // Only create the fields selected by the projection (if not null).
+  AnyValueRootBuildNode(const AnyTypeRegistry* anytype_registry, IAnyBuildNode* parent,
+                        const FieldProjection* projection);
 
   ~AnyValueRootBuildNode() override;
 
@@ -54,7 +59,8 @@ public:
   AnyValue MoveAnyValue();
 
 private:
-  std::unique_ptr<AnyValueArrayBuildNode> m_array_node;
+  const FieldProjection* m_projection;
+  BuildNodePtr<AnyValueArrayBuildNode> m_array_node;
   AnyValue m_anyvalue;
 };
 
@@ -42,7 +42,7 @@ AnyValueTypeElementBuildNode::AnyValueTypeElementBuildNode(
 
 AnyValueTypeElementBuildNode::~AnyValueTypeElementBuildNode() = default;
 
-bool AnyValueTypeElementBuildNode::Member(const std::string& str)
+bool AnyValueTypeElementBuildNode::Member(std::string_view str)
 {
   if ((!m_member_name.empty()) || (str != serialization::DATATYPE_KEY))
   {
@@ -61,7 +61,7 @@ IAnyBuildNode* AnyValueTypeElementBuildNode::GetStructureNode()
       "AnyValueTypeElementBuildNode::GetStructureNode must be called after \"datatype\" key "
       "and with empty child node");
   }
-  m_type_node = std::make_unique<AnyTypeBuildNode>(GetTypeRegistry(), this);
+  m_type_node = CreateBuildNode<AnyTypeBuildNode>(GetArena(), GetTypeRegistry(), this);
   return m_type_node.get();
 }
 
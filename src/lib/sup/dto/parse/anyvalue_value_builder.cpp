@@ -25,19 +25,39 @@
 #include <sup/dto/parse/anyvalue_valueelement_buildnode.h>
 #include <sup/dto/parse/serialization_constants.h>
 
+#include <sup/dto/anytype_registry.h>
 #include <sup/dto/anyvalue_exceptions.h>
 
 namespace sup
 {
 namespace dto
 {
+namespace
+{
+// Typed value parsing never needs to resolve type names, so a single immutable registry is shared
+// between all builders.
+const AnyTypeRegistry& EmptyRegistry();
+}
 
 AnyValueValueBuilder::AnyValueValueBuilder(const AnyType& anytype)
   : m_value{anytype}
-  , m_registry{}
-  , m_root{std::make_unique<AnyValueValueElementBuildNode>(&m_registry, nullptr, m_value)}
+  , m_target{m_value}
+  , m_arena{}
+  , m_root{std::make_unique<AnyValueValueElementBuildNode>(&EmptyRegistry(), nullptr, m_target)}
   , m_current{m_root.get()}
 {
+  m_root->SetArena(&m_arena);
+  (void)m_current->Member(serialization::INSTANCE_KEY);
+}
+
+AnyValueValueBuilder::AnyValueValueBuilder(AnyValue& anyvalue)
+  : m_value{}
+  , m_target{anyvalue}
+  , m_arena{}
+  , m_root{std::make_unique<AnyValueValueElementBuildNode>(&EmptyRegistry(), nullptr, m_target)}
+  , m_current{m_root.get()}
+{
+  m_root->SetArena(&m_arena);
   (void)m_current->Member(serialization::INSTANCE_KEY);
 }
 
@@ -50,7 +70,7 @@ AnyValue AnyValueValueBuilder::MoveAnyValue()
   {
     throw ParseException("AnyValueValueBuilder::MoveAnyValue called before parsing was finished");
   }
-  return std::move(m_value);
+  return std::move(m_target);
 }
 
 bool AnyValueValueBuilder::Null()
@@ -88,15 +108,14 @@ bool AnyValueValueBuilder::Double(float64 d)
   return m_current->Double(d);
 }
 
-bool AnyValueValueBuilder::RawNumber(const char*, std::size_t, bool)
+bool AnyValueValueBuilder::RawNumber(const char* str, std::size_t length, bool)
 {
-  throw ParseException("AnyValueValueBuilder::RawNumber not supported");
+  return m_current->RawNumber(str, length);
 }
 
 bool AnyValueValueBuilder::String(const char* str, std::size_t length, bool)
 {
-  const std::string arg(str, length);
-  return m_current->String(arg);
+  return m_current->String(std::string_view{str, length});
 }
 
 bool AnyValueValueBuilder::StartObject()
@@ -107,8 +126,7 @@ bool AnyValueValueBuilder::StartObject()
 
 bool AnyValueValueBuilder::Key(const char* str, std::size_t length, bool)
 {
-  const std::string arg(str, length);
-  return m_current->Member(arg);
+  return m_current->Member(std::string_view{str, length});
 }
 
 bool AnyValueValueBuilder::EndObject(std::size_t)
@@ -137,6 +155,15 @@ bool AnyValueValueBuilder::EndArray(std::size_t)
   return m_current->PopArrayNode();
 }
 
+namespace
+{
+const AnyTypeRegistry& EmptyRegistry()
+{
+  static const AnyTypeRegistry registry{};
+  return registry;
+}
+}  // unnamed namespace
+
 }  // namespace dto
 
 }  // namespace sup
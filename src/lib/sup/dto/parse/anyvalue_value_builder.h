@@ -23,7 +23,8 @@
 #ifndef SUP_DTO_ANYVALUE_VALUE_BUILDER_H_
 #define SUP_DTO_ANYVALUE_VALUE_BUILDER_H_
 
-#include <sup/dto/anytype_registry.h>
+#include <sup/dto/parse/build_node_arena.h>
+
 #include <sup/dto/anyvalue.h>
 #include <sup/dto/basic_scalar_types.h>
 
@@ -40,6 +41,8 @@ class AnyValueValueBuilder
 {
 public:
   explicit AnyValueValueBuilder(const AnyType& anytype);
+  // Parse directly into an existing value, whose type defines the expected JSON structure.
+  explicit AnyValueValueBuilder(AnyValue& anyvalue);
   ~AnyValueValueBuilder();
 
   AnyValueValueBuilder(const AnyValueValueBuilder& other) = delete;
@@ -66,7 +69,8 @@ public:
 
 private:
   AnyValue m_value;
-  AnyTypeRegistry m_registry;
+  AnyValue& m_target;
+  BuildNodeArena m_arena;
   std::unique_ptr<AnyValueValueElementBuildNode> m_root;
   IAnyBuildNode* m_current;
 };
@@ -22,6 +22,7 @@
 
 #include "anyvalue_valueelement_buildnode.h"
 
+#include <sup/dto/json/json_number.h>
 #include <sup/dto/parse/anyvalue_buildnode.h>
 #include <sup/dto/parse/arrayvalue_buildnode.h>
 #include <sup/dto/parse/serialization_constants.h>
@@ -128,19 +129,31 @@ bool AnyValueValueElementBuildNode::Double(float64 d)
   return true;
 }
 
-bool AnyValueValueElementBuildNode::String(const std::string& str)
+bool AnyValueValueElementBuildNode::RawNumber(const char* str, std::size_t length)
+{
+  if (m_member_name != serialization::INSTANCE_KEY)
+  {
+    throw ParseException(
+        "AnyValueValueElementBuildNode::RawNumber must be called after \"instance\" key");
+  }
+  AssignJSONNumber(m_anyvalue, m_anyvalue.GetTypeCode(), str, length);
+  m_member_name.clear();
+  return true;
+}
+
+bool AnyValueValueElementBuildNode::String(std::string_view str)
 {
   if (m_member_name != serialization::INSTANCE_KEY)
   {
     throw ParseException(
         "AnyValueValueElementBuildNode::String must be called after \"instance\" key");
   }
-  m_anyvalue.ConvertFrom(str);
+  m_anyvalue.ConvertFrom(std::string{str});
   m_member_name.clear();
   return true;
 }
 
-bool AnyValueValueElementBuildNode::Member(const std::string& str)
+bool AnyValueValueElementBuildNode::Member(std::string_view str)
 {
   if ((!m_member_name.empty()) || (str != serialization::INSTANCE_KEY))
   {
@@ -159,7 +172,8 @@ IAnyBuildNode* AnyValueValueElementBuildNode::GetStructureNode()
       "AnyValueValueElementBuildNode::GetStructureNode must be called after \"instance\" key "
       "and with empty child node");
   }
-  m_value_node = std::make_unique<AnyValueBuildNode>(GetTypeRegistry(), this, m_anyvalue);
+  m_value_node =
+      CreateBuildNode<AnyValueBuildNode>(GetArena(), GetTypeRegistry(), this, m_anyvalue);
   return m_value_node.get();
 }
 
@@ -22,6 +22,7 @@
 
 #include "arrayvalue_buildnode.h"
 
+#include <sup/dto/json/json_number.h>
 #include <sup/dto/parse/anyvalue_buildnode.h>
 
 #include <sup/dto/anyvalue_exceptions.h>
@@ -33,18 +34,10 @@ namespace dto
 
 template <typename T> bool ArrayValueBuildNode::TryAssign(T val)
 {
-  if ((m_size == 0) && (m_current_index == m_anyvalue.NumberOfElements()))
-  {
-    (void)m_anyvalue.AddElement(AnyValue{m_element_type});
-  }
-  if (m_current_index >= m_anyvalue.NumberOfElements())
-  {
-    throw ParseException(
-        "ArrayValueBuildNode: trying to add more elements than allowed");
-  }
+  auto& element_value = NextElement();
   try
   {
-    m_anyvalue[m_current_index] = AnyValue{val};
+    element_value = AnyValue{val};
   }
   catch(const MessageException& e)
   {
@@ -54,6 +47,20 @@ template <typename T> bool ArrayValueBuildNode::TryAssign(T val)
   return true;
 }
 
+AnyValue& ArrayValueBuildNode::NextElement()
+{
+  if ((m_size == 0) && (m_current_index == m_anyvalue.NumberOfElements()))
+  {
+    (void)m_anyvalue.AddElement(AnyValue{m_element_type});
+  }
+  if (m_current_index >= m_anyvalue.NumberOfElements())
+  {
+    throw ParseException(
+        "ArrayValueBuildNode: trying to add more elements than allowed");
+  }
+  return m_anyvalue[m_current_index];
+}
+
 ArrayValueBuildNode::ArrayValueBuildNode(
   const AnyTypeRegistry* anytype_registry, IAnyBuildNode* parent, AnyValue& anyvalue)
   : IAnyBuildNode(anytype_registry, parent)
@@ -63,10 +70,12 @@ ArrayValueBuildNode::ArrayValueBuildNode(
   , m_size{anyvalue.NumberOfElements()}
   , m_anyvalue{anyvalue}
   , m_element_type{}
+  , m_element_type_code{TypeCode::Empty}
 {
   try
   {
     m_element_type = m_anyvalue.GetType().ElementType();
+    m_element_type_code = m_element_type.GetTypeCode();
   }
   catch(const MessageException& e)
   {
@@ -106,9 +115,25 @@ bool ArrayValueBuildNode::Double(float64 d)
   return TryAssign(d);
 }
 
-bool ArrayValueBuildNode::String(const std::string& str)
+bool ArrayValueBuildNode::RawNumber(const char* str, std::size_t length)
+{
+  auto& element_value = NextElement();
+  try
+  {
+    // Numeric element types are parsed directly from the text, using the cached type code
+    AssignJSONNumber(element_value, m_element_type_code, str, length);
+  }
+  catch(const MessageException& e)
+  {
+    throw ParseException(e.what());
+  }
+  ++m_current_index;
+  return true;
+}
+
+bool ArrayValueBuildNode::String(std::string_view str)
 {
-  return TryAssign(str);
+  return TryAssign(std::string{str});
 }
 
 IAnyBuildNode* ArrayValueBuildNode::GetStructureNode()
@@ -129,7 +154,8 @@ IAnyBuildNode* ArrayValueBuildNode::GetStructureNode()
         "ArrayValueBuildNode::GetStructureNode called while exceeding array size");
   }
   m_value_node =
-      std::make_unique<AnyValueBuildNode>(GetTypeRegistry(), this, m_anyvalue[m_current_index]);
+      CreateBuildNode<AnyValueBuildNode>(GetArena(), GetTypeRegistry(), this,
+                                         m_anyvalue[m_current_index]);
   ++m_current_index;
   return m_value_node.get();
 }
@@ -179,7 +205,7 @@ bool ArrayValueBuildNode::PopArrayNode()
   return true;
 }
 
-std::unique_ptr<IAnyBuildNode> CreateArrayBuildNode(
+BuildNodePtr<IAnyBuildNode> CreateArrayBuildNode(
     const AnyTypeRegistry *anytype_registry, IAnyBuildNode *parent, AnyValue &anyvalue)
 {
   if (!IsArrayValue(anyvalue))
@@ -187,7 +213,8 @@ std::unique_ptr<IAnyBuildNode> CreateArrayBuildNode(
     throw ParseException(
         "CreateArrayBuildNode must be called with an array value");
   }
-  return std::make_unique<ArrayValueBuildNode>(anytype_registry, parent, anyvalue);
+  auto arena = (parent == nullptr) ? nullptr : parent->GetArena();
+  return CreateBuildNode<ArrayValueBuildNode>(arena, anytype_registry, parent, anyvalue);
 }
 
 }  // namespace dto
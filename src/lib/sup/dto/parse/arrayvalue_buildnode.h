@@ -23,6 +23,7 @@
 #ifndef SUP_DTO_ARRAYVALUE_BUILDNODE_H_
 #define SUP_DTO_ARRAYVALUE_BUILDNODE_H_
 
+#include <sup/dto/parse/build_node_arena.h>
 #include <sup/dto/parse/i_any_buildnode.h>
 
 #include <sup/dto/anyvalue.h>
@@ -53,7 +54,8 @@ public:
   bool Int64(int64 i) override;
   bool Uint64(uint64 u) override;
   bool Double(float64 d) override;
-  bool String(const std::string& str) override;
+  bool RawNumber(const char* str, std::size_t length) override;
+  bool String(std::string_view str) override;
 
   IAnyBuildNode* GetStructureNode() override;
   IAnyBuildNode* GetArrayNode() override;
@@ -62,15 +64,17 @@ public:
 
 private:
   template <typename T> bool TryAssign(T val);
-  std::unique_ptr<AnyValueBuildNode> m_value_node;
-  std::unique_ptr<IAnyBuildNode> m_array_node;
+  AnyValue& NextElement();
+  BuildNodePtr<AnyValueBuildNode> m_value_node;
+  BuildNodePtr<IAnyBuildNode> m_array_node;
   std::size_t m_current_index;
   std::size_t m_size;
   AnyValue& m_anyvalue;
   AnyType m_element_type;
+  TypeCode m_element_type_code;
 };
 
-std::unique_ptr<IAnyBuildNode> CreateArrayBuildNode(
+BuildNodePtr<IAnyBuildNode> CreateArrayBuildNode(
   const AnyTypeRegistry* anytype_registry, IAnyBuildNode* parent, AnyValue& anyvalue);
 
 }  // namespace dto
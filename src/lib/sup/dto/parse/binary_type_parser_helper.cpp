@@ -88,6 +88,7 @@ BinaryTypeParserHelper::CreateHandlerMemberFunctionArray()
   result[FLOAT64_TOKEN] =
     &BinaryTypeParserHelper::HandleScalar<&AnyTypeComposer::Float64>;
   result[STRING_TOKEN] = &BinaryTypeParserHelper::HandleString;
+  result[FIXED_STRING_TOKEN] = &BinaryTypeParserHelper::HandleFixedString;
   result[START_STRUCT_TOKEN] = &BinaryTypeParserHelper::HandleStartStruct;
   result[END_STRUCT_TOKEN] = &BinaryTypeParserHelper::HandleEndStruct;
   result[START_ARRAY_TOKEN] = &BinaryTypeParserHelper::HandleStartArray;
@@ -160,6 +161,14 @@ bool BinaryTypeParserHelper::HandleString(ByteIterator& it, ByteIterator end)
   return PopState();
 }
 
+bool BinaryTypeParserHelper::HandleFixedString(ByteIterator& it, ByteIterator end)
+{
+  const auto capacity = ParseSize(it, end);
+  PushState();
+  m_composer.FixedString(capacity);
+  return PopState();
+}
+
 bool BinaryTypeParserHelper::HandleStartStruct(ByteIterator& it, ByteIterator end)
 {
   if ((it == end) || (FetchToken(it) != STRING_TOKEN))
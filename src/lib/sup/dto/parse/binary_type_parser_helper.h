@@ -69,6 +69,7 @@ private:
   bool HandleScalar(ByteIterator&, ByteIterator);
 
   bool HandleString(ByteIterator& it, ByteIterator end);
+  bool HandleFixedString(ByteIterator& it, ByteIterator end);
   bool HandleStartStruct(ByteIterator& it, ByteIterator end);
   bool HandleEndStruct(ByteIterator&, ByteIterator);
   bool HandleStartArray(ByteIterator& it, ByteIterator end);
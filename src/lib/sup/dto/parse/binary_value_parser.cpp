@@ -32,7 +32,7 @@ namespace dto
 {
 
 BinaryValueParser::BinaryValueParser(ByteIterator& it, ByteIterator end)
-  : IAnyVisitor<AnyValue>{}
+  : StaticAnyVisitor<AnyValue>{}
   , m_it{it}
   , m_end{end}
 {}
@@ -44,43 +44,15 @@ bool BinaryValueParser::IsFinished() const
   return m_it == m_end;
 }
 
-void BinaryValueParser::EmptyProlog(AnyValue*)
-{}
-
-void BinaryValueParser::EmptyEpilog(AnyValue*)
-{}
-
-void BinaryValueParser::StructProlog(AnyValue*)
-{}
-
-void BinaryValueParser::StructMemberSeparator()
-{}
-
-void BinaryValueParser::StructEpilog(AnyValue*)
-{}
-
-void BinaryValueParser::MemberProlog(AnyValue*, const std::string&)
-{}
-
-void BinaryValueParser::MemberEpilog(AnyValue*, const std::string&)
-{}
-
-void BinaryValueParser::ArrayProlog(AnyValue*)
-{}
-
-void BinaryValueParser::ArrayElementSeparator()
-{}
-
-void BinaryValueParser::ArrayEpilog(AnyValue*)
-{}
-
 void BinaryValueParser::ScalarProlog(AnyValue* anyvalue)
 {
   ParseBinaryScalar(*anyvalue, m_it, m_end);
 }
 
-void BinaryValueParser::ScalarEpilog(AnyValue*)
-{}
+void BinaryValueParser::ScalarLeaf(AnyValue* anyvalue, TypeCode type_code, std::size_t width)
+{
+  ParseBinaryScalar(*anyvalue, type_code, width, m_it, m_end);
+}
 
 }  // namespace dto
 
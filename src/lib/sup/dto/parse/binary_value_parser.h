@@ -26,7 +26,7 @@
 #include <sup/dto/parse/binary_parser.h>
 
 #include <sup/dto/basic_scalar_types.h>
-#include <sup/dto/i_any_visitor.h>
+#include <sup/dto/visit/static_any_visitor.h>
 
 namespace sup
 {
@@ -34,11 +34,11 @@ namespace dto
 {
 class AnyValue;
 
-class BinaryValueParser : public IAnyVisitor<AnyValue>
+class BinaryValueParser : public StaticAnyVisitor<AnyValue>
 {
 public:
   BinaryValueParser(ByteIterator& it, ByteIterator end);
-  ~BinaryValueParser() override;
+  ~BinaryValueParser();
 
   BinaryValueParser(const BinaryValueParser& other) = delete;
   BinaryValueParser(BinaryValueParser&& other) = delete;
@@ -47,22 +47,12 @@ public:
 
   bool IsFinished() const;
 
-  void EmptyProlog(AnyValue* anyvalue) override;
-  void EmptyEpilog(AnyValue* anyvalue) override;
+  void ScalarProlog(AnyValue* anyvalue);
 
-  void StructProlog(AnyValue* anyvalue) override;
-  void StructMemberSeparator() override;
-  void StructEpilog(AnyValue* anyvalue) override;
-
-  void MemberProlog(AnyValue* anyvalue, const std::string& member_name) override;
-  void MemberEpilog(AnyValue* anyvalue, const std::string& member_name) override;
-
-  void ArrayProlog(AnyValue* anyvalue) override;
-  void ArrayElementSeparator() override;
-  void ArrayEpilog(AnyValue* anyvalue) override;
-
-  void ScalarProlog(AnyValue* anyvalue) override;
-  void ScalarEpilog(AnyValue* anyvalue) override;
+  /**
+   * @brief Parse a scalar with the type code and width from a SerializationPlan.
+   */
+  void ScalarLeaf(AnyValue* anyvalue, TypeCode type_code, std::size_t width);
   bool HandleToken();
 
 private:
@@ -0,0 +1,131 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "build_node_arena.h"
+
+#include <sup/dto/parse/i_any_buildnode.h>
+
+#include <algorithm>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+// All allocations are aligned as for operator new:
+const std::size_t kAlignment = alignof(std::max_align_t);
+
+// Blocks grow geometrically, so small parses (e.g. single elements in parallel parsing) only
+// allocate a small block:
+const std::size_t kInitialBlockSize = 1024;
+const std::size_t kMaxBlockSize = 64 * 1024;
+
+std::size_t AlignedSize(std::size_t size);
+}  // unnamed namespace
+
+BuildNodeDeleter::BuildNodeDeleter()
+  : m_arena{nullptr}
+  , m_size{0}
+{}
+
+BuildNodeDeleter::BuildNodeDeleter(BuildNodeArena* arena, std::size_t size)
+  : m_arena{arena}
+  , m_size{size}
+{}
+
+void BuildNodeDeleter::operator()(IAnyBuildNode* node) const
+{
+  if (m_arena == nullptr)
+  {
+    delete node;
+    return;
+  }
+  node->~IAnyBuildNode();
+  m_arena->Deallocate(node, m_size);
+}
+
+BuildNodeArena::BuildNodeArena()
+  : m_blocks{}
+  , m_block_size{0}
+  , m_block_used{0}
+  , m_free_lists{}
+{}
+
+BuildNodeArena::~BuildNodeArena() = default;
+
+void* BuildNodeArena::Allocate(std::size_t size)
+{
+  const auto aligned_size = AlignedSize(size);
+  auto& free_list = FreeList(aligned_size);
+  if (free_list != nullptr)
+  {
+    auto result = free_list;
+    free_list = free_list->next;
+    return result;
+  }
+  if (m_blocks.empty() || m_block_used + aligned_size > m_block_size)
+  {
+    const auto next_size = m_blocks.empty() ? kInitialBlockSize
+                                            : std::min(2 * m_block_size, kMaxBlockSize);
+    m_block_size = std::max(next_size, aligned_size);
+    m_blocks.emplace_back(new unsigned char[m_block_size]);
+    m_block_used = 0;
+  }
+  auto result = m_blocks.back().get() + m_block_used;
+  m_block_used += aligned_size;
+  return result;
+}
+
+void BuildNodeArena::Deallocate(void* ptr, std::size_t size)
+{
+  auto& free_list = FreeList(AlignedSize(size));
+  auto block = static_cast<FreeBlock*>(ptr);
+  block->next = free_list;
+  free_list = block;
+}
+
+BuildNodeArena::FreeBlock*& BuildNodeArena::FreeList(std::size_t size)
+{
+  // Only a handful of node sizes exist, so a linear search is fastest
+  for (auto& free_list : m_free_lists)
+  {
+    if (free_list.first == size)
+    {
+      return free_list.second;
+    }
+  }
+  m_free_lists.emplace_back(size, nullptr);
+  return m_free_lists.back().second;
+}
+
+namespace
+{
+std::size_t AlignedSize(std::size_t size)
+{
+  return ((size + kAlignment - 1) / kAlignment) * kAlignment;
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
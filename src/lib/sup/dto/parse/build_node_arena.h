@@ -0,0 +1,123 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_BUILD_NODE_ARENA_H_
+#define SUP_DTO_BUILD_NODE_ARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+class BuildNodeArena;
+class IAnyBuildNode;
+
+/**
+ * @brief Deleter for build nodes that returns their memory to the arena they were created in.
+ *
+ * @details A deleter without arena deletes nodes that were allocated on the heap.
+ */
+class BuildNodeDeleter
+{
+public:
+  BuildNodeDeleter();
+  BuildNodeDeleter(BuildNodeArena* arena, std::size_t size);
+
+  void operator()(IAnyBuildNode* node) const;
+
+private:
+  BuildNodeArena* m_arena;
+  std::size_t m_size;
+};
+
+template <typename T>
+using BuildNodePtr = std::unique_ptr<T, BuildNodeDeleter>;
+
+/**
+ * @brief Per-parse arena for build nodes.
+ *
+ * @details Memory is taken from blocks that are all released at once when the arena is destroyed,
+ * i.e. when the parse completes. Nodes that are destroyed during parsing put their memory on a free
+ * list for their size, from which the next node of the same size is served. The memory in use
+ * is therefore bounded by the maximum number of nodes that are alive simultaneously (roughly the
+ * nesting depth of the document), instead of growing with the size of the document.
+ */
+class BuildNodeArena
+{
+public:
+  BuildNodeArena();
+  ~BuildNodeArena();
+
+  BuildNodeArena(const BuildNodeArena& other) = delete;
+  BuildNodeArena(BuildNodeArena&& other) = delete;
+  BuildNodeArena& operator=(const BuildNodeArena& other) = delete;
+  BuildNodeArena& operator=(BuildNodeArena&& other) = delete;
+
+  void* Allocate(std::size_t size);
+  void Deallocate(void* ptr, std::size_t size);
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+  FreeBlock*& FreeList(std::size_t size);
+  std::vector<std::unique_ptr<unsigned char[]>> m_blocks;
+  std::size_t m_block_size;
+  std::size_t m_block_used;
+  std::vector<std::pair<std::size_t, FreeBlock*>> m_free_lists;
+};
+
+/**
+ * @brief Create a build node in the given arena, or on the heap when the arena is null.
+ */
+template <typename T, typename... Args>
+BuildNodePtr<T> CreateBuildNode(BuildNodeArena* arena, Args&&... args)
+{
+  if (arena == nullptr)
+  {
+    return BuildNodePtr<T>{new T(std::forward<Args>(args)...), BuildNodeDeleter{}};
+  }
+  void* memory = arena->Allocate(sizeof(T));
+  T* node = nullptr;
+  try
+  {
+    node = new (memory) T(std::forward<Args>(args)...);
+  }
+  catch(...)
+  {
+    arena->Deallocate(memory, sizeof(T));
+    throw;
+  }
+  return BuildNodePtr<T>{node, BuildNodeDeleter{arena, sizeof(T)}};
+}
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_BUILD_NODE_ARENA_H_
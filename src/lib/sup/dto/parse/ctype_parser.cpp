@@ -25,6 +25,7 @@
 #include <sup/dto/low_level/scalar_from_bytes.h>
 
 #include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
 
 namespace sup
 {
@@ -32,7 +33,7 @@ namespace dto
 {
 
 CTypeParser::CTypeParser(const uint8* bytes, std::size_t total_size, ByteOrder byte_order)
-  : IAnyVisitor<AnyValue>{}
+  : StaticAnyVisitor<AnyValue>{}
   , m_bytes{bytes}
   , m_total_size{total_size}
   , m_current_position{0}
@@ -46,36 +47,6 @@ bool CTypeParser::IsFinished() const
   return m_current_position == m_total_size;
 }
 
-void CTypeParser::EmptyProlog(AnyValue*)
-{}
-
-void CTypeParser::EmptyEpilog(AnyValue*)
-{}
-
-void CTypeParser::StructProlog(AnyValue*)
-{}
-
-void CTypeParser::StructMemberSeparator()
-{}
-
-void CTypeParser::StructEpilog(AnyValue*)
-{}
-
-void CTypeParser::MemberProlog(AnyValue*, const std::string&)
-{}
-
-void CTypeParser::MemberEpilog(AnyValue*, const std::string&)
-{}
-
-void CTypeParser::ArrayProlog(AnyValue*)
-{}
-
-void CTypeParser::ArrayElementSeparator()
-{}
-
-void CTypeParser::ArrayEpilog(AnyValue*)
-{}
-
 void CTypeParser::ScalarProlog(AnyValue* anyvalue)
 {
   m_current_position = (m_byte_order == ByteOrder::Host)
@@ -83,8 +54,23 @@ void CTypeParser::ScalarProlog(AnyValue* anyvalue)
     : AssignFromNetworkOrder(*anyvalue, m_bytes, m_total_size, m_current_position);
 }
 
-void CTypeParser::ScalarEpilog(AnyValue*)
-{}
+void CTypeParser::ScalarLeaf(AnyValue* anyvalue, TypeCode type_code, std::size_t width)
+{
+  if ((m_current_position + width) > m_total_size)
+  {
+    throw ParseException("Trying to parse beyond size of byte array");
+  }
+  const auto* src = m_bytes + m_current_position;
+  if (m_byte_order == ByteOrder::Host)
+  {
+    ReadScalarFromHostOrder(*anyvalue, type_code, width, src);
+  }
+  else
+  {
+    ReadScalarFromNetworkOrder(*anyvalue, type_code, width, src);
+  }
+  m_current_position += width;
+}
 
 }  // namespace dto
 
@@ -23,8 +23,9 @@
 #ifndef SUP_DTO_BYTE_PARSER_H_
 #define SUP_DTO_BYTE_PARSER_H_
 
+#include <sup/dto/anytype.h>
 #include <sup/dto/basic_scalar_types.h>
-#include <sup/dto/i_any_visitor.h>
+#include <sup/dto/visit/static_any_visitor.h>
 
 namespace sup
 {
@@ -32,7 +33,7 @@ namespace dto
 {
 class AnyValue;
 
-class CTypeParser : public IAnyVisitor<AnyValue>
+class CTypeParser : public StaticAnyVisitor<AnyValue>
 {
 public:
   enum class ByteOrder : sup::dto::uint32
@@ -41,7 +42,7 @@ public:
     Network
   };
   CTypeParser(const uint8* bytes, std::size_t total_size, ByteOrder byte_order);
-  ~CTypeParser() override;
+  ~CTypeParser();
 
   CTypeParser(const CTypeParser& other) = delete;
   CTypeParser(CTypeParser&& other) = delete;
@@ -50,22 +51,13 @@ public:
 
   bool IsFinished() const;
 
-  void EmptyProlog(AnyValue* anyvalue) override;
-  void EmptyEpilog(AnyValue* anyvalue) override;
+  void ScalarProlog(AnyValue* anyvalue);
 
-  void StructProlog(AnyValue* anyvalue) override;
-  void StructMemberSeparator() override;
-  void StructEpilog(AnyValue* anyvalue) override;
-
-  void MemberProlog(AnyValue* anyvalue, const std::string& member_name) override;
-  void MemberEpilog(AnyValue* anyvalue, const std::string& member_name) override;
-
-  void ArrayProlog(AnyValue* anyvalue) override;
-  void ArrayElementSeparator() override;
-  void ArrayEpilog(AnyValue* anyvalue) override;
-
-  void ScalarProlog(AnyValue* anyvalue) override;
-  void ScalarEpilog(AnyValue* anyvalue) override;
+  /**
+   * @brief Read a scalar with the type code and width from a SerializationPlan directly from the
+   * bytes.
+   */
+  void ScalarLeaf(AnyValue* anyvalue, TypeCode type_code, std::size_t width);
 
 private:
   const uint8* m_bytes;
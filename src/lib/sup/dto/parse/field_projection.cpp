@@ -0,0 +1,146 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "field_projection.h"
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+ProjectionNode& GetOrAddMember(ProjectionNode& node, const std::string& name);
+
+AnyType ProjectTypeWithNode(const AnyType& anytype, const ProjectionNode& node);
+}  // unnamed namespace
+
+const ProjectionNode* ProjectionNode::FindMember(std::string_view name) const
+{
+  for (const auto& member : members)
+  {
+    if (member.first == name)
+    {
+      return &member.second;
+    }
+  }
+  return nullptr;
+}
+
+FieldProjection::FieldProjection(const std::vector<std::string>& fieldnames)
+  : m_root{false, {}}
+{
+  for (const auto& fieldname : fieldnames)
+  {
+    AddFieldname(fieldname);
+  }
+}
+
+FieldProjection::~FieldProjection() = default;
+
+const ProjectionNode& FieldProjection::GetRoot() const
+{
+  return m_root;
+}
+
+AnyType FieldProjection::ProjectType(const AnyType& anytype) const
+{
+  return ProjectTypeWithNode(anytype, m_root);
+}
+
+void FieldProjection::AddFieldname(const std::string& fieldname)
+{
+  auto node = &m_root;
+  if (!fieldname.empty())
+  {
+    for (const auto& component : SplitAnyValueFieldname(fieldname))
+    {
+      if (component.front() == '[')
+      {
+        throw InvalidOperationException(
+          "FieldProjection::AddFieldname(): array elements cannot be selected: \"" + fieldname +
+          "\"");
+      }
+      if (node->selected)
+      {
+        // Already selected by a shorter path
+        return;
+      }
+      node = &GetOrAddMember(*node, component);
+    }
+  }
+  node->selected = true;
+  node->members.clear();
+}
+
+namespace
+{
+ProjectionNode& GetOrAddMember(ProjectionNode& node, const std::string& name)
+{
+  for (auto& member : node.members)
+  {
+    if (member.first == name)
+    {
+      return member.second;
+    }
+  }
+  node.members.emplace_back(name, ProjectionNode{false, {}});
+  return node.members.back().second;
+}
+
+AnyType ProjectTypeWithNode(const AnyType& anytype, const ProjectionNode& node)
+{
+  if (node.selected)
+  {
+    return anytype;
+  }
+  if (!IsStructType(anytype))
+  {
+    throw InvalidOperationException(
+      "FieldProjection::ProjectType(): selected fields can only be structure members");
+  }
+  AnyType result = EmptyStructType(anytype.GetTypeName());
+  std::size_t n_projected = 0;
+  for (const auto& member_name : anytype.MemberNames())
+  {
+    auto member_node = node.FindMember(member_name);
+    if (member_node != nullptr)
+    {
+      (void)result.AddMember(member_name, ProjectTypeWithNode(anytype[member_name], *member_node));
+      ++n_projected;
+    }
+  }
+  if (n_projected != node.members.size())
+  {
+    throw InvalidOperationException(
+      "FieldProjection::ProjectType(): selected field does not exist in type");
+  }
+  return result;
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
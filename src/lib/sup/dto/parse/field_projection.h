@@ -0,0 +1,92 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_FIELD_PROJECTION_H_
+#define SUP_DTO_FIELD_PROJECTION_H_
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+class AnyType;
+
+/**
+ * @brief Node of a field projection tree.
+ *
+ * @details A selected node selects its complete subtree. Otherwise, only the listed members are
+ * selected.
+ */
+struct ProjectionNode
+{
+  const ProjectionNode* FindMember(std::string_view name) const;
+
+  bool selected;
+  std::vector<std::pair<std::string, ProjectionNode>> members;
+};
+
+/**
+ * @brief Set of selected fields, built from field paths in the syntax of AnyValue::operator[].
+ *
+ * @details Only structure members can be selected: paths that contain array indices are rejected.
+ * An empty path selects the complete value.
+ */
+class FieldProjection
+{
+public:
+  /**
+   * @throws InvalidOperationException Thrown when one of the paths could not be parsed or contains
+   * an array index.
+   */
+  explicit FieldProjection(const std::vector<std::string>& fieldnames);
+  ~FieldProjection();
+
+  FieldProjection(const FieldProjection& other) = delete;
+  FieldProjection(FieldProjection&& other) = delete;
+  FieldProjection& operator=(const FieldProjection& other) = delete;
+  FieldProjection& operator=(FieldProjection&& other) = delete;
+
+  const ProjectionNode& GetRoot() const;
+
+  /**
+   * @brief Create the type that only contains the selected fields of the given type.
+   *
+   * @details Member order and structure names are preserved.
+   *
+   * @throws InvalidOperationException Thrown when a selected field does not exist in the type.
+   */
+  AnyType ProjectType(const AnyType& anytype) const;
+
+private:
+  void AddFieldname(const std::string& fieldname);
+  ProjectionNode m_root;
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_FIELD_PROJECTION_H_
@@ -22,6 +22,9 @@
 
 #include "i_any_buildnode.h"
 
+#include <sup/dto/json/json_number.h>
+
+#include <sup/dto/anyvalue.h>
 #include <sup/dto/anyvalue_exceptions.h>
 
 namespace sup
@@ -32,6 +35,7 @@ namespace dto
 IAnyBuildNode::IAnyBuildNode(const AnyTypeRegistry* anytype_registry, IAnyBuildNode* parent)
   : m_anytype_registry{anytype_registry}
   , m_parent{parent}
+  , m_arena{parent == nullptr ? nullptr : parent->GetArena()}
 {
   if (m_anytype_registry == nullptr)
   {
@@ -52,6 +56,16 @@ IAnyBuildNode* IAnyBuildNode::GetParent() const &
   return m_parent;
 }
 
+BuildNodeArena* IAnyBuildNode::GetArena() const &
+{
+  return m_arena;
+}
+
+void IAnyBuildNode::SetArena(BuildNodeArena* arena)
+{
+  m_arena = arena;
+}
+
 bool IAnyBuildNode::Null()
 {
   throw ParseException("Parser called unsupported operation for this node (Null)");
@@ -87,12 +101,30 @@ bool IAnyBuildNode::Double(float64)
   throw ParseException("Parser called unsupported operation for this node (Double)");
 }
 
-bool IAnyBuildNode::String(const std::string&)
+bool IAnyBuildNode::RawNumber(const char* str, std::size_t length)
+{
+  const auto number = ParseJSONNumber(str, length);
+  switch (number.GetTypeCode())
+  {
+  case TypeCode::Int32:
+    return Int32(number.As<int32>());
+  case TypeCode::UInt32:
+    return Uint32(number.As<uint32>());
+  case TypeCode::Int64:
+    return Int64(number.As<int64>());
+  case TypeCode::UInt64:
+    return Uint64(number.As<uint64>());
+  default:
+    return Double(number.As<float64>());
+  }
+}
+
+bool IAnyBuildNode::String(std::string_view)
 {
   throw ParseException("Parser called unsupported operation for this node (String)");
 }
 
-bool IAnyBuildNode::Member(const std::string&)
+bool IAnyBuildNode::Member(std::string_view)
 {
   throw ParseException("Parser called unsupported operation for this node (Member)");
 }
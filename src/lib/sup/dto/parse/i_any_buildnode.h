@@ -25,13 +25,16 @@
 
 #include <sup/dto/basic_scalar_types.h>
 
+#include <cstddef>
 #include <string>
+#include <string_view>
 
 namespace sup
 {
 namespace dto
 {
 class AnyTypeRegistry;
+class BuildNodeArena;
 
 class IAnyBuildNode
 {
@@ -47,6 +50,11 @@ public:
   const AnyTypeRegistry* GetTypeRegistry() const &;
   IAnyBuildNode* GetParent() const &;
 
+  // Arena for creating child nodes (nullptr if they are allocated on the heap). Nodes inherit the
+  // arena of their parent.
+  BuildNodeArena* GetArena() const &;
+  void SetArena(BuildNodeArena* arena);
+
   virtual bool Null();
   virtual bool Bool(boolean b);
   virtual bool Int32(int32 i);
@@ -54,8 +62,11 @@ public:
   virtual bool Int64(int64 i);
   virtual bool Uint64(uint64 u);
   virtual bool Double(float64 d);
-  virtual bool String(const std::string& str);
-  virtual bool Member(const std::string& str);
+  // Number given by its literal JSON text. The default implementation parses the number in the
+  // same way as rapidjson and forwards it to the corresponding typed method.
+  virtual bool RawNumber(const char* str, std::size_t length);
+  virtual bool String(std::string_view str);
+  virtual bool Member(std::string_view str);
 
   virtual IAnyBuildNode* GetStructureNode();
   virtual IAnyBuildNode* GetArrayNode();
@@ -65,6 +76,7 @@ public:
 private:
   const AnyTypeRegistry* m_anytype_registry;
   IAnyBuildNode* m_parent;
+  BuildNodeArena* m_arena;
 };
 
 }  // namespace dto
@@ -24,10 +24,13 @@
 
 #include <sup/dto/anytype_registry.h>
 #include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/json/json_parallel_reader.h>
 #include <sup/dto/json/json_reader.h>
+#include <sup/dto/parse/field_projection.h>
 #include <sup/dto/anyvalue.h>
 
 #include <fstream>
+#include <iterator>
 #include <sstream>
 
 namespace sup
@@ -121,6 +124,109 @@ bool JSONAnyValueParser::TypedParseFile(const AnyType& anytype, const std::strin
   return true;
 }
 
+bool JSONAnyValueParser::TypedParseString(const AnyType& anytype, const std::string& json_str,
+                                          ThreadPool& thread_pool)
+{
+  try
+  {
+    m_anyvalue = JSONParallelParseTypedAnyValue(anytype, json_str.data(), json_str.size(),
+                                                thread_pool);
+  }
+  catch(const MessageException&)
+  {
+    return false;
+  }
+  return true;
+}
+
+bool JSONAnyValueParser::TypedParseFile(const AnyType& anytype, const std::string& filename,
+                                        ThreadPool& thread_pool)
+{
+  std::ifstream ifs(filename, std::ios::binary);
+  if (!ifs.is_open())
+  {
+    return false;
+  }
+  const std::string json_str{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+  return TypedParseString(anytype, json_str, thread_pool);
+}
+
+bool JSONAnyValueParser::ParseString(const std::string& json_str,
+                                     const AnyTypeRegistry* type_registry,
+                                     const std::vector<std::string>& fieldnames)
+{
+  try
+  {
+    const FieldProjection projection{fieldnames};
+    const AnyTypeRegistry empty_registry;
+    const auto registry = (type_registry == nullptr) ? &empty_registry : type_registry;
+    m_anyvalue = JSONParseAnyValue(registry, json_str.data(), json_str.size(), projection);
+  }
+  catch(const MessageException&)
+  {
+    return false;
+  }
+  return true;
+}
+
+bool JSONAnyValueParser::ParseFile(const std::string& filename,
+                                   const AnyTypeRegistry* type_registry,
+                                   const std::vector<std::string>& fieldnames)
+{
+  std::ifstream ifs(filename);
+  if (!ifs.is_open())
+  {
+    return false;
+  }
+  try
+  {
+    const FieldProjection projection{fieldnames};
+    const AnyTypeRegistry empty_registry;
+    const auto registry = (type_registry == nullptr) ? &empty_registry : type_registry;
+    m_anyvalue = JSONParseAnyValue(registry, ifs, projection);
+  }
+  catch(const MessageException&)
+  {
+    return false;
+  }
+  return true;
+}
+
+bool JSONAnyValueParser::TypedParseString(const AnyType& anytype, const std::string& json_str,
+                                          const std::vector<std::string>& fieldnames)
+{
+  try
+  {
+    const FieldProjection projection{fieldnames};
+    m_anyvalue = JSONParseTypedAnyValue(anytype, json_str.data(), json_str.size(), projection);
+  }
+  catch(const MessageException&)
+  {
+    return false;
+  }
+  return true;
+}
+
+bool JSONAnyValueParser::TypedParseFile(const AnyType& anytype, const std::string& filename,
+                                        const std::vector<std::string>& fieldnames)
+{
+  std::ifstream ifs(filename);
+  if (!ifs.is_open())
+  {
+    return false;
+  }
+  try
+  {
+    const FieldProjection projection{fieldnames};
+    m_anyvalue = JSONParseTypedAnyValue(anytype, ifs, projection);
+  }
+  catch(const MessageException&)
+  {
+    return false;
+  }
+  return true;
+}
+
 AnyValue JSONAnyValueParser::MoveAnyValue()
 {
   return std::move(m_anyvalue);
@@ -23,6 +23,7 @@
 #ifndef SUP_DTO_MEMBERTYPE_ARRAY_BUILDNODE_H_
 #define SUP_DTO_MEMBERTYPE_ARRAY_BUILDNODE_H_
 
+#include <sup/dto/parse/build_node_arena.h>
 #include <sup/dto/parse/i_any_buildnode.h>
 #include <sup/dto/anytype.h>
 
@@ -53,7 +54,7 @@ public:
   std::vector<std::pair<std::string, AnyType>> MoveMemberTypes();
 
 private:
-  std::unique_ptr<MemberTypeBuildNode> m_member_node;
+  BuildNodePtr<MemberTypeBuildNode> m_member_node;
   std::vector<std::pair<std::string, AnyType>> m_member_types;
 };
 
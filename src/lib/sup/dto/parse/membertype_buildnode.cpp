@@ -41,7 +41,7 @@ MemberTypeBuildNode::MemberTypeBuildNode(
 
 MemberTypeBuildNode::~MemberTypeBuildNode() = default;
 
-bool MemberTypeBuildNode::Member(const std::string& str)
+bool MemberTypeBuildNode::Member(std::string_view str)
 {
   if (!m_member_name.empty())
   {
@@ -60,7 +60,7 @@ IAnyBuildNode* MemberTypeBuildNode::GetStructureNode()
         "MemberTypeBuildNode::GetStructureNode must be called after member name and with "
         "empty child node");
   }
-  m_type_node = std::make_unique<AnyTypeBuildNode>(GetTypeRegistry(), this);
+  m_type_node = CreateBuildNode<AnyTypeBuildNode>(GetArena(), GetTypeRegistry(), this);
   return m_type_node.get();
 }
 
@@ -23,6 +23,7 @@
 #ifndef SUP_DTO_MEMBERTYPE_BUILDNODE_H_
 #define SUP_DTO_MEMBERTYPE_BUILDNODE_H_
 
+#include <sup/dto/parse/build_node_arena.h>
 #include <sup/dto/parse/i_any_buildnode.h>
 
 #include <sup/dto/anytype.h>
@@ -47,7 +48,7 @@ public:
   MemberTypeBuildNode& operator=(const MemberTypeBuildNode& other) = delete;
   MemberTypeBuildNode& operator=(MemberTypeBuildNode&& other) = delete;
 
-  bool Member(const std::string& str) override;
+  bool Member(std::string_view str) override;
 
   IAnyBuildNode* GetStructureNode() override;
   bool PopStructureNode() override;
@@ -55,7 +56,7 @@ public:
   std::pair<std::string, AnyType> MoveMemberType();
 
 private:
-  std::unique_ptr<AnyTypeBuildNode> m_type_node;
+  BuildNodePtr<AnyTypeBuildNode> m_type_node;
   std::string m_member_name;
   std::pair<std::string, AnyType> m_member_type;
 };
@@ -0,0 +1,274 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_PROJECTION_FILTER_T_H_
+#define SUP_DTO_PROJECTION_FILTER_T_H_
+
+#include <sup/dto/parse/field_projection.h>
+#include <sup/dto/parse/serialization_constants.h>
+
+#include <sup/dto/basic_scalar_types.h>
+
+#include <string_view>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+
+/**
+ * @brief JSON SAX handler that forwards only the selected fields of a value to another handler.
+ *
+ * @details Values of non-selected members are consumed without forwarding any of their events, so
+ * no build nodes or strings are created for them. Below a fully selected node, all events are
+ * forwarded unchanged.
+ *
+ * In typed mode, the projection applies to the root value. Otherwise, the JSON is expected to be
+ * in the self-describing format and the projection applies to the value of the instance member.
+ */
+template <typename Handler>
+class ProjectionFilter
+{
+public:
+  ProjectionFilter(Handler& handler, const FieldProjection& projection, bool typed);
+  ~ProjectionFilter() = default;
+
+  ProjectionFilter(const ProjectionFilter& other) = delete;
+  ProjectionFilter(ProjectionFilter&& other) = delete;
+  ProjectionFilter& operator=(const ProjectionFilter& other) = delete;
+  ProjectionFilter& operator=(ProjectionFilter&& other) = delete;
+
+  bool Null();
+  bool Bool(boolean b);
+  bool Int(int32 i);
+  bool Uint(uint32 u);
+  bool Int64(int64 i);
+  bool Uint64(uint64 u);
+  bool Double(float64 d);
+  bool RawNumber(const char* str, std::size_t length, bool copy);
+  bool String(const char* str, std::size_t length, bool copy);
+  bool StartObject();
+  bool Key(const char* str, std::size_t length, bool copy);
+  bool EndObject(std::size_t memberCount);
+  bool StartArray();
+  bool EndArray(std::size_t elementCount);
+
+private:
+  // Returns true if the next scalar value needs to be forwarded.
+  bool ForwardScalar();
+  // Returns true if the next object or array needs to be forwarded.
+  bool ForwardContainer();
+  // Returns true if the end of the current object or array needs to be forwarded.
+  bool ForwardEnd();
+  static const ProjectionNode* NodeOrPassThrough(const ProjectionNode& node);
+
+  Handler& m_handler;
+  const ProjectionNode& m_root;
+  bool m_typed;
+  // Projection nodes of the open containers (nullptr forwards all their content):
+  std::vector<const ProjectionNode*> m_frames;
+  // Projection node of the next value:
+  const ProjectionNode* m_next;
+  bool m_skip_next;
+  std::size_t m_skip_depth;
+};
+
+template <typename Handler>
+ProjectionFilter<Handler>::ProjectionFilter(Handler& handler, const FieldProjection& projection,
+                                            bool typed)
+  : m_handler{handler}
+  , m_root{projection.GetRoot()}
+  , m_typed{typed}
+  , m_frames{}
+  , m_next{typed ? NodeOrPassThrough(m_root) : nullptr}
+  , m_skip_next{false}
+  , m_skip_depth{0}
+{}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::Null()
+{
+  return ForwardScalar() ? m_handler.Null() : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::Bool(boolean b)
+{
+  return ForwardScalar() ? m_handler.Bool(b) : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::Int(int32 i)
+{
+  return ForwardScalar() ? m_handler.Int(i) : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::Uint(uint32 u)
+{
+  return ForwardScalar() ? m_handler.Uint(u) : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::Int64(int64 i)
+{
+  return ForwardScalar() ? m_handler.Int64(i) : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::Uint64(uint64 u)
+{
+  return ForwardScalar() ? m_handler.Uint64(u) : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::Double(float64 d)
+{
+  return ForwardScalar() ? m_handler.Double(d) : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::RawNumber(const char* str, std::size_t length, bool copy)
+{
+  return ForwardScalar() ? m_handler.RawNumber(str, length, copy) : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::String(const char* str, std::size_t length, bool copy)
+{
+  return ForwardScalar() ? m_handler.String(str, length, copy) : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::StartObject()
+{
+  return ForwardContainer() ? m_handler.StartObject() : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::Key(const char* str, std::size_t length, bool copy)
+{
+  if (m_skip_depth > 0)
+  {
+    return true;
+  }
+  const std::string_view key{str, length};
+  const auto node = m_frames.empty() ? nullptr : m_frames.back();
+  if (node == nullptr)
+  {
+    // Forward all members, but activate the projection when reaching the instance member of the
+    // self-describing format
+    const bool is_instance =
+      !m_typed && (m_frames.size() == 2) && (key == serialization::INSTANCE_KEY);
+    m_next = is_instance ? NodeOrPassThrough(m_root) : nullptr;
+    return m_handler.Key(str, length, copy);
+  }
+  const auto member_node = node->FindMember(key);
+  if (member_node == nullptr)
+  {
+    m_skip_next = true;
+    return true;
+  }
+  m_next = NodeOrPassThrough(*member_node);
+  return m_handler.Key(str, length, copy);
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::EndObject(std::size_t memberCount)
+{
+  return ForwardEnd() ? m_handler.EndObject(memberCount) : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::StartArray()
+{
+  return ForwardContainer() ? m_handler.StartArray() : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::EndArray(std::size_t elementCount)
+{
+  return ForwardEnd() ? m_handler.EndArray(elementCount) : true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::ForwardScalar()
+{
+  if (m_skip_depth > 0)
+  {
+    return false;
+  }
+  if (m_skip_next)
+  {
+    m_skip_next = false;
+    return false;
+  }
+  m_next = nullptr;
+  return true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::ForwardContainer()
+{
+  if (m_skip_depth > 0)
+  {
+    ++m_skip_depth;
+    return false;
+  }
+  if (m_skip_next)
+  {
+    m_skip_next = false;
+    m_skip_depth = 1;
+    return false;
+  }
+  m_frames.push_back(m_next);
+  m_next = nullptr;
+  return true;
+}
+
+template <typename Handler>
+bool ProjectionFilter<Handler>::ForwardEnd()
+{
+  if (m_skip_depth > 0)
+  {
+    --m_skip_depth;
+    return false;
+  }
+  if (!m_frames.empty())
+  {
+    m_frames.pop_back();
+  }
+  return true;
+}
+
+template <typename Handler>
+const ProjectionNode* ProjectionFilter<Handler>::NodeOrPassThrough(const ProjectionNode& node)
+{
+  return node.selected ? nullptr : &node;
+}
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_PROJECTION_FILTER_T_H_
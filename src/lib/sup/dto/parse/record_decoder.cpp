@@ -0,0 +1,291 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "record_decoder.h"
+
+#include <sup/dto/anyvalue/leaf_payload_access.h>
+#include <sup/dto/low_level/arithmetic_to_bytes_t.h>
+#include <sup/dto/low_level/byte_swap.h>
+#include <sup/dto/serialize/serialization_plan.h>
+#include <sup/dto/serialize/type_keyed_cache.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_leaves.h>
+
+#include <cstring>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+// Maximum number of decoders kept in the global cache; least recently used decoders are evicted
+// first:
+const std::size_t kMaxCachedDecoders = 256;
+
+struct LeafDecoding
+{
+  std::size_t size;
+  RecordLeafLoader load;
+  bool swap;  // Needs byte swapping when converting between host and network byte order
+};
+
+LeafDecoding SelectLeafDecoding(const AnyType& leaf_type);
+
+void AppendSwapRun(std::vector<SwapRun>& swap_runs, std::size_t offset, std::size_t width);
+
+TypeKeyedCache<RecordDecoder>& GetDecoderCache();
+
+std::size_t DecoderHash(std::size_t shape_hash, CTypeParser::ByteOrder byte_order);
+}  // unnamed namespace
+
+RecordDecoder::RecordDecoder(const AnyType& record_type, CTypeParser::ByteOrder byte_order)
+  : m_record_type{record_type}
+  , m_byte_order{byte_order}
+  , m_record_size{0}
+  , m_leaves{}
+  , m_swap_runs{}
+{
+  // Network order is host order on big endian platforms
+  const bool swap_bytes = byte_order == CTypeParser::ByteOrder::Network && IsLittleEndian();
+  const LeafIndex leaf_index{m_record_type};
+  const auto n_leaves = leaf_index.NumberOfLeaves();
+  m_leaves.reserve(n_leaves);
+  for (std::size_t idx = 0; idx < n_leaves; ++idx)
+  {
+    const auto& leaf_type = leaf_index.GetLeafType(idx);
+    const auto decoding = SelectLeafDecoding(leaf_type);
+    m_leaves.push_back(
+      {m_record_size, leaf_type.GetTypeCode(), leaf_type.StringCapacity(), decoding.load});
+    if (swap_bytes && decoding.swap)
+    {
+      AppendSwapRun(m_swap_runs, m_record_size, decoding.size);
+    }
+    m_record_size += decoding.size;
+  }
+}
+
+RecordDecoder::~RecordDecoder() = default;
+
+const AnyType& RecordDecoder::GetRecordType() const
+{
+  return m_record_type;
+}
+
+CTypeParser::ByteOrder RecordDecoder::GetByteOrder() const
+{
+  return m_byte_order;
+}
+
+std::size_t RecordDecoder::GetRecordSize() const
+{
+  return m_record_size;
+}
+
+const std::vector<RecordLeaf>& RecordDecoder::GetLeaves() const
+{
+  return m_leaves;
+}
+
+const std::vector<SwapRun>& RecordDecoder::GetSwapRuns() const
+{
+  return m_swap_runs;
+}
+
+void RecordDecoder::Decode(AnyValue& record, const uint8* bytes) const
+{
+  std::vector<uint8> buffer;
+  Decode(record, bytes, buffer);
+}
+
+void RecordDecoder::Decode(AnyValue& record, const uint8* bytes, std::vector<uint8>& buffer) const
+{
+  if (!m_swap_runs.empty())
+  {
+    buffer.assign(bytes, bytes + m_record_size);
+    for (const auto& run : m_swap_runs)
+    {
+      ByteSwapRun(buffer.data() + run.offset, run.count, run.width);
+    }
+    bytes = buffer.data();
+  }
+  if (DecodeNode(record, bytes, 0) != m_leaves.size())
+  {
+    throw ParseException("RecordDecoder::Decode(): record has fewer leaves than its type");
+  }
+}
+
+std::size_t RecordDecoder::DecodeNode(AnyValue& anyvalue, const uint8* bytes,
+                                      std::size_t leaf_idx) const
+{
+  const auto n_children = anyvalue.NumberOfChildren();
+  if (n_children > 0)
+  {
+    for (std::size_t idx = 0; idx < n_children; ++idx)
+    {
+      leaf_idx = DecodeNode(*anyvalue.GetChildValue(idx), bytes, leaf_idx);
+    }
+    return leaf_idx;
+  }
+  if (!anyvalue.IsScalar())
+  {
+    return leaf_idx;
+  }
+  if (leaf_idx >= m_leaves.size() || m_leaves[leaf_idx].type_code != anyvalue.GetTypeCode() ||
+      m_leaves[leaf_idx].capacity != anyvalue.StringCapacity())
+  {
+    throw ParseException("RecordDecoder::Decode(): record doesn't match the record type");
+  }
+  const auto& leaf = m_leaves[leaf_idx];
+  leaf.load(anyvalue, bytes + leaf.offset);
+  return leaf_idx + 1;
+}
+
+std::shared_ptr<const RecordDecoder> GetRecordDecoder(const AnyType& record_type,
+                                                      CTypeParser::ByteOrder byte_order)
+{
+  auto matches = [&record_type, byte_order](const RecordDecoder& decoder) {
+    return decoder.GetByteOrder() == byte_order &&
+           MatchesShape(record_type, decoder.GetRecordType());
+  };
+  auto compile = [&record_type, byte_order]() {
+    return std::make_shared<const RecordDecoder>(record_type, byte_order);
+  };
+  return GetDecoderCache().Get(DecoderHash(ShapeHash(record_type), byte_order), matches, compile);
+}
+
+std::shared_ptr<const RecordDecoder> GetRecordDecoder(const AnyValue& record,
+                                                      CTypeParser::ByteOrder byte_order)
+{
+  auto matches = [&record, byte_order](const RecordDecoder& decoder) {
+    return decoder.GetByteOrder() == byte_order && MatchesShape(record, decoder.GetRecordType());
+  };
+  auto compile = [&record, byte_order]() {
+    return std::make_shared<const RecordDecoder>(record.GetType(), byte_order);
+  };
+  return GetDecoderCache().Get(DecoderHash(ShapeHash(record), byte_order), matches, compile);
+}
+
+namespace
+{
+template <typename T>
+void LoadHostOrderLeaf(AnyValue& leaf, const uint8* bytes)
+{
+  T val{};
+  (void)std::memcpy(std::addressof(val), bytes, sizeof(T));
+  LeafPayloadAccess::Store(leaf, val);
+}
+
+void LoadStringLeaf(AnyValue& leaf, const uint8* bytes)
+{
+  if (std::memchr(bytes, 0, kStringMaxLength) == nullptr)
+  {
+    throw ParseException("RecordDecoder::Decode(): string is not zero-terminated");
+  }
+  LeafPayloadAccess::StoreString(leaf, reinterpret_cast<const char8*>(bytes), kStringMaxLength);
+}
+
+void LoadFixedStringLeaf(AnyValue& leaf, const uint8* bytes)
+{
+  const auto capacity = leaf.StringCapacity();
+  if (std::memchr(bytes, 0, capacity) == nullptr)
+  {
+    throw ParseException("RecordDecoder::Decode(): string is not zero-terminated");
+  }
+  LeafPayloadAccess::StoreString(leaf, reinterpret_cast<const char8*>(bytes), capacity);
+}
+
+template <typename T>
+LeafDecoding MakeLeafDecoding()
+{
+  return { sizeof(T), LoadHostOrderLeaf<T>, sizeof(T) > 1 };
+}
+
+LeafDecoding SelectLeafDecoding(const AnyType& leaf_type)
+{
+  switch (leaf_type.GetTypeCode())
+  {
+  case TypeCode::Bool:
+    return MakeLeafDecoding<boolean>();
+  case TypeCode::Char8:
+    return MakeLeafDecoding<char8>();
+  case TypeCode::Int8:
+    return MakeLeafDecoding<int8>();
+  case TypeCode::UInt8:
+    return MakeLeafDecoding<uint8>();
+  case TypeCode::Int16:
+    return MakeLeafDecoding<int16>();
+  case TypeCode::UInt16:
+    return MakeLeafDecoding<uint16>();
+  case TypeCode::Int32:
+    return MakeLeafDecoding<int32>();
+  case TypeCode::UInt32:
+    return MakeLeafDecoding<uint32>();
+  case TypeCode::Int64:
+    return MakeLeafDecoding<int64>();
+  case TypeCode::UInt64:
+    return MakeLeafDecoding<uint64>();
+  case TypeCode::Float32:
+    return MakeLeafDecoding<float32>();
+  case TypeCode::Float64:
+    return MakeLeafDecoding<float64>();
+  case TypeCode::String:
+    return { kStringMaxLength, LoadStringLeaf, false };
+  case TypeCode::FixedString:
+    return { leaf_type.StringCapacity(), LoadFixedStringLeaf, false };
+  default:
+    break;
+  }
+  throw ParseException("RecordDecoder: not a known scalar type code");
+}
+
+void AppendSwapRun(std::vector<SwapRun>& swap_runs, std::size_t offset, std::size_t width)
+{
+  if (!swap_runs.empty())
+  {
+    auto& last = swap_runs.back();
+    if (last.width == width && last.offset + last.count * last.width == offset)
+    {
+      ++last.count;
+      return;
+    }
+  }
+  swap_runs.push_back({ offset, 1, width });
+}
+
+TypeKeyedCache<RecordDecoder>& GetDecoderCache()
+{
+  static TypeKeyedCache<RecordDecoder> cache{kMaxCachedDecoders};
+  return cache;
+}
+
+std::size_t DecoderHash(std::size_t shape_hash, CTypeParser::ByteOrder byte_order)
+{
+  return CombineHashes(shape_hash, static_cast<std::size_t>(byte_order));
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
@@ -0,0 +1,144 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_RECORD_DECODER_H_
+#define SUP_DTO_RECORD_DECODER_H_
+
+#include <sup/dto/parse/ctype_parser.h>
+#include <sup/dto/serialize/network_order_layout.h>
+
+#include <sup/dto/anytype.h>
+
+#include <memory>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+class AnyValue;
+
+using RecordLeafLoader = void (*)(AnyValue& leaf, const uint8* bytes);
+
+/**
+ * @brief Location and loader of a single scalar leaf in a packed C record.
+ */
+struct RecordLeaf
+{
+  std::size_t offset;
+  TypeCode type_code;
+  std::size_t capacity;  // Capacity of fixed-capacity strings, zero otherwise
+  RecordLeafLoader load;
+};
+
+/**
+ * @brief Decoder of packed C records (as produced by ToBytes) of a fixed type.
+ *
+ * @details The offsets and loaders of all leaves are computed once from the record type, so that
+ * decoding a record is a single pass over its leaves without map lookups. Leaves are always loaded
+ * in host byte order: when the records are in network byte order on a little endian platform, each
+ * record is first copied to a buffer and its runs of leaves are byte swapped there with ByteSwapRun.
+ */
+class RecordDecoder
+{
+public:
+  /**
+   * @throws InvalidOperationException Thrown when the record type contains unbounded arrays.
+   */
+  RecordDecoder(const AnyType& record_type, CTypeParser::ByteOrder byte_order);
+  ~RecordDecoder();
+
+  RecordDecoder(const RecordDecoder& other) = delete;
+  RecordDecoder(RecordDecoder&& other) = delete;
+  RecordDecoder& operator=(const RecordDecoder& other) = delete;
+  RecordDecoder& operator=(RecordDecoder&& other) = delete;
+
+  const AnyType& GetRecordType() const;
+
+  CTypeParser::ByteOrder GetByteOrder() const;
+
+  std::size_t GetRecordSize() const;
+
+  const std::vector<RecordLeaf>& GetLeaves() const;
+
+  /**
+   * @brief Get the runs of leaves that are byte swapped before decoding. This is empty unless
+   * decoding network byte order on a little endian platform.
+   */
+  const std::vector<SwapRun>& GetSwapRuns() const;
+
+  /**
+   * @brief Decode a single record of GetRecordSize() bytes.
+   *
+   * @throws ParseException Thrown when the leaves of the record do not match the record type or a
+   * string is not zero-terminated. The record can then be partially assigned.
+   */
+  void Decode(AnyValue& record, const uint8* bytes) const;
+
+  /**
+   * @brief Decode a single record of GetRecordSize() bytes, using the given buffer for the byte
+   * swapped copy of the record. Reusing the buffer avoids an allocation per record.
+   *
+   * @throws ParseException Thrown when the leaves of the record do not match the record type or a
+   * string is not zero-terminated. The record can then be partially assigned.
+   */
+  void Decode(AnyValue& record, const uint8* bytes, std::vector<uint8>& buffer) const;
+
+private:
+  std::size_t DecodeNode(AnyValue& anyvalue, const uint8* bytes, std::size_t leaf_idx) const;
+  AnyType m_record_type;
+  CTypeParser::ByteOrder m_byte_order;
+  std::size_t m_record_size;
+  std::vector<RecordLeaf> m_leaves;
+  std::vector<SwapRun> m_swap_runs;
+};
+
+/**
+ * @brief Retrieve the (shared) record decoder for the given record type and byte order from a
+ * global cache, creating it first when it was not yet cached.
+ *
+ * @details The record type of the returned decoder can have different type names than the given
+ * type, since these do not influence the decoding.
+ *
+ * @throws InvalidOperationException Thrown when the record type contains unbounded arrays.
+ *
+ * @note This function is thread safe.
+ */
+std::shared_ptr<const RecordDecoder> GetRecordDecoder(const AnyType& record_type,
+                                                      CTypeParser::ByteOrder byte_order);
+
+/**
+ * @brief Retrieve the (shared) record decoder for the type of the given record, without
+ * constructing that type unless the decoder needs to be created.
+ *
+ * @throws InvalidOperationException Thrown when the record type contains unbounded arrays.
+ *
+ * @note This function is thread safe.
+ */
+std::shared_ptr<const RecordDecoder> GetRecordDecoder(const AnyValue& record,
+                                                      CTypeParser::ByteOrder byte_order);
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_RECORD_DECODER_H_
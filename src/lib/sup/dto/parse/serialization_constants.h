@@ -40,6 +40,7 @@ const std::string INSTANCE_KEY = "instance";
 const std::string TYPE_KEY = "type";
 const std::string MULTIPLICITY_KEY = "multiplicity";
 const std::string ELEMENT_KEY = "element";
+const std::string CAPACITY_KEY = "capacity";
 const std::string ATTRIBUTES_KEY = "attributes";
 
 }  // namespace serialization
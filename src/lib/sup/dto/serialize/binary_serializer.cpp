@@ -32,7 +32,7 @@ namespace sup
 namespace dto
 {
 BinaryTypeSerializer::BinaryTypeSerializer(std::vector<uint8>& representation)
-  : IAnyVisitor<const AnyType>{}
+  : StaticAnyVisitor<const AnyType>{}
   , m_representation{representation}
 {}
 BinaryTypeSerializer::~BinaryTypeSerializer() = default;
@@ -42,18 +42,12 @@ void BinaryTypeSerializer::EmptyProlog(const AnyType*)
   m_representation.push_back(EMPTY_TOKEN);
 }
 
-void BinaryTypeSerializer::EmptyEpilog(const AnyType*)
-{}
-
 void BinaryTypeSerializer::StructProlog(const AnyType* anytype)
 {
   m_representation.push_back(START_STRUCT_TOKEN);
   AppendBinaryString(m_representation, anytype->GetTypeName());
 }
 
-void BinaryTypeSerializer::StructMemberSeparator()
-{}
-
 void BinaryTypeSerializer::StructEpilog(const AnyType*)
 {
   m_representation.push_back(END_STRUCT_TOKEN);
@@ -64,9 +58,6 @@ void BinaryTypeSerializer::MemberProlog(const AnyType*, const std::string& membe
   AppendBinaryString(m_representation, member_name);
 }
 
-void BinaryTypeSerializer::MemberEpilog(const AnyType*, const std::string&)
-{}
-
 void BinaryTypeSerializer::ArrayProlog(const AnyType* anytype)
 {
   m_representation.push_back(START_ARRAY_TOKEN);
@@ -74,9 +65,6 @@ void BinaryTypeSerializer::ArrayProlog(const AnyType* anytype)
   AppendSize(m_representation, anytype->NumberOfElements());
 }
 
-void BinaryTypeSerializer::ArrayElementSeparator()
-{}
-
 void BinaryTypeSerializer::ArrayEpilog(const AnyType*)
 {
   m_representation.push_back(END_ARRAY_TOKEN);
@@ -85,54 +73,28 @@ void BinaryTypeSerializer::ArrayEpilog(const AnyType*)
 void BinaryTypeSerializer::ScalarProlog(const AnyType* anytype)
 {
   AppendScalarToken(m_representation, anytype->GetTypeCode());
+  if (anytype->GetTypeCode() == TypeCode::FixedString)
+  {
+    AppendSize(m_representation, anytype->StringCapacity());
+  }
 }
 
-void BinaryTypeSerializer::ScalarEpilog(const AnyType*)
-{}
-
 BinaryValueSerializer::BinaryValueSerializer(std::vector<uint8>& representation)
-  : IAnyVisitor<const AnyValue>{}
+  : StaticAnyVisitor<const AnyValue>{}
   , m_representation{representation}
 {}
 BinaryValueSerializer::~BinaryValueSerializer() = default;
 
-void BinaryValueSerializer::EmptyProlog(const AnyValue*)
-{}
-
-void BinaryValueSerializer::EmptyEpilog(const AnyValue*)
-{}
-
-void BinaryValueSerializer::StructProlog(const AnyValue*)
-{}
-
-void BinaryValueSerializer::StructMemberSeparator()
-{}
-
-void BinaryValueSerializer::StructEpilog(const AnyValue*)
-{}
-
-void BinaryValueSerializer::MemberProlog(const AnyValue*, const std::string&)
-{}
-
-void BinaryValueSerializer::MemberEpilog(const AnyValue*, const std::string&)
-{}
-
-void BinaryValueSerializer::ArrayProlog(const AnyValue*)
-{}
-
-void BinaryValueSerializer::ArrayElementSeparator()
-{}
-
-void BinaryValueSerializer::ArrayEpilog(const AnyValue*)
-{}
-
 void BinaryValueSerializer::ScalarProlog(const AnyValue* anyvalue)
 {
   AppendBinaryScalar(m_representation, *anyvalue);
 }
 
-void BinaryValueSerializer::ScalarEpilog(const AnyValue*)
-{}
+void BinaryValueSerializer::ScalarLeaf(const AnyValue* anyvalue, TypeCode type_code,
+                                       std::size_t width)
+{
+  AppendBinaryScalar(m_representation, *anyvalue, type_code, width);
+}
 
 }  // namespace dto
 
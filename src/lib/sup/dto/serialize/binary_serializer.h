@@ -23,8 +23,9 @@
 #ifndef SUP_DTO_BINARY_SERIALIZER_H_
 #define SUP_DTO_BINARY_SERIALIZER_H_
 
+#include <sup/dto/anytype.h>
 #include <sup/dto/basic_scalar_types.h>
-#include <sup/dto/i_any_visitor.h>
+#include <sup/dto/visit/static_any_visitor.h>
 
 #include <vector>
 
@@ -35,65 +36,51 @@ namespace dto
 class AnyType;
 class AnyValue;
 
-class BinaryTypeSerializer : public IAnyVisitor<const AnyType>
+class BinaryTypeSerializer : public StaticAnyVisitor<const AnyType>
 {
 public:
   explicit BinaryTypeSerializer(std::vector<uint8>& representation);
-  ~BinaryTypeSerializer() override;
+  ~BinaryTypeSerializer();
 
   BinaryTypeSerializer(const BinaryTypeSerializer& other) = delete;
   BinaryTypeSerializer(BinaryTypeSerializer&& other) = delete;
   BinaryTypeSerializer& operator=(const BinaryTypeSerializer& other) = delete;
   BinaryTypeSerializer& operator=(BinaryTypeSerializer&& other) = delete;
 
-  void EmptyProlog(const AnyType* anytype) override;
-  void EmptyEpilog(const AnyType* anytype) override;
+  void EmptyProlog(const AnyType* anytype);
 
-  void StructProlog(const AnyType* anytype) override;
-  void StructMemberSeparator() override;
-  void StructEpilog(const AnyType* anytype) override;
+  void StructProlog(const AnyType* anytype);
+  void StructEpilog(const AnyType* anytype);
 
-  void MemberProlog(const AnyType* anytype, const std::string& member_name) override;
-  void MemberEpilog(const AnyType* anytype, const std::string& member_name) override;
+  void MemberProlog(const AnyType* anytype, const std::string& member_name);
 
-  void ArrayProlog(const AnyType* anytype) override;
-  void ArrayElementSeparator() override;
-  void ArrayEpilog(const AnyType* anytype) override;
+  void ArrayProlog(const AnyType* anytype);
+  void ArrayEpilog(const AnyType* anytype);
 
-  void ScalarProlog(const AnyType* anytype) override;
-  void ScalarEpilog(const AnyType* anytype) override;
+  void ScalarProlog(const AnyType* anytype);
 
 private:
   std::vector<uint8>& m_representation;
 };
 
-class BinaryValueSerializer : public IAnyVisitor<const AnyValue>
+class BinaryValueSerializer : public StaticAnyVisitor<const AnyValue>
 {
 public:
   explicit BinaryValueSerializer(std::vector<uint8>& representation);
-  ~BinaryValueSerializer() override;
+  ~BinaryValueSerializer();
 
   BinaryValueSerializer(const BinaryValueSerializer& other) = delete;
   BinaryValueSerializer(BinaryValueSerializer&& other) = delete;
   BinaryValueSerializer& operator=(const BinaryValueSerializer& other) = delete;
   BinaryValueSerializer& operator=(BinaryValueSerializer&& other) = delete;
 
-  void EmptyProlog(const AnyValue* anyvalue) override;
-  void EmptyEpilog(const AnyValue* anyvalue) override;
+  void ScalarProlog(const AnyValue* anyvalue);
 
-  void StructProlog(const AnyValue* anyvalue) override;
-  void StructMemberSeparator() override;
-  void StructEpilog(const AnyValue* anyvalue) override;
-
-  void MemberProlog(const AnyValue* anyvalue, const std::string& member_name) override;
-  void MemberEpilog(const AnyValue* anyvalue, const std::string& member_name) override;
-
-  void ArrayProlog(const AnyValue* anyvalue) override;
-  void ArrayElementSeparator() override;
-  void ArrayEpilog(const AnyValue* anyvalue) override;
-
-  void ScalarProlog(const AnyValue* anyvalue) override;
-  void ScalarEpilog(const AnyValue* anyvalue) override;
+  /**
+   * @brief Append a scalar with the type code and width from a SerializationPlan directly to the
+   * representation.
+   */
+  void ScalarLeaf(const AnyValue* anyvalue, TypeCode type_code, std::size_t width);
 
 private:
   std::vector<uint8>& m_representation;
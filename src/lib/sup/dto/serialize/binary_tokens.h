@@ -44,6 +44,7 @@ const sup::dto::uint8 UINT64_TOKEN     = 0x0Au;
 const sup::dto::uint8 FLOAT32_TOKEN    = 0x0Bu;
 const sup::dto::uint8 FLOAT64_TOKEN    = 0x0Cu;
 const sup::dto::uint8 STRING_TOKEN     = 0x0Du;
+const sup::dto::uint8 FIXED_STRING_TOKEN = 0x0Eu;
 
 const sup::dto::uint8 START_STRUCT_TOKEN = 0x20u;
 const sup::dto::uint8 END_STRUCT_TOKEN   = 0x21u;
@@ -32,7 +32,7 @@ namespace dto
 {
 
 CTypeSerializer::CTypeSerializer(ByteOrder byte_order)
-  : IAnyVisitor<const AnyValue>{}
+  : StaticAnyVisitor<const AnyValue>{}
   , m_representation{}
   , m_byte_order{byte_order}
 {}
@@ -43,35 +43,10 @@ std::vector<uint8> CTypeSerializer::GetRepresentation() const
   return m_representation;
 }
 
-void CTypeSerializer::EmptyProlog(const AnyValue*)
-{}
-
-void CTypeSerializer::EmptyEpilog(const AnyValue*)
-{}
-
-void CTypeSerializer::StructProlog(const AnyValue*)
-{}
-
-void CTypeSerializer::StructMemberSeparator()
-{}
-
-void CTypeSerializer::StructEpilog(const AnyValue*)
-{}
-
-void CTypeSerializer::MemberProlog(const AnyValue*, const std::string&)
-{}
-
-void CTypeSerializer::MemberEpilog(const AnyValue*, const std::string&)
-{}
-
-void CTypeSerializer::ArrayProlog(const AnyValue*)
-{}
-
-void CTypeSerializer::ArrayElementSeparator()
-{}
-
-void CTypeSerializer::ArrayEpilog(const AnyValue*)
-{}
+void CTypeSerializer::Reserve(std::size_t size)
+{
+  m_representation.reserve(size);
+}
 
 void CTypeSerializer::ScalarProlog(const AnyValue* anyvalue)
 {
@@ -80,8 +55,20 @@ void CTypeSerializer::ScalarProlog(const AnyValue* anyvalue)
   (void)m_representation.insert(m_representation.cend(), byte_val.begin(), byte_val.end());
 }
 
-void CTypeSerializer::ScalarEpilog(const AnyValue*)
-{}
+void CTypeSerializer::ScalarLeaf(const AnyValue* anyvalue, TypeCode type_code, std::size_t width)
+{
+  const auto position = m_representation.size();
+  m_representation.resize(position + width);
+  auto* dest = m_representation.data() + position;
+  if (m_byte_order == ByteOrder::Host)
+  {
+    WriteScalarToHostOrder(*anyvalue, type_code, width, dest);
+  }
+  else
+  {
+    WriteScalarToNetworkOrder(*anyvalue, type_code, width, dest);
+  }
+}
 
 }  // namespace dto
 
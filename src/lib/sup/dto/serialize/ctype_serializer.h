@@ -23,8 +23,9 @@
 #ifndef SUP_DTO_CTYPE_SERIALIZER_H_
 #define SUP_DTO_CTYPE_SERIALIZER_H_
 
+#include <sup/dto/anytype.h>
 #include <sup/dto/basic_scalar_types.h>
-#include <sup/dto/i_any_visitor.h>
+#include <sup/dto/visit/static_any_visitor.h>
 
 #include <vector>
 
@@ -42,7 +43,7 @@ class AnyValue;
  * @note The serializer can either use network byte order or host byte order.
  *
  */
-class CTypeSerializer : public IAnyVisitor<const AnyValue>
+class CTypeSerializer : public StaticAnyVisitor<const AnyValue>
 {
 public:
   enum class ByteOrder : sup::dto::uint32
@@ -51,7 +52,7 @@ public:
     Network
   };
   explicit CTypeSerializer(ByteOrder byte_order);
-  ~CTypeSerializer() override;
+  ~CTypeSerializer();
 
   CTypeSerializer(const CTypeSerializer& other) = delete;
   CTypeSerializer(CTypeSerializer&& other) = delete;
@@ -60,22 +61,18 @@ public:
 
   std::vector<uint8> GetRepresentation() const;
 
-  void EmptyProlog(const AnyValue* anyvalue) override;
-  void EmptyEpilog(const AnyValue* anyvalue) override;
+  /**
+   * @brief Reserve memory for a representation of the given size.
+   */
+  void Reserve(std::size_t size);
 
-  void StructProlog(const AnyValue* anyvalue) override;
-  void StructMemberSeparator() override;
-  void StructEpilog(const AnyValue* anyvalue) override;
+  void ScalarProlog(const AnyValue* anyvalue);
 
-  void MemberProlog(const AnyValue* anyvalue, const std::string& member_name) override;
-  void MemberEpilog(const AnyValue* anyvalue, const std::string& member_name) override;
-
-  void ArrayProlog(const AnyValue* anyvalue) override;
-  void ArrayElementSeparator() override;
-  void ArrayEpilog(const AnyValue* anyvalue) override;
-
-  void ScalarProlog(const AnyValue* anyvalue) override;
-  void ScalarEpilog(const AnyValue* anyvalue) override;
+  /**
+   * @brief Write a scalar with the type code and width from a SerializationPlan directly into the
+   * representation.
+   */
+  void ScalarLeaf(const AnyValue* anyvalue, TypeCode type_code, std::size_t width);
 
 private:
   std::vector<uint8> m_representation;
@@ -66,7 +66,8 @@ bool WriteScalarValue(const AnyValue& anyvalue, IWriter* writer)
     {TypeCode::UInt64, WriteScalarValueT<uint64, &IWriter::Uint64> },
     {TypeCode::Float32, WriteScalarValueT<float32, &IWriter::Float> },
     {TypeCode::Float64, WriteScalarValueT<float64, &IWriter::Double> },
-    {TypeCode::String, WriteScalarString }
+    {TypeCode::String, WriteScalarString },
+    {TypeCode::FixedString, WriteScalarString }
   };
   const auto it = conversion_map.find(anyvalue.GetTypeCode());
   if (it == conversion_map.end())
@@ -0,0 +1,301 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "network_order_layout.h"
+
+#include <sup/dto/low_level/arithmetic_to_bytes_t.h>
+#include <sup/dto/low_level/byte_swap.h>
+#include <sup/dto/low_level/scalar_from_bytes.h>
+#include <sup/dto/serialize/serialization_plan.h>
+#include <sup/dto/serialize/type_keyed_cache.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+// Maximum number of layouts kept in the global cache; least recently used layouts are evicted
+// first:
+const std::size_t kMaxCachedLayouts = 256;
+
+std::size_t PackedLeafWidth(const AnyType& anytype);
+
+// Check if the type of the value does not contain unbounded arrays:
+bool HasFixedSize(const AnyValue& anyvalue);
+
+TypeKeyedCache<NetworkOrderLayout>& GetLayoutCache();
+
+void AppendRun(std::vector<SwapRun>& runs, std::size_t offset, std::size_t count,
+               std::size_t width, TypeCode type_code);
+}  // unnamed namespace
+
+NetworkOrderLayout::NetworkOrderLayout(const AnyType& anytype)
+  : m_layout{anytype, 1}
+  , m_swap_runs{}
+  , m_leaves{}
+{
+  std::size_t offset = 0;
+  AppendLeaves(m_layout.GetType(), offset);
+}
+
+NetworkOrderLayout::~NetworkOrderLayout() = default;
+
+const AnyType& NetworkOrderLayout::GetType() const
+{
+  return m_layout.GetType();
+}
+
+std::size_t NetworkOrderLayout::GetSize() const
+{
+  return m_layout.GetSize();
+}
+
+const std::vector<SwapRun>& NetworkOrderLayout::GetSwapRuns() const
+{
+  return m_swap_runs;
+}
+
+const std::vector<NetworkOrderLeaf>& NetworkOrderLayout::GetLeaves() const
+{
+  return m_leaves;
+}
+
+std::vector<uint8> NetworkOrderLayout::Write(const AnyValue& anyvalue) const
+{
+  std::vector<uint8> result(m_layout.GetSize(), 0);
+  m_layout.Write(anyvalue, result.data(), result.size());
+  SwapByteOrder(result.data());
+  return result;
+}
+
+void NetworkOrderLayout::Read(AnyValue& anyvalue, const uint8* bytes, std::size_t total_size) const
+{
+  std::vector<uint8> buffer;
+  Read(anyvalue, bytes, total_size, buffer);
+}
+
+void NetworkOrderLayout::Read(AnyValue& anyvalue, const uint8* bytes, std::size_t total_size,
+                              std::vector<uint8>& buffer) const
+{
+  if (total_size != m_layout.GetSize())
+  {
+    throw ParseException("NetworkOrderLayout::Read(): size mismatch");
+  }
+  if (!m_swap_runs.empty())
+  {
+    buffer.assign(bytes, bytes + total_size);
+    SwapByteOrder(buffer.data());
+    bytes = buffer.data();
+  }
+  if (ReadNode(anyvalue, bytes, 0) != m_leaves.size())
+  {
+    throw ParseException("NetworkOrderLayout::Read(): value has fewer leaves than the layout");
+  }
+}
+
+void NetworkOrderLayout::SwapByteOrder(uint8* bytes) const
+{
+  for (const auto& run : m_swap_runs)
+  {
+    ByteSwapRun(bytes + run.offset, run.count, run.width);
+  }
+}
+
+void NetworkOrderLayout::AppendLeaves(const AnyType& anytype, std::size_t& offset)
+{
+  if (IsStructType(anytype))
+  {
+    const auto n_members = anytype.NumberOfMembers();
+    for (std::size_t idx = 0; idx < n_members; ++idx)
+    {
+      AppendLeaves(*anytype.GetChildType(idx), offset);
+    }
+    return;
+  }
+  if (IsArrayType(anytype))
+  {
+    const auto n_elements = anytype.NumberOfElements();
+    if (n_elements == 0)
+    {
+      throw InvalidOperationException(
+        "NetworkOrderLayout(): types with unbounded arrays have no fixed layout");
+    }
+    const auto& element_type = *anytype.GetChildType(0);
+    if (IsScalarType(element_type))
+    {
+      // Arrays of scalars form a single run
+      const auto type_code = element_type.GetTypeCode();
+      const auto width = PackedLeafWidth(element_type);
+      AppendRun(m_swap_runs, offset, n_elements, width, type_code);
+      for (std::size_t idx = 0; idx < n_elements; ++idx)
+      {
+        m_leaves.push_back({offset, type_code, width});
+        offset += width;
+      }
+      return;
+    }
+    for (std::size_t idx = 0; idx < n_elements; ++idx)
+    {
+      AppendLeaves(element_type, offset);
+    }
+    return;
+  }
+  if (IsScalarType(anytype))
+  {
+    const auto width = PackedLeafWidth(anytype);
+    AppendRun(m_swap_runs, offset, 1, width, anytype.GetTypeCode());
+    m_leaves.push_back({offset, anytype.GetTypeCode(), width});
+    offset += width;
+  }
+}
+
+std::size_t NetworkOrderLayout::ReadNode(AnyValue& anyvalue, const uint8* bytes,
+                                         std::size_t leaf_idx) const
+{
+  const auto n_children = anyvalue.NumberOfChildren();
+  if (n_children > 0)
+  {
+    for (std::size_t idx = 0; idx < n_children; ++idx)
+    {
+      leaf_idx = ReadNode(*anyvalue.GetChildValue(idx), bytes, leaf_idx);
+    }
+    return leaf_idx;
+  }
+  if (!anyvalue.IsScalar())
+  {
+    return leaf_idx;
+  }
+  if (leaf_idx >= m_leaves.size() || m_leaves[leaf_idx].type_code != anyvalue.GetTypeCode())
+  {
+    throw ParseException("NetworkOrderLayout::Read(): value doesn't match the layout");
+  }
+  const auto& leaf = m_leaves[leaf_idx];
+  ReadScalarFromHostOrder(anyvalue, leaf.type_code, leaf.width, bytes + leaf.offset);
+  return leaf_idx + 1;
+}
+
+std::shared_ptr<const NetworkOrderLayout> GetNetworkOrderLayout(const AnyType& anytype)
+{
+  auto matches = [&anytype](const NetworkOrderLayout& layout) {
+    return MatchesShape(anytype, layout.GetType());
+  };
+  auto compile = [&anytype]() {
+    return std::make_shared<const NetworkOrderLayout>(anytype);
+  };
+  return GetLayoutCache().Get(ShapeHash(anytype), matches, compile);
+}
+
+std::shared_ptr<const NetworkOrderLayout> GetNetworkOrderLayout(const AnyValue& anyvalue)
+{
+  if (!HasFixedSize(anyvalue))
+  {
+    return nullptr;
+  }
+  auto matches = [&anyvalue](const NetworkOrderLayout& layout) {
+    return MatchesShape(anyvalue, layout.GetType());
+  };
+  auto compile = [&anyvalue]() {
+    return std::make_shared<const NetworkOrderLayout>(anyvalue.GetType());
+  };
+  return GetLayoutCache().Get(ShapeHash(anyvalue), matches, compile);
+}
+
+namespace
+{
+std::size_t PackedLeafWidth(const AnyType& anytype)
+{
+  switch (anytype.GetTypeCode())
+  {
+  case TypeCode::Int16:
+  case TypeCode::UInt16:
+    return sizeof(uint16);
+  case TypeCode::Int32:
+  case TypeCode::UInt32:
+  case TypeCode::Float32:
+    return sizeof(uint32);
+  case TypeCode::Int64:
+  case TypeCode::UInt64:
+  case TypeCode::Float64:
+    return sizeof(uint64);
+  case TypeCode::String:
+    return kStringMaxLength;
+  case TypeCode::FixedString:
+    return anytype.StringCapacity();
+  default:
+    break;
+  }
+  return sizeof(uint8);
+}
+
+bool HasFixedSize(const AnyValue& anyvalue)
+{
+  if (IsArrayValue(anyvalue))
+  {
+    // All elements have the same type:
+    return anyvalue.NumberOfElements() > 0 && HasFixedSize(*anyvalue.GetChildValue(0));
+  }
+  const auto n_children = anyvalue.NumberOfChildren();
+  for (std::size_t idx = 0; idx < n_children; ++idx)
+  {
+    if (!HasFixedSize(*anyvalue.GetChildValue(idx)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+TypeKeyedCache<NetworkOrderLayout>& GetLayoutCache()
+{
+  static TypeKeyedCache<NetworkOrderLayout> cache{kMaxCachedLayouts};
+  return cache;
+}
+
+void AppendRun(std::vector<SwapRun>& runs, std::size_t offset, std::size_t count,
+               std::size_t width, TypeCode type_code)
+{
+  // Single bytes and strings keep their byte order, as does everything on big endian platforms
+  const bool is_string = type_code == TypeCode::String || type_code == TypeCode::FixedString;
+  if (width == sizeof(uint8) || is_string || !IsLittleEndian())
+  {
+    return;
+  }
+  if (!runs.empty())
+  {
+    auto& last = runs.back();
+    if (last.width == width && last.offset + last.count * last.width == offset)
+    {
+      last.count += count;
+      return;
+    }
+  }
+  runs.push_back({offset, count, width});
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
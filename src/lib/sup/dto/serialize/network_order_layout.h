@@ -0,0 +1,156 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_NETWORK_ORDER_LAYOUT_H_
+#define SUP_DTO_NETWORK_ORDER_LAYOUT_H_
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/ctype_layout.h>
+
+#include <memory>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+class AnyValue;
+
+/**
+ * @brief Run of consecutive scalar leaves with the same width in a packed byte representation.
+ */
+struct SwapRun
+{
+  std::size_t offset;
+  std::size_t count;
+  std::size_t width;
+};
+
+/**
+ * @brief Location of a single scalar leaf in a packed byte representation.
+ */
+struct NetworkOrderLeaf
+{
+  std::size_t offset;
+  TypeCode type_code;
+  std::size_t width;
+};
+
+/**
+ * @brief Packed byte layout of a fixed size type (as produced by ToBytes) together with the runs
+ * of leaves that need to be byte swapped to convert between host and network byte order.
+ *
+ * @details Values are written to the packed host order representation with direct stores at
+ * precomputed offsets. The byte order of the whole buffer is then converted run by run, so that
+ * homogeneous runs (e.g. arrays of scalars) are swapped with vector shuffles. Reading does the
+ * reverse: the input is copied to a buffer, swapped there run by run and its leaves are then loaded
+ * in host byte order from their offsets. On big endian platforms, there are no runs to swap and
+ * the input is read directly.
+ */
+class NetworkOrderLayout
+{
+public:
+  /**
+   * @throws InvalidOperationException Thrown when the type does not have a fixed size, i.e. when it
+   * contains unbounded arrays.
+   */
+  explicit NetworkOrderLayout(const AnyType& anytype);
+  ~NetworkOrderLayout();
+
+  NetworkOrderLayout(const NetworkOrderLayout& other) = delete;
+  NetworkOrderLayout(NetworkOrderLayout&& other) = delete;
+  NetworkOrderLayout& operator=(const NetworkOrderLayout& other) = delete;
+  NetworkOrderLayout& operator=(NetworkOrderLayout&& other) = delete;
+
+  const AnyType& GetType() const;
+
+  std::size_t GetSize() const;
+
+  const std::vector<SwapRun>& GetSwapRuns() const;
+
+  const std::vector<NetworkOrderLeaf>& GetLeaves() const;
+
+  /**
+   * @brief Serialize a value of the layout's type in network byte order.
+   *
+   * @throws SerializeException Thrown when the value cannot be serialized (e.g. string too long).
+   */
+  std::vector<uint8> Write(const AnyValue& anyvalue) const;
+
+  /**
+   * @brief Parse a value of the layout's type from bytes in network byte order.
+   *
+   * @throws ParseException Thrown when the bytes cannot be parsed (e.g. size mismatch or absence
+   * of null terminator in a string) or when the leaves of the value do not match the layout. The
+   * value can then be partially assigned.
+   */
+  void Read(AnyValue& anyvalue, const uint8* bytes, std::size_t total_size) const;
+
+  /**
+   * @brief Parse a value of the layout's type from bytes in network byte order, using the given
+   * buffer for the byte swapped copy of the input. Reusing the buffer avoids an allocation per
+   * value.
+   *
+   * @throws ParseException See above.
+   */
+  void Read(AnyValue& anyvalue, const uint8* bytes, std::size_t total_size,
+            std::vector<uint8>& buffer) const;
+
+  /**
+   * @brief Convert the byte order of a packed representation between host and network order.
+   */
+  void SwapByteOrder(uint8* bytes) const;
+
+private:
+  void AppendLeaves(const AnyType& anytype, std::size_t& offset);
+  std::size_t ReadNode(AnyValue& anyvalue, const uint8* bytes, std::size_t leaf_idx) const;
+  CLayout m_layout;
+  std::vector<SwapRun> m_swap_runs;
+  std::vector<NetworkOrderLeaf> m_leaves;
+};
+
+/**
+ * @brief Retrieve the (shared) layout for the given type from a global cache, creating it first
+ * when it was not yet cached.
+ *
+ * @throws InvalidOperationException Thrown when the type contains unbounded arrays.
+ *
+ * @note This function is thread safe.
+ */
+std::shared_ptr<const NetworkOrderLayout> GetNetworkOrderLayout(const AnyType& anytype);
+
+/**
+ * @brief Retrieve the (shared) layout for the type of the given value, without constructing that
+ * type unless the layout needs to be created.
+ *
+ * @return Layout or nullptr when the type of the value does not have a fixed size, i.e. when it
+ * contains unbounded arrays.
+ *
+ * @note This function is thread safe.
+ */
+std::shared_ptr<const NetworkOrderLayout> GetNetworkOrderLayout(const AnyValue& anyvalue);
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_NETWORK_ORDER_LAYOUT_H_
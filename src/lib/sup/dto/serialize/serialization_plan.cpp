@@ -0,0 +1,484 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "serialization_plan.h"
+
+#include <sup/dto/serialize/type_keyed_cache.h>
+#include <sup/dto/visit/static_any_visitor.h>
+#include <sup/dto/visit/visit_t.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <functional>
+
+namespace sup
+{
+namespace dto
+{
+namespace
+{
+// Maximum number of plans kept in the global cache; least recently used plans are evicted first:
+const std::size_t kMaxCachedPlans = 256;
+
+/**
+ * @brief Visitor that appends the plan instructions for a visited AnyType.
+ */
+class PlanCompiler : public StaticAnyVisitor<const AnyType>
+{
+public:
+  explicit PlanCompiler(std::vector<PlanInstruction>& instructions);
+  ~PlanCompiler();
+
+  PlanCompiler(const PlanCompiler& other) = delete;
+  PlanCompiler(PlanCompiler&& other) = delete;
+  PlanCompiler& operator=(const PlanCompiler& other) = delete;
+  PlanCompiler& operator=(PlanCompiler&& other) = delete;
+
+  bool HasFixedSize() const;
+  std::size_t GetFixedSize() const;
+
+  void EmptyProlog(const AnyType* anytype);
+
+  void StructProlog(const AnyType* anytype);
+  void StructEpilog(const AnyType* anytype);
+
+  void MemberProlog(const AnyType* anytype, const std::string& member_name);
+  void MemberEpilog(const AnyType* anytype, const std::string& member_name);
+
+  void ArrayProlog(const AnyType* anytype);
+  void ArrayEpilog(const AnyType* anytype);
+
+  void ScalarProlog(const AnyType* anytype);
+
+private:
+  void AddInstruction(PlanOpcode opcode, TypeCode type_code, std::size_t index,
+                      std::size_t width, const std::string* member_name);
+  std::vector<PlanInstruction>& m_instructions;
+  std::vector<std::size_t> m_member_counters;
+  std::vector<std::size_t> m_array_positions;
+  std::vector<std::size_t> m_sizes;
+  bool m_has_fixed_size;
+};
+
+/**
+ * @brief Visitor that combines the structural information of an AnyType into a hash.
+ */
+class TypeHasher : public StaticAnyVisitor<const AnyType>
+{
+public:
+  TypeHasher();
+  ~TypeHasher();
+
+  TypeHasher(const TypeHasher& other) = delete;
+  TypeHasher(TypeHasher&& other) = delete;
+  TypeHasher& operator=(const TypeHasher& other) = delete;
+  TypeHasher& operator=(TypeHasher&& other) = delete;
+
+  std::size_t GetHash() const;
+
+  void EmptyProlog(const AnyType* anytype);
+
+  void StructProlog(const AnyType* anytype);
+  void StructEpilog(const AnyType* anytype);
+
+  void MemberProlog(const AnyType* anytype, const std::string& member_name);
+
+  void ArrayProlog(const AnyType* anytype);
+  void ArrayEpilog(const AnyType* anytype);
+
+  void ScalarProlog(const AnyType* anytype);
+
+private:
+  void Combine(std::size_t value);
+  std::size_t m_hash;
+};
+
+std::size_t CTypeWidth(const AnyType& anytype);
+
+TypeKeyedCache<SerializationPlan>& GetPlanCache();
+
+template <typename T>
+std::size_t ShapeHashT(const T& node);
+
+template <typename T>
+bool MatchesShapeT(const T& node, const AnyType& other);
+}  // unnamed namespace
+
+SerializationPlan::SerializationPlan(const AnyType& anytype)
+  : m_anytype{anytype}
+  , m_instructions{}
+  , m_has_fixed_size{true}
+  , m_fixed_size{0}
+{
+  Compile();
+}
+
+SerializationPlan::~SerializationPlan() = default;
+
+const AnyType& SerializationPlan::GetType() const
+{
+  return m_anytype;
+}
+
+const std::vector<PlanInstruction>& SerializationPlan::GetInstructions() const
+{
+  return m_instructions;
+}
+
+bool SerializationPlan::Matches(const AnyValue& anyvalue) const
+{
+  return MatchesShape(anyvalue, m_anytype);
+}
+
+bool SerializationPlan::HasFixedSize() const
+{
+  return m_has_fixed_size;
+}
+
+std::size_t SerializationPlan::GetFixedSize() const
+{
+  return m_fixed_size;
+}
+
+void SerializationPlan::Compile()
+{
+  // Member names in the instructions refer to the names stored in the plan's own type:
+  PlanCompiler compiler{m_instructions};
+  VisitStatic<PlanCompiler, const AnyType>(m_anytype, compiler);
+  m_has_fixed_size = compiler.HasFixedSize();
+  m_fixed_size = m_has_fixed_size ? compiler.GetFixedSize() : 0;
+}
+
+std::shared_ptr<const SerializationPlan> GetSerializationPlan(const AnyType& anytype)
+{
+  auto matches = [&anytype](const SerializationPlan& plan) {
+    return MatchesShape(anytype, plan.GetType());
+  };
+  auto compile = [&anytype]() { return std::make_shared<const SerializationPlan>(anytype); };
+  return GetPlanCache().Get(ShapeHash(anytype), matches, compile);
+}
+
+std::shared_ptr<const SerializationPlan> GetSerializationPlan(const AnyValue& anyvalue)
+{
+  auto matches = [&anyvalue](const SerializationPlan& plan) { return plan.Matches(anyvalue); };
+  auto compile = [&anyvalue]() {
+    return std::make_shared<const SerializationPlan>(anyvalue.GetType());
+  };
+  return GetPlanCache().Get(ShapeHash(anyvalue), matches, compile);
+}
+
+std::size_t AnyTypeHash(const AnyType& anytype)
+{
+  TypeHasher hasher;
+  VisitStatic<TypeHasher, const AnyType>(anytype, hasher);
+  return hasher.GetHash();
+}
+
+std::size_t CombineHashes(std::size_t lhs, std::size_t rhs)
+{
+  // Same mixing as boost::hash_combine
+  return lhs ^ (rhs + 0x9e3779b9u + (lhs << 6) + (lhs >> 2));
+}
+
+std::size_t ShapeHash(const AnyType& anytype)
+{
+  return ShapeHashT(anytype);
+}
+
+std::size_t ShapeHash(const AnyValue& anyvalue)
+{
+  return ShapeHashT(anyvalue);
+}
+
+bool MatchesShape(const AnyType& anytype, const AnyType& other)
+{
+  return MatchesShapeT(anytype, other);
+}
+
+bool MatchesShape(const AnyValue& anyvalue, const AnyType& other)
+{
+  return MatchesShapeT(anyvalue, other);
+}
+
+namespace
+{
+PlanCompiler::PlanCompiler(std::vector<PlanInstruction>& instructions)
+  : StaticAnyVisitor<const AnyType>{}
+  , m_instructions{instructions}
+  , m_member_counters{}
+  , m_array_positions{}
+  , m_sizes(1u, 0u)
+  , m_has_fixed_size{true}
+{}
+
+PlanCompiler::~PlanCompiler() = default;
+
+bool PlanCompiler::HasFixedSize() const
+{
+  return m_has_fixed_size;
+}
+
+std::size_t PlanCompiler::GetFixedSize() const
+{
+  return m_sizes.front();
+}
+
+void PlanCompiler::EmptyProlog(const AnyType* anytype)
+{
+  AddInstruction(PlanOpcode::kEmpty, anytype->GetTypeCode(), 0, 0, nullptr);
+}
+
+void PlanCompiler::StructProlog(const AnyType* anytype)
+{
+  AddInstruction(PlanOpcode::kStructBegin, anytype->GetTypeCode(), 0, 0, nullptr);
+  m_member_counters.push_back(0);
+}
+
+void PlanCompiler::StructEpilog(const AnyType* anytype)
+{
+  m_member_counters.pop_back();
+  AddInstruction(PlanOpcode::kStructEnd, anytype->GetTypeCode(), 0, 0, nullptr);
+}
+
+void PlanCompiler::MemberProlog(const AnyType* anytype, const std::string& member_name)
+{
+  const auto member_idx = m_member_counters.back()++;
+  AddInstruction(PlanOpcode::kMemberBegin, anytype->GetTypeCode(), member_idx, 0,
+                 &member_name);
+}
+
+void PlanCompiler::MemberEpilog(const AnyType* anytype, const std::string& member_name)
+{
+  const auto member_idx = m_member_counters.back() - 1;
+  AddInstruction(PlanOpcode::kMemberEnd, anytype->GetTypeCode(), member_idx, 0, &member_name);
+}
+
+void PlanCompiler::ArrayProlog(const AnyType* anytype)
+{
+  m_array_positions.push_back(m_instructions.size());
+  AddInstruction(PlanOpcode::kArrayBegin, anytype->GetTypeCode(), 0, 0, nullptr);
+  m_sizes.push_back(0);
+}
+
+void PlanCompiler::ArrayEpilog(const AnyType* anytype)
+{
+  const auto begin_pos = m_array_positions.back();
+  m_array_positions.pop_back();
+  m_instructions[begin_pos].index = m_instructions.size();
+  AddInstruction(PlanOpcode::kArrayEnd, anytype->GetTypeCode(), begin_pos + 1, 0, nullptr);
+  const auto n_elements = anytype->NumberOfElements();
+  if (n_elements == 0)
+  {
+    m_has_fixed_size = false;
+  }
+  const auto element_size = m_sizes.back();
+  m_sizes.pop_back();
+  m_sizes.back() += n_elements * element_size;
+}
+
+void PlanCompiler::ScalarProlog(const AnyType* anytype)
+{
+  const auto type_code = anytype->GetTypeCode();
+  const auto width = CTypeWidth(*anytype);
+  AddInstruction(PlanOpcode::kScalar, type_code, 0, width, nullptr);
+  m_sizes.back() += width;
+}
+
+void PlanCompiler::AddInstruction(PlanOpcode opcode, TypeCode type_code, std::size_t index,
+                                  std::size_t width, const std::string* member_name)
+{
+  m_instructions.push_back({ opcode, type_code, index, width, member_name });
+}
+
+TypeHasher::TypeHasher()
+  : StaticAnyVisitor<const AnyType>{}
+  , m_hash{0}
+{}
+
+TypeHasher::~TypeHasher() = default;
+
+std::size_t TypeHasher::GetHash() const
+{
+  return m_hash;
+}
+
+void TypeHasher::EmptyProlog(const AnyType* anytype)
+{
+  Combine(std::hash<TypeCode>{}(anytype->GetTypeCode()));
+}
+
+void TypeHasher::StructProlog(const AnyType* anytype)
+{
+  Combine(std::hash<TypeCode>{}(anytype->GetTypeCode()));
+  Combine(std::hash<std::string>{}(anytype->GetTypeName()));
+}
+
+void TypeHasher::StructEpilog(const AnyType*)
+{
+  Combine(std::hash<TypeCode>{}(TypeCode::Struct));
+}
+
+void TypeHasher::MemberProlog(const AnyType*, const std::string& member_name)
+{
+  Combine(std::hash<std::string>{}(member_name));
+}
+
+void TypeHasher::ArrayProlog(const AnyType* anytype)
+{
+  Combine(std::hash<TypeCode>{}(anytype->GetTypeCode()));
+  Combine(std::hash<std::string>{}(anytype->GetTypeName()));
+  Combine(std::hash<std::size_t>{}(anytype->NumberOfElements()));
+}
+
+void TypeHasher::ArrayEpilog(const AnyType*)
+{
+  Combine(std::hash<TypeCode>{}(TypeCode::Array));
+}
+
+void TypeHasher::ScalarProlog(const AnyType* anytype)
+{
+  Combine(std::hash<TypeCode>{}(anytype->GetTypeCode()));
+  Combine(std::hash<std::size_t>{}(anytype->StringCapacity()));
+}
+
+void TypeHasher::Combine(std::size_t value)
+{
+  // Same mixing as boost::hash_combine
+  m_hash ^= value + 0x9e3779b9u + (m_hash << 6) + (m_hash >> 2);
+}
+
+std::size_t CTypeWidth(const AnyType& anytype)
+{
+  switch (anytype.GetTypeCode())
+  {
+  case TypeCode::Bool:
+    return sizeof(boolean);
+  case TypeCode::Char8:
+    return sizeof(char8);
+  case TypeCode::Int8:
+    return sizeof(int8);
+  case TypeCode::UInt8:
+    return sizeof(uint8);
+  case TypeCode::Int16:
+    return sizeof(int16);
+  case TypeCode::UInt16:
+    return sizeof(uint16);
+  case TypeCode::Int32:
+    return sizeof(int32);
+  case TypeCode::UInt32:
+    return sizeof(uint32);
+  case TypeCode::Int64:
+    return sizeof(int64);
+  case TypeCode::UInt64:
+    return sizeof(uint64);
+  case TypeCode::Float32:
+    return sizeof(float32);
+  case TypeCode::Float64:
+    return sizeof(float64);
+  case TypeCode::String:
+    return kStringMaxLength;
+  case TypeCode::FixedString:
+    return anytype.StringCapacity();
+  default:
+    break;
+  }
+  return 0;
+}
+
+TypeKeyedCache<SerializationPlan>& GetPlanCache()
+{
+  static TypeKeyedCache<SerializationPlan> cache{kMaxCachedPlans};
+  return cache;
+}
+
+template <typename T>
+std::size_t ShapeHashT(const T& node)
+{
+  const auto type_code = node.GetTypeCode();
+  auto hash = std::hash<TypeCode>{}(type_code);
+  if (IsStructTypeCode(type_code))
+  {
+    const auto n_members = node.NumberOfMembers();
+    for (std::size_t idx = 0; idx < n_members; ++idx)
+    {
+      hash = CombineHashes(hash, std::hash<std::string>{}(GetIndexedMemberName(&node, idx)));
+      hash = CombineHashes(hash, ShapeHashT(*GetIndexedChild(&node, idx)));
+    }
+  }
+  else if (IsArrayTypeCode(type_code))
+  {
+    // All elements have the same type:
+    const auto n_elements = node.NumberOfElements();
+    hash = CombineHashes(hash, n_elements);
+    if (n_elements > 0)
+    {
+      hash = CombineHashes(hash, ShapeHashT(*GetIndexedChild(&node, 0)));
+    }
+  }
+  else if (type_code == TypeCode::FixedString)
+  {
+    hash = CombineHashes(hash, node.StringCapacity());
+  }
+  return hash;
+}
+
+template <typename T>
+bool MatchesShapeT(const T& node, const AnyType& other)
+{
+  const auto type_code = node.GetTypeCode();
+  if (type_code != other.GetTypeCode())
+  {
+    return false;
+  }
+  if (IsStructTypeCode(type_code))
+  {
+    const auto n_members = node.NumberOfMembers();
+    if (other.NumberOfMembers() != n_members)
+    {
+      return false;
+    }
+    for (std::size_t idx = 0; idx < n_members; ++idx)
+    {
+      if (GetIndexedMemberName(&node, idx) != other.GetMemberName(idx) ||
+          !MatchesShapeT(*GetIndexedChild(&node, idx), *other.GetChildType(idx)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (IsArrayTypeCode(type_code))
+  {
+    const auto n_elements = node.NumberOfElements();
+    if (other.NumberOfElements() != n_elements)
+    {
+      return false;
+    }
+    return n_elements == 0 || MatchesShapeT(*GetIndexedChild(&node, 0), *other.GetChildType(0));
+  }
+  return node.StringCapacity() == other.StringCapacity();
+}
+}  // unnamed namespace
+
+}  // namespace dto
+
+}  // namespace sup
@@ -0,0 +1,307 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_SERIALIZATION_PLAN_H_
+#define SUP_DTO_SERIALIZATION_PLAN_H_
+
+#include <sup/dto/visit/visit_frame.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+class AnyValue;
+
+/**
+ * @brief Operation codes of the instructions in a SerializationPlan.
+ */
+enum class PlanOpcode : sup::dto::uint32
+{
+  kEmpty = 0,
+  kStructBegin,
+  kStructEnd,
+  kMemberBegin,
+  kMemberEnd,
+  kArrayBegin,
+  kArrayEnd,
+  kScalar
+};
+
+/**
+ * @brief Single instruction of a SerializationPlan.
+ *
+ * @details The meaning of the index depends on the operation:
+ * - kMemberBegin/kMemberEnd: index of the member in its parent structure;
+ * - kArrayBegin: position of the matching kArrayEnd instruction;
+ * - kArrayEnd: position of the first instruction of the array element.
+ *
+ * Scalar instructions also carry the fixed width of their C-type representation.
+ */
+struct PlanInstruction
+{
+  PlanOpcode opcode;
+  TypeCode type_code;
+  std::size_t index;
+  std::size_t width;
+  const std::string* member_name;
+};
+
+/**
+ * @brief Flat instruction list, compiled from an AnyType, that drives the serialization or parsing
+ * of any value of that type.
+ *
+ * @details Executing a plan calls the same visitor callbacks, in the same order, as visiting the
+ * value with VisitStatic, so the existing serializers (encoding) and parsers (decoding) can be used
+ * unchanged. The structure of the value is not rediscovered during execution: type codes, member
+ * names and member indices are taken from the plan. Array elements are handled by looping over
+ * the instructions of the element type, so the size of the plan only depends on the type and not
+ * on the number of elements in its arrays.
+ *
+ * Visitors that write or read a byte representation can provide an additional callback
+ * ScalarLeaf(node, type_code, width). Scalar instructions then call this callback with the type
+ * code and C-type width from the plan, instead of ScalarProlog and ScalarEpilog, so that the
+ * visitor can dispatch on them and copy the leaf directly from or into its buffer.
+ *
+ * @note The behavior is only defined for values that have the same shape (see ShapeHash) as the
+ * type the plan was compiled from.
+ */
+class SerializationPlan
+{
+public:
+  explicit SerializationPlan(const AnyType& anytype);
+  ~SerializationPlan();
+
+  SerializationPlan(const SerializationPlan& other) = delete;
+  SerializationPlan(SerializationPlan&& other) = delete;
+  SerializationPlan& operator=(const SerializationPlan& other) = delete;
+  SerializationPlan& operator=(SerializationPlan&& other) = delete;
+
+  /**
+   * @brief Get the type the plan was compiled from.
+   *
+   * @note Cached plans are shared between types with the same shape, so the type names of this
+   * type can differ from those of the type or value the plan was retrieved for.
+   */
+  const AnyType& GetType() const;
+
+  const std::vector<PlanInstruction>& GetInstructions() const;
+
+  /**
+   * @brief Check if the plan can be executed on the given value, i.e. if the value has the same
+   * shape as the plan's type.
+   */
+  bool Matches(const AnyValue& anyvalue) const;
+
+  /**
+   * @brief Check if the C-type representation of all values of the plan's type has the same size.
+   * This is the case when the type contains no unbounded arrays.
+   */
+  bool HasFixedSize() const;
+
+  /**
+   * @brief Size of the C-type representation of values of the plan's type, when HasFixedSize()
+   * returns true.
+   */
+  std::size_t GetFixedSize() const;
+
+  /**
+   * @brief Execute the plan on the given value, calling the visitor callbacks that are resolved
+   * at compile time.
+   *
+   * @throws InvalidOperationException Thrown when the value's type code does not correspond to the
+   * plan's type.
+   */
+  template <typename Visitor, typename T>
+  void Execute(T& any, Visitor& visitor) const;
+
+private:
+  void Compile();
+  AnyType m_anytype;
+  std::vector<PlanInstruction> m_instructions;
+  bool m_has_fixed_size;
+  std::size_t m_fixed_size;
+};
+
+/**
+ * @brief Retrieve the (shared) serialization plan for the given type from a global cache,
+ * compiling it first when it was not yet cached.
+ *
+ * @note This function is thread safe.
+ */
+std::shared_ptr<const SerializationPlan> GetSerializationPlan(const AnyType& anytype);
+
+/**
+ * @brief Retrieve the (shared) serialization plan for the type of the given value from a global
+ * cache, compiling it first when it was not yet cached.
+ *
+ * @details The lookup only walks the structure of the value and does not construct its type,
+ * unless the plan needs to be compiled. Callers that serialize many values of the same type can
+ * also hold on to the returned plan and check it with SerializationPlan::Matches.
+ *
+ * @note This function is thread safe.
+ */
+std::shared_ptr<const SerializationPlan> GetSerializationPlan(const AnyValue& anyvalue);
+
+/**
+ * @brief Structural hash of an AnyType: equal types produce equal hashes.
+ */
+std::size_t AnyTypeHash(const AnyType& anytype);
+
+/**
+ * @brief Combine two hash values, e.g. the hashes of the source and destination types of a plan.
+ */
+std::size_t CombineHashes(std::size_t lhs, std::size_t rhs);
+
+/**
+ * @brief Hash of the shape of a type: its type codes, member names, numbers of array elements and
+ * string capacities, not taking into account type names or the element types of empty arrays.
+ *
+ * @details Types with the same shape produce equal hashes. The hash of a value is computed
+ * directly from the value, without constructing its type, and equals the hash of its type.
+ */
+std::size_t ShapeHash(const AnyType& anytype);
+std::size_t ShapeHash(const AnyValue& anyvalue);
+
+/**
+ * @brief Check if the given type or the type of the given value has the same shape as the other
+ * type (see ShapeHash), without constructing the type of the value.
+ */
+bool MatchesShape(const AnyType& anytype, const AnyType& other);
+bool MatchesShape(const AnyValue& anyvalue, const AnyType& other);
+
+/**
+ * @brief Trait that detects if a visitor provides the ScalarLeaf callback for plan execution.
+ */
+template <typename Visitor, typename T, typename = void>
+struct HasScalarLeafCallback : std::false_type
+{};
+
+template <typename Visitor, typename T>
+struct HasScalarLeafCallback<
+  Visitor, T,
+  std::void_t<decltype(std::declval<Visitor&>().ScalarLeaf(
+    std::declval<T*>(), std::declval<TypeCode>(), std::declval<std::size_t>()))>>
+  : std::true_type
+{};
+
+template <typename Visitor, typename T>
+void SerializationPlan::Execute(T& any, Visitor& visitor) const
+{
+  if (any.GetTypeCode() != m_anytype.GetTypeCode())
+  {
+    throw InvalidOperationException(
+      "SerializationPlan::Execute(): value does not correspond to the plan's type");
+  }
+  // Frames track the current node; array nodes use their frame's counters for the element loop:
+  VisitFrameStack<T> frame_stack;
+  frame_stack.Push({ &any, VisitFrameKind::kScalar, 0, 0 });
+  const auto n_instructions = m_instructions.size();
+  for (std::size_t pos = 0; pos < n_instructions; ++pos)
+  {
+    const auto& instruction = m_instructions[pos];
+    auto& top = frame_stack.Top();
+    switch (instruction.opcode)
+    {
+    case PlanOpcode::kEmpty:
+      visitor.EmptyProlog(top.node);
+      visitor.EmptyEpilog(top.node);
+      break;
+    case PlanOpcode::kStructBegin:
+      visitor.StructProlog(top.node);
+      break;
+    case PlanOpcode::kStructEnd:
+      visitor.StructEpilog(top.node);
+      break;
+    case PlanOpcode::kMemberBegin:
+    {
+      if (instruction.index > 0)
+      {
+        visitor.StructMemberSeparator();
+      }
+      auto member = GetIndexedChild(top.node, instruction.index);
+      visitor.MemberProlog(member, *instruction.member_name);
+      frame_stack.Push({ member, VisitFrameKind::kScalar, 0, 0 });
+      break;
+    }
+    case PlanOpcode::kMemberEnd:
+    {
+      auto member = top.node;
+      frame_stack.Pop();
+      visitor.MemberEpilog(member, *instruction.member_name);
+      break;
+    }
+    case PlanOpcode::kArrayBegin:
+      visitor.ArrayProlog(top.node);
+      top.kind = VisitFrameKind::kArray;
+      top.next_child = 0;
+      top.n_children = top.node->NumberOfElements();
+      if (top.n_children == 0)
+      {
+        visitor.ArrayEpilog(top.node);
+        pos = instruction.index;
+        break;
+      }
+      frame_stack.Push({ GetIndexedChild(top.node, 0), VisitFrameKind::kScalar, 0, 0 });
+      break;
+    case PlanOpcode::kArrayEnd:
+    {
+      frame_stack.Pop();
+      auto& array_frame = frame_stack.Top();
+      if (++array_frame.next_child < array_frame.n_children)
+      {
+        visitor.ArrayElementSeparator();
+        auto element = GetIndexedChild(array_frame.node, array_frame.next_child);
+        frame_stack.Push({ element, VisitFrameKind::kScalar, 0, 0 });
+        pos = instruction.index - 1;
+        break;
+      }
+      visitor.ArrayEpilog(array_frame.node);
+      break;
+    }
+    case PlanOpcode::kScalar:
+      if constexpr (HasScalarLeafCallback<Visitor, T>::value)
+      {
+        visitor.ScalarLeaf(top.node, instruction.type_code, instruction.width);
+      }
+      else
+      {
+        visitor.ScalarProlog(top.node);
+        visitor.ScalarEpilog(top.node);
+      }
+      break;
+    }
+  }
+}
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_SERIALIZATION_PLAN_H_
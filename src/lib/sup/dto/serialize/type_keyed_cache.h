@@ -0,0 +1,183 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_TYPE_KEYED_CACHE_H_
+#define SUP_DTO_TYPE_KEYED_CACHE_H_
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace sup
+{
+namespace dto
+{
+
+/**
+ * @brief Bounded, thread safe cache of objects that are compiled from one or more types, e.g.
+ * serialization plans, conversion plans or byte layouts.
+ *
+ * @details Entries are looked up by a structural hash of the types they were compiled from and a
+ * predicate that checks if a cached object can be used for the requested types. This allows
+ * callers to compute the hash and check for a match directly on values, without constructing their
+ * types. Objects are compiled outside of the lock; when two threads compile the same object
+ * concurrently, the first one that is inserted is kept and returned to both. When the cache is
+ * full, the least recently used entry is evicted.
+ */
+template <typename T>
+class TypeKeyedCache
+{
+public:
+  explicit TypeKeyedCache(std::size_t capacity);
+  ~TypeKeyedCache();
+
+  TypeKeyedCache(const TypeKeyedCache& other) = delete;
+  TypeKeyedCache(TypeKeyedCache&& other) = delete;
+  TypeKeyedCache& operator=(const TypeKeyedCache& other) = delete;
+  TypeKeyedCache& operator=(TypeKeyedCache&& other) = delete;
+
+  std::size_t Capacity() const;
+
+  std::size_t Size() const;
+
+  /**
+   * @brief Retrieve the cached object with the given hash that satisfies the predicate, compiling
+   * and inserting it first when there is no such object.
+   *
+   * @param hash Structural hash of the requested types.
+   * @param matches Predicate with signature bool(const T&) that checks if a cached object can be
+   * used for the requested types.
+   * @param compile Function with signature std::shared_ptr<const T>() that compiles the object for
+   * the requested types. It is called without holding the cache's lock.
+   */
+  template <typename Matches, typename Compile>
+  std::shared_ptr<const T> Get(std::size_t hash, const Matches& matches, const Compile& compile);
+
+private:
+  using Entry = std::pair<std::size_t, std::shared_ptr<const T>>;
+  using EntryList = std::list<Entry>;
+  template <typename Matches>
+  std::shared_ptr<const T> FindLocked(std::size_t hash, const Matches& matches);
+  void EvictLocked();
+  const std::size_t m_capacity;
+  mutable std::mutex m_mtx;
+  // Most recently used entries first; the index refers into this list
+  EntryList m_entries;
+  std::unordered_multimap<std::size_t, typename EntryList::iterator> m_index;
+};
+
+template <typename T>
+TypeKeyedCache<T>::TypeKeyedCache(std::size_t capacity)
+  : m_capacity{capacity > 0 ? capacity : 1}
+  , m_mtx{}
+  , m_entries{}
+  , m_index{}
+{}
+
+template <typename T>
+TypeKeyedCache<T>::~TypeKeyedCache() = default;
+
+template <typename T>
+std::size_t TypeKeyedCache<T>::Capacity() const
+{
+  return m_capacity;
+}
+
+template <typename T>
+std::size_t TypeKeyedCache<T>::Size() const
+{
+  const std::lock_guard<std::mutex> lk{m_mtx};
+  return m_entries.size();
+}
+
+template <typename T>
+template <typename Matches, typename Compile>
+std::shared_ptr<const T> TypeKeyedCache<T>::Get(std::size_t hash, const Matches& matches,
+                                                const Compile& compile)
+{
+  {
+    const std::lock_guard<std::mutex> lk{m_mtx};
+    auto cached = FindLocked(hash, matches);
+    if (cached)
+    {
+      return cached;
+    }
+  }
+  auto compiled = compile();
+  const std::lock_guard<std::mutex> lk{m_mtx};
+  auto cached = FindLocked(hash, matches);
+  if (cached)
+  {
+    return cached;
+  }
+  if (m_entries.size() >= m_capacity)
+  {
+    EvictLocked();
+  }
+  m_entries.emplace_front(hash, compiled);
+  (void)m_index.emplace(hash, m_entries.begin());
+  return compiled;
+}
+
+template <typename T>
+template <typename Matches>
+std::shared_ptr<const T> TypeKeyedCache<T>::FindLocked(std::size_t hash, const Matches& matches)
+{
+  const auto range = m_index.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    const auto entry_it = it->second;
+    if (matches(*entry_it->second))
+    {
+      // Moving the entry to the front does not invalidate the iterators in the index
+      m_entries.splice(m_entries.begin(), m_entries, entry_it);
+      return entry_it->second;
+    }
+  }
+  return nullptr;
+}
+
+template <typename T>
+void TypeKeyedCache<T>::EvictLocked()
+{
+  const auto last = std::prev(m_entries.end());
+  const auto range = m_index.equal_range(last->first);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    if (it->second == last)
+    {
+      (void)m_index.erase(it);
+      break;
+    }
+  }
+  (void)m_entries.erase(last);
+}
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_TYPE_KEYED_CACHE_H_
@@ -32,7 +32,7 @@ namespace dto
 {
 
 WriterTypeSerializer::WriterTypeSerializer(IWriter* writer)
-  : IAnyVisitor<const AnyType>{}
+  : StaticAnyVisitor<const AnyType>{}
   , m_writer{writer}
 {}
 WriterTypeSerializer::~WriterTypeSerializer() = default;
@@ -60,9 +60,6 @@ void WriterTypeSerializer::StructProlog(const AnyType* anytype)
   (void)m_writer->StartArray();
 }
 
-void WriterTypeSerializer::StructMemberSeparator()
-{}
-
 void WriterTypeSerializer::StructEpilog(const AnyType*)
 {
   (void)m_writer->EndArray();
@@ -94,9 +91,6 @@ void WriterTypeSerializer::ArrayProlog(const AnyType* anytype)
   (void)m_writer->Member(serialization::ELEMENT_KEY);
 }
 
-void WriterTypeSerializer::ArrayElementSeparator()
-{}
-
 void WriterTypeSerializer::ArrayEpilog(const AnyType*)
 {
   (void)m_writer->EndStructure();
@@ -108,6 +102,11 @@ void WriterTypeSerializer::ScalarProlog(const AnyType* anytype)
   (void)m_writer->Member(serialization::TYPE_KEY);
   const auto type_name = anytype->GetTypeName();
   (void)m_writer->String(type_name);
+  if (anytype->GetTypeCode() == TypeCode::FixedString)
+  {
+    (void)m_writer->Member(serialization::CAPACITY_KEY);
+    (void)m_writer->Uint64(anytype->StringCapacity());
+  }
 }
 
 void WriterTypeSerializer::ScalarEpilog(const AnyType*)
@@ -118,7 +117,7 @@ void WriterTypeSerializer::ScalarEpilog(const AnyType*)
 /**************************************/
 
 WriterValueSerializer::WriterValueSerializer(IWriter* writer)
-  : IAnyVisitor<const AnyValue>{}
+  : StaticAnyVisitor<const AnyValue>{}
   , m_writer{writer}
 {}
 WriterValueSerializer::~WriterValueSerializer() = default;
@@ -128,17 +127,11 @@ void WriterValueSerializer::EmptyProlog(const AnyValue*)
   (void)m_writer->Null();
 }
 
-void WriterValueSerializer::EmptyEpilog(const AnyValue*)
-{}
-
 void WriterValueSerializer::StructProlog(const AnyValue*)
 {
   (void)m_writer->StartStructure();
 }
 
-void WriterValueSerializer::StructMemberSeparator()
-{}
-
 void WriterValueSerializer::StructEpilog(const AnyValue*)
 {
   (void)m_writer->EndStructure();
@@ -149,17 +142,11 @@ void WriterValueSerializer::MemberProlog(const AnyValue*, const std::string& mem
   (void)m_writer->Member(member_name);
 }
 
-void WriterValueSerializer::MemberEpilog(const AnyValue*, const std::string&)
-{}
-
 void WriterValueSerializer::ArrayProlog(const AnyValue*)
 {
   (void)m_writer->StartArray();
 }
 
-void WriterValueSerializer::ArrayElementSeparator()
-{}
-
 void WriterValueSerializer::ArrayEpilog(const AnyValue*)
 {
   (void)m_writer->EndArray();
@@ -170,9 +157,6 @@ void WriterValueSerializer::ScalarProlog(const AnyValue* anyvalue)
   (void)WriteScalarValue(*anyvalue, m_writer);
 }
 
-void WriterValueSerializer::ScalarEpilog(const AnyValue*)
-{}
-
 }  // namespace dto
 
 }  // namespace sup
@@ -25,7 +25,7 @@
 
 #include <sup/dto/serialize/i_writer.h>
 
-#include <sup/dto/i_any_visitor.h>
+#include <sup/dto/visit/static_any_visitor.h>
 
 namespace sup
 {
@@ -38,33 +38,31 @@ class JSONRepresentation;
 /**
  * @brief Serialization for AnyType, using an IWriter service.
  */
-class WriterTypeSerializer : public IAnyVisitor<const AnyType>
+class WriterTypeSerializer : public StaticAnyVisitor<const AnyType>
 {
 public:
   explicit WriterTypeSerializer(IWriter* writer);
-  ~WriterTypeSerializer() override;
+  ~WriterTypeSerializer();
 
   WriterTypeSerializer(const WriterTypeSerializer& other) = delete;
   WriterTypeSerializer(WriterTypeSerializer&& other) = delete;
   WriterTypeSerializer& operator=(const WriterTypeSerializer& other) = delete;
   WriterTypeSerializer& operator=(WriterTypeSerializer&& other) = delete;
 
-  void EmptyProlog(const AnyType* anytype) override;
-  void EmptyEpilog(const AnyType*) override;
+  void EmptyProlog(const AnyType* anytype);
+  void EmptyEpilog(const AnyType*);
 
-  void StructProlog(const AnyType* anytype) override;
-  void StructMemberSeparator() override;
-  void StructEpilog(const AnyType*) override;
+  void StructProlog(const AnyType* anytype);
+  void StructEpilog(const AnyType*);
 
-  void MemberProlog(const AnyType*, const std::string& member_name) override;
-  void MemberEpilog(const AnyType*, const std::string&) override;
+  void MemberProlog(const AnyType*, const std::string& member_name);
+  void MemberEpilog(const AnyType*, const std::string&);
 
-  void ArrayProlog(const AnyType* anytype) override;
-  void ArrayElementSeparator() override;
-  void ArrayEpilog(const AnyType*) override;
+  void ArrayProlog(const AnyType* anytype);
+  void ArrayEpilog(const AnyType*);
 
-  void ScalarProlog(const AnyType* anytype) override;
-  void ScalarEpilog(const AnyType*) override;
+  void ScalarProlog(const AnyType* anytype);
+  void ScalarEpilog(const AnyType*);
 
 private:
   IWriter* m_writer;
@@ -74,33 +72,28 @@ private:
 /**
  * @brief Serialization for AnyValue, using an IWriter service.
  */
-class WriterValueSerializer : public IAnyVisitor<const AnyValue>
+class WriterValueSerializer : public StaticAnyVisitor<const AnyValue>
 {
 public:
   explicit WriterValueSerializer(IWriter* writer);
-  ~WriterValueSerializer() override;
+  ~WriterValueSerializer();
 
   WriterValueSerializer(const WriterValueSerializer& other) = delete;
   WriterValueSerializer(WriterValueSerializer&& other) = delete;
   WriterValueSerializer& operator=(const WriterValueSerializer& other) = delete;
   WriterValueSerializer& operator=(WriterValueSerializer&& other) = delete;
 
-  void EmptyProlog(const AnyValue*) override;
-  void EmptyEpilog(const AnyValue*) override;
+  void EmptyProlog(const AnyValue*);
 
-  void StructProlog(const AnyValue*) override;
-  void StructMemberSeparator() override;
-  void StructEpilog(const AnyValue*) override;
+  void StructProlog(const AnyValue*);
+  void StructEpilog(const AnyValue*);
 
-  void MemberProlog(const AnyValue*, const std::string& member_name) override;
-  void MemberEpilog(const AnyValue*, const std::string&) override;
+  void MemberProlog(const AnyValue*, const std::string& member_name);
 
-  void ArrayProlog(const AnyValue*) override;
-  void ArrayElementSeparator() override;
-  void ArrayEpilog(const AnyValue*) override;
+  void ArrayProlog(const AnyValue*);
+  void ArrayEpilog(const AnyValue*);
 
-  void ScalarProlog(const AnyValue* anyvalue) override;
-  void ScalarEpilog(const AnyValue*) override;
+  void ScalarProlog(const AnyValue* anyvalue);
 
 private:
   IWriter* m_writer;
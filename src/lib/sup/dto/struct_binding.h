@@ -0,0 +1,414 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_STRUCT_BINDING_H_
+#define SUP_DTO_STRUCT_BINDING_H_
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/fixed_string.h>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Bind the members of a C++ structure to an AnyType with the given type name.
+ *
+ * @details The macro needs to be used in the global namespace with the fully qualified name of the
+ * structure. The remaining arguments list the bound members in order, each of them wrapped in
+ * SUP_DTO_MEMBER:
+ *
+ * @code
+ * SUP_DTO_STRUCT_BINDING(app::Telemetry, "telemetry_t",
+ *                        SUP_DTO_MEMBER(id),
+ *                        SUP_DTO_MEMBER(position),
+ *                        SUP_DTO_MEMBER(label))
+ * @endcode
+ *
+ * Supported member types are the scalar types of sup::dto, char arrays (mapped to strings),
+ * FixedString (mapped to fixed-capacity strings), std::array and C arrays of supported types and
+ * other bound structures.
+ */
+#define SUP_DTO_STRUCT_BINDING(type, type_name, ...)                    \
+  namespace sup                                                         \
+  {                                                                     \
+  namespace dto                                                         \
+  {                                                                     \
+  template <>                                                           \
+  struct StructBinding<type>                                            \
+  {                                                                     \
+    using BoundType = type;                                             \
+    static constexpr const char* kTypeName = type_name;                 \
+    static constexpr auto kMembers = std::make_tuple(__VA_ARGS__);      \
+  };                                                                    \
+  }                                                                     \
+  }
+
+/**
+ * @brief Bind a single member inside SUP_DTO_STRUCT_BINDING. The member name is also used as the
+ * name of the AnyType member.
+ */
+#define SUP_DTO_MEMBER(member) ::sup::dto::BindMember(#member, &BoundType::member)
+
+namespace sup
+{
+namespace dto
+{
+/**
+ * @brief Binding of a C++ structure, specialized by SUP_DTO_STRUCT_BINDING.
+ */
+template <typename T>
+struct StructBinding;
+
+/**
+ * @brief Binding of a single member of a C++ structure.
+ */
+template <typename C, typename M>
+struct MemberBinding
+{
+  using member_type = M;
+  const char* name;
+  M C::*member;
+};
+
+template <typename C, typename M>
+constexpr MemberBinding<C, M> BindMember(const char* name, M C::*member)
+{
+  return { name, member };
+}
+
+/**
+ * @brief Direct access to the scalar leaves of AnyValues, used by the bindings.
+ *
+ * @details All functions throw InvalidConversionException when the leaf does not have the exact
+ * scalar type of the C++ value.
+ */
+class BoundLeafAccess
+{
+public:
+  static void Store(AnyValue& leaf, boolean val);
+  static void Store(AnyValue& leaf, char8 val);
+  static void Store(AnyValue& leaf, int8 val);
+  static void Store(AnyValue& leaf, uint8 val);
+  static void Store(AnyValue& leaf, int16 val);
+  static void Store(AnyValue& leaf, uint16 val);
+  static void Store(AnyValue& leaf, int32 val);
+  static void Store(AnyValue& leaf, uint32 val);
+  static void Store(AnyValue& leaf, int64 val);
+  static void Store(AnyValue& leaf, uint64 val);
+  static void Store(AnyValue& leaf, float32 val);
+  static void Store(AnyValue& leaf, float64 val);
+
+  /**
+   * @brief Store a zero-terminated string from a char array with the given capacity.
+   *
+   * @note Fixed-capacity string leaves are updated in place without allocating memory.
+   *
+   * @throws InvalidConversionException Thrown when the leaf is a fixed-capacity string that cannot
+   * hold the string.
+   */
+  static void StoreString(AnyValue& leaf, const char8* str, std::size_t capacity);
+
+  static void Load(const AnyValue& leaf, boolean& val);
+  static void Load(const AnyValue& leaf, char8& val);
+  static void Load(const AnyValue& leaf, int8& val);
+  static void Load(const AnyValue& leaf, uint8& val);
+  static void Load(const AnyValue& leaf, int16& val);
+  static void Load(const AnyValue& leaf, uint16& val);
+  static void Load(const AnyValue& leaf, int32& val);
+  static void Load(const AnyValue& leaf, uint32& val);
+  static void Load(const AnyValue& leaf, int64& val);
+  static void Load(const AnyValue& leaf, uint64& val);
+  static void Load(const AnyValue& leaf, float32& val);
+  static void Load(const AnyValue& leaf, float64& val);
+
+  /**
+   * @brief Load a string into a char array with the given capacity. The remaining characters are
+   * set to zero.
+   *
+   * @throws InvalidConversionException Also thrown when the string and its terminating zero do not
+   * fit in the array.
+   */
+  static void LoadString(const AnyValue& leaf, char8* str, std::size_t capacity);
+};
+
+inline const AnyType& BoundScalarType(boolean) { return BooleanType; }
+inline const AnyType& BoundScalarType(char8) { return Character8Type; }
+inline const AnyType& BoundScalarType(int8) { return SignedInteger8Type; }
+inline const AnyType& BoundScalarType(uint8) { return UnsignedInteger8Type; }
+inline const AnyType& BoundScalarType(int16) { return SignedInteger16Type; }
+inline const AnyType& BoundScalarType(uint16) { return UnsignedInteger16Type; }
+inline const AnyType& BoundScalarType(int32) { return SignedInteger32Type; }
+inline const AnyType& BoundScalarType(uint32) { return UnsignedInteger32Type; }
+inline const AnyType& BoundScalarType(int64) { return SignedInteger64Type; }
+inline const AnyType& BoundScalarType(uint64) { return UnsignedInteger64Type; }
+inline const AnyType& BoundScalarType(float32) { return Float32Type; }
+inline const AnyType& BoundScalarType(float64) { return Float64Type; }
+
+/**
+ * @brief Mapping of a C++ type to its AnyType and copy functions. The primary template handles
+ * structures bound with SUP_DTO_STRUCT_BINDING.
+ */
+template <typename T, typename Enable = void>
+struct BindingTraits
+{
+  static AnyType MakeType();
+  static void Store(AnyValue& anyvalue, const T& object);
+  static void Load(const AnyValue& anyvalue, T& object);
+};
+
+/**
+ * @brief Get the AnyType of a bound C++ type. The type is only built on first use.
+ */
+template <typename T>
+const AnyType& GetBoundType()
+{
+  static const AnyType anytype = BindingTraits<T>::MakeType();
+  return anytype;
+}
+
+/**
+ * @brief Copy all bound members of a C++ object into an AnyValue of its bound type.
+ *
+ * @param anyvalue AnyValue to assign to. Its structure needs to match the bound type, while type
+ * and member names are not checked.
+ * @param object C++ source object.
+ *
+ * @throws InvalidConversionException Thrown when the structure of the AnyValue doesn't match. The
+ * AnyValue can then be partially assigned.
+ */
+template <typename T>
+void AssignFromBoundStruct(AnyValue& anyvalue, const T& object)
+{
+  BindingTraits<T>::Store(anyvalue, object);
+}
+
+/**
+ * @brief Copy an AnyValue of the bound type into all bound members of a C++ object.
+ *
+ * @param object C++ object to assign to.
+ * @param anyvalue Source AnyValue. Its structure needs to match the bound type, while type and
+ * member names are not checked.
+ *
+ * @throws InvalidConversionException Thrown when the structure of the AnyValue doesn't match or a
+ * string doesn't fit in its char array. The object can then be partially assigned.
+ */
+template <typename T>
+void AssignToBoundStruct(T& object, const AnyValue& anyvalue)
+{
+  BindingTraits<T>::Load(anyvalue, object);
+}
+
+/**
+ * @brief Create an AnyValue of the bound type from a C++ object.
+ */
+template <typename T>
+AnyValue ToAnyValue(const T& object)
+{
+  AnyValue result{GetBoundType<T>()};
+  AssignFromBoundStruct(result, object);
+  return result;
+}
+
+/**
+ * @brief Create a C++ object from an AnyValue of its bound type. Unbound members are value
+ * initialized.
+ */
+template <typename T>
+T FromAnyValue(const AnyValue& anyvalue)
+{
+  T result{};
+  AssignToBoundStruct(result, anyvalue);
+  return result;
+}
+
+template <typename T>
+struct BindingTraits<T, std::enable_if_t<std::is_arithmetic_v<T>>>
+{
+  static AnyType MakeType() { return BoundScalarType(T{}); }
+  static void Store(AnyValue& anyvalue, const T& object)
+  {
+    BoundLeafAccess::Store(anyvalue, object);
+  }
+  static void Load(const AnyValue& anyvalue, T& object)
+  {
+    BoundLeafAccess::Load(anyvalue, object);
+  }
+};
+
+template <std::size_t N>
+struct BindingTraits<char8[N]>
+{
+  static AnyType MakeType() { return StringType; }
+  static void Store(AnyValue& anyvalue, const char8 (&object)[N])
+  {
+    BoundLeafAccess::StoreString(anyvalue, object, N);
+  }
+  static void Load(const AnyValue& anyvalue, char8 (&object)[N])
+  {
+    BoundLeafAccess::LoadString(anyvalue, object, N);
+  }
+};
+
+template <std::size_t N>
+struct BindingTraits<FixedString<N>>
+{
+  static AnyType MakeType() { return FixedStringType(N); }
+  static void Store(AnyValue& anyvalue, const FixedString<N>& object)
+  {
+    BoundLeafAccess::StoreString(anyvalue, object.GetData(), N);
+  }
+  static void Load(const AnyValue& anyvalue, FixedString<N>& object)
+  {
+    BoundLeafAccess::LoadString(anyvalue, object.GetData(), N);
+  }
+};
+
+template <typename E, std::size_t N>
+struct BindingTraits<E[N], std::enable_if_t<!std::is_same_v<E, char8>>>
+{
+  static AnyType MakeType() { return AnyType(N, GetBoundType<E>()); }
+  static void Store(AnyValue& anyvalue, const E (&object)[N])
+  {
+    CheckNumberOfElements(anyvalue, N);
+    for (std::size_t idx = 0; idx < N; ++idx)
+    {
+      BindingTraits<E>::Store(*anyvalue.GetChildValue(idx), object[idx]);
+    }
+  }
+  static void Load(const AnyValue& anyvalue, E (&object)[N])
+  {
+    CheckNumberOfElements(anyvalue, N);
+    for (std::size_t idx = 0; idx < N; ++idx)
+    {
+      BindingTraits<E>::Load(*anyvalue.GetChildValue(idx), object[idx]);
+    }
+  }
+  static void CheckNumberOfElements(const AnyValue& anyvalue, std::size_t n_elements)
+  {
+    if (anyvalue.GetTypeCode() != TypeCode::Array || anyvalue.NumberOfElements() != n_elements)
+    {
+      throw InvalidConversionException("Bound array doesn't match the structure of the AnyValue");
+    }
+  }
+};
+
+template <typename E, std::size_t N>
+struct BindingTraits<std::array<E, N>>
+{
+  static AnyType MakeType() { return BindingTraits<E[N]>::MakeType(); }
+  static void Store(AnyValue& anyvalue, const std::array<E, N>& object)
+  {
+    BindingTraits<E[N]>::CheckNumberOfElements(anyvalue, N);
+    for (std::size_t idx = 0; idx < N; ++idx)
+    {
+      BindingTraits<E>::Store(*anyvalue.GetChildValue(idx), object[idx]);
+    }
+  }
+  static void Load(const AnyValue& anyvalue, std::array<E, N>& object)
+  {
+    BindingTraits<E[N]>::CheckNumberOfElements(anyvalue, N);
+    for (std::size_t idx = 0; idx < N; ++idx)
+    {
+      BindingTraits<E>::Load(*anyvalue.GetChildValue(idx), object[idx]);
+    }
+  }
+};
+
+namespace binding_utils
+{
+template <typename Members, std::size_t... I>
+void AddBoundMembers(AnyType& anytype, const Members& members, std::index_sequence<I...>)
+{
+  ((void)anytype.AddMember(
+    std::get<I>(members).name,
+    GetBoundType<typename std::tuple_element_t<I, Members>::member_type>()), ...);
+}
+
+template <typename T, typename Members, std::size_t... I>
+void StoreBoundMembers(AnyValue& anyvalue, const T& object, const Members& members,
+                       std::index_sequence<I...>)
+{
+  (BindingTraits<typename std::tuple_element_t<I, Members>::member_type>::Store(
+    *anyvalue.GetChildValue(I), object.*(std::get<I>(members).member)), ...);
+}
+
+template <typename T, typename Members, std::size_t... I>
+void LoadBoundMembers(const AnyValue& anyvalue, T& object, const Members& members,
+                      std::index_sequence<I...>)
+{
+  (BindingTraits<typename std::tuple_element_t<I, Members>::member_type>::Load(
+    *anyvalue.GetChildValue(I), object.*(std::get<I>(members).member)), ...);
+}
+
+inline void CheckNumberOfMembers(const AnyValue& anyvalue, std::size_t n_members)
+{
+  if (anyvalue.GetTypeCode() != TypeCode::Struct || anyvalue.NumberOfMembers() != n_members)
+  {
+    throw InvalidConversionException(
+      "Bound structure doesn't match the structure of the AnyValue");
+  }
+}
+}  // namespace binding_utils
+
+template <typename T, typename Enable>
+AnyType BindingTraits<T, Enable>::MakeType()
+{
+  const auto& members = StructBinding<T>::kMembers;
+  using Members = std::decay_t<decltype(members)>;
+  auto result = EmptyStructType(StructBinding<T>::kTypeName);
+  binding_utils::AddBoundMembers(result, members,
+                                 std::make_index_sequence<std::tuple_size_v<Members>>{});
+  return result;
+}
+
+template <typename T, typename Enable>
+void BindingTraits<T, Enable>::Store(AnyValue& anyvalue, const T& object)
+{
+  const auto& members = StructBinding<T>::kMembers;
+  using Members = std::decay_t<decltype(members)>;
+  constexpr auto n_members = std::tuple_size_v<Members>;
+  binding_utils::CheckNumberOfMembers(anyvalue, n_members);
+  binding_utils::StoreBoundMembers(anyvalue, object, members,
+                                   std::make_index_sequence<n_members>{});
+}
+
+template <typename T, typename Enable>
+void BindingTraits<T, Enable>::Load(const AnyValue& anyvalue, T& object)
+{
+  const auto& members = StructBinding<T>::kMembers;
+  using Members = std::decay_t<decltype(members)>;
+  constexpr auto n_members = std::tuple_size_v<Members>;
+  binding_utils::CheckNumberOfMembers(anyvalue, n_members);
+  binding_utils::LoadBoundMembers(anyvalue, object, members,
+                                  std::make_index_sequence<n_members>{});
+}
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_STRUCT_BINDING_H_
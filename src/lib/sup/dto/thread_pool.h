@@ -0,0 +1,107 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_THREAD_POOL_H_
+#define SUP_DTO_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+
+/**
+ * @brief Fixed-size pool of worker threads, used by the parallel operations of the library.
+ *
+ * @details A single pool can be shared between different operations and threads. Parallel
+ * operations always let the calling thread take part in the work, so they can safely be nested
+ * (e.g. called from inside a task running on the same pool).
+ */
+class ThreadPool
+{
+public:
+  /**
+   * @brief Construct a pool with the given number of worker threads.
+   *
+   * @param n_threads Number of worker threads. Zero selects the number of hardware threads.
+   */
+  explicit ThreadPool(std::size_t n_threads);
+
+  /**
+   * @brief Destructor finishes all submitted tasks and joins the worker threads.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool(ThreadPool&& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+  ThreadPool& operator=(ThreadPool&& other) = delete;
+
+  /**
+   * @brief Get the number of worker threads.
+   *
+   * @return Number of worker threads.
+   */
+  std::size_t NumberOfThreads() const;
+
+  /**
+   * @brief Submit a task for asynchronous execution on one of the worker threads.
+   *
+   * @param task Task to execute.
+   *
+   * @note Exceptions escaping from the task are caught and discarded.
+   */
+  void Submit(std::function<void()> task);
+
+  /**
+   * @brief Execute task(0), ..., task(n_tasks - 1) on the worker threads and the calling thread,
+   * and wait for all of them to finish.
+   *
+   * @param n_tasks Number of tasks.
+   * @param task Task to execute for each index.
+   *
+   * @throws Rethrows the first exception thrown by any of the tasks. Tasks that were not started
+   * yet at that time are skipped.
+   */
+  void ParallelFor(std::size_t n_tasks, const std::function<void(std::size_t)>& task);
+
+private:
+  void WorkerLoop();
+  std::vector<std::thread> m_threads;
+  std::deque<std::function<void()>> m_tasks;
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  bool m_halt;
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_THREAD_POOL_H_
@@ -0,0 +1,75 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_STATIC_ANY_VISITOR_H_
+#define SUP_DTO_STATIC_ANY_VISITOR_H_
+
+#include <string>
+
+namespace sup
+{
+namespace dto
+{
+
+/**
+ * @brief Base class for visitors that are resolved at compile time by VisitStatic.
+ *
+ * @details This class provides the same callbacks as IAnyVisitor, but as non-virtual inline
+ * functions with an empty body. Derived visitors only declare the callbacks they need, hiding the
+ * empty ones, while the calls to the remaining callbacks are compiled away.
+ */
+template <typename T>
+class StaticAnyVisitor
+{
+public:
+  StaticAnyVisitor(const StaticAnyVisitor&) = delete;
+  StaticAnyVisitor& operator=(const StaticAnyVisitor&) = delete;
+  StaticAnyVisitor(StaticAnyVisitor&&) = delete;
+  StaticAnyVisitor& operator=(StaticAnyVisitor&&) = delete;
+
+  void EmptyProlog(T*) {}
+  void EmptyEpilog(T*) {}
+
+  void StructProlog(T*) {}
+  void StructMemberSeparator() {}
+  void StructEpilog(T*) {}
+
+  void MemberProlog(T*, const std::string&) {}
+  void MemberEpilog(T*, const std::string&) {}
+
+  void ArrayProlog(T*) {}
+  void ArrayElementSeparator() {}
+  void ArrayEpilog(T*) {}
+
+  void ScalarProlog(T*) {}
+  void ScalarEpilog(T*) {}
+
+protected:
+  StaticAnyVisitor() = default;
+  ~StaticAnyVisitor() = default;
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_STATIC_ANY_VISITOR_H_
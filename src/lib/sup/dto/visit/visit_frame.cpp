@@ -20,7 +20,7 @@
  * of the distribution package.
  ******************************************************************************/
 
-#include "any_visitornode.h"
+#include "visit_frame.h"
 
 #include <sup/dto/anytype.h>
 #include <sup/dto/anyvalue.h>
@@ -50,6 +50,16 @@ const AnyValue* GetIndexedChild(const AnyValue* parent, std::size_t idx)
   return parent->GetChildValue(idx);
 }
 
+const std::string& GetIndexedMemberName(const AnyType* parent, std::size_t idx)
+{
+  return parent->GetMemberName(idx);
+}
+
+const std::string& GetIndexedMemberName(const AnyValue* parent, std::size_t idx)
+{
+  return parent->GetMemberName(idx);
+}
+
 }  // namespace dto
 
 }  // namespace sup
@@ -0,0 +1,248 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Data transfer objects for SUP
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_VISIT_FRAME_H_
+#define SUP_DTO_VISIT_FRAME_H_
+
+#include <sup/dto/anytype.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace dto
+{
+class AnyValue;
+
+AnyType* GetIndexedChild(AnyType* parent, std::size_t idx);
+const AnyType* GetIndexedChild(const AnyType* parent, std::size_t idx);
+AnyValue* GetIndexedChild(AnyValue* parent, std::size_t idx);
+const AnyValue* GetIndexedChild(const AnyValue* parent, std::size_t idx);
+
+const std::string& GetIndexedMemberName(const AnyType* parent, std::size_t idx);
+const std::string& GetIndexedMemberName(const AnyValue* parent, std::size_t idx);
+
+/**
+ * @brief Kind of node in an AnyType/AnyValue tree, as far as visiting is concerned.
+ */
+enum class VisitFrameKind
+{
+  kEmpty,
+  kStruct,
+  kArray,
+  kScalar
+};
+
+/**
+ * @brief Plain state of a single node that is being visited in Depth First Search.
+ *
+ * @details Children are addressed by index, so that no state needs to be allocated per node.
+ */
+template <typename T>
+struct VisitFrame
+{
+  T* node;
+  VisitFrameKind kind;
+  std::size_t next_child;
+  std::size_t n_children;
+};
+
+/**
+ * @brief Function template for creating the visit frame of an AnyType/AnyValue node.
+ */
+template <typename T>
+VisitFrame<T> CreateVisitFrame(T* any);
+
+/**
+ * @brief Call the visitor method that opens the given frame.
+ */
+template <typename T, typename Visitor>
+void AddVisitProlog(const VisitFrame<T>& frame, Visitor& visitor);
+
+/**
+ * @brief Call the visitor method that separates the children of the given frame.
+ */
+template <typename T, typename Visitor>
+void AddVisitSeparator(const VisitFrame<T>& frame, Visitor& visitor);
+
+/**
+ * @brief Call the visitor method that closes the given frame.
+ */
+template <typename T, typename Visitor>
+void AddVisitEpilog(const VisitFrame<T>& frame, Visitor& visitor);
+
+/**
+ * @brief Templated stack of visit frames.
+ *
+ * @details The first kInlineDepth frames are stored inline, so that visiting trees of moderate
+ * depth does not require any heap allocation. Deeper trees spill over into a vector.
+ */
+template <typename T>
+class VisitFrameStack
+{
+public:
+  static const std::size_t kInlineDepth = 32;
+
+  VisitFrameStack();
+  ~VisitFrameStack() = default;
+
+  VisitFrameStack(const VisitFrameStack& other) = delete;
+  VisitFrameStack(VisitFrameStack&& other) = delete;
+  VisitFrameStack& operator=(const VisitFrameStack& other) = delete;
+  VisitFrameStack& operator=(VisitFrameStack&& other) = delete;
+
+  bool empty() const;
+  VisitFrame<T>& Top();
+  void Push(const VisitFrame<T>& frame);
+  void Pop();
+
+private:
+  std::array<VisitFrame<T>, kInlineDepth> m_inline_frames;
+  std::vector<VisitFrame<T>> m_overflow_frames;
+  std::size_t m_size;
+};
+
+template <typename T>
+VisitFrame<T> CreateVisitFrame(T* any)
+{
+  switch (any->GetTypeCode())
+  {
+  case TypeCode::Empty:
+    return { any, VisitFrameKind::kEmpty, 0, 0 };
+  case TypeCode::Struct:
+    return { any, VisitFrameKind::kStruct, 0, any->NumberOfChildren() };
+  case TypeCode::Array:
+    return { any, VisitFrameKind::kArray, 0, any->NumberOfChildren() };
+  default:
+    break;
+  }
+  return { any, VisitFrameKind::kScalar, 0, 0 };
+}
+
+template <typename T, typename Visitor>
+void AddVisitProlog(const VisitFrame<T>& frame, Visitor& visitor)
+{
+  switch (frame.kind)
+  {
+  case VisitFrameKind::kEmpty:
+    visitor.EmptyProlog(frame.node);
+    break;
+  case VisitFrameKind::kStruct:
+    visitor.StructProlog(frame.node);
+    break;
+  case VisitFrameKind::kArray:
+    visitor.ArrayProlog(frame.node);
+    break;
+  case VisitFrameKind::kScalar:
+    visitor.ScalarProlog(frame.node);
+    break;
+  }
+}
+
+template <typename T, typename Visitor>
+void AddVisitSeparator(const VisitFrame<T>& frame, Visitor& visitor)
+{
+  if (frame.kind == VisitFrameKind::kStruct)
+  {
+    visitor.StructMemberSeparator();
+  }
+  else if (frame.kind == VisitFrameKind::kArray)
+  {
+    visitor.ArrayElementSeparator();
+  }
+}
+
+template <typename T, typename Visitor>
+void AddVisitEpilog(const VisitFrame<T>& frame, Visitor& visitor)
+{
+  switch (frame.kind)
+  {
+  case VisitFrameKind::kEmpty:
+    visitor.EmptyEpilog(frame.node);
+    break;
+  case VisitFrameKind::kStruct:
+    visitor.StructEpilog(frame.node);
+    break;
+  case VisitFrameKind::kArray:
+    visitor.ArrayEpilog(frame.node);
+    break;
+  case VisitFrameKind::kScalar:
+    visitor.ScalarEpilog(frame.node);
+    break;
+  }
+}
+
+template <typename T>
+VisitFrameStack<T>::VisitFrameStack()
+  : m_inline_frames{}
+  , m_overflow_frames{}
+  , m_size{0}
+{}
+
+template <typename T>
+bool VisitFrameStack<T>::empty() const
+{
+  return m_size == 0;
+}
+
+template <typename T>
+VisitFrame<T>& VisitFrameStack<T>::Top()
+{
+  if (m_size > kInlineDepth)
+  {
+    return m_overflow_frames.back();
+  }
+  return m_inline_frames[m_size - 1];
+}
+
+template <typename T>
+void VisitFrameStack<T>::Push(const VisitFrame<T>& frame)
+{
+  if (m_size < kInlineDepth)
+  {
+    m_inline_frames[m_size] = frame;
+  }
+  else
+  {
+    m_overflow_frames.push_back(frame);
+  }
+  ++m_size;
+}
+
+template <typename T>
+void VisitFrameStack<T>::Pop()
+{
+  if (m_size > kInlineDepth)
+  {
+    m_overflow_frames.pop_back();
+  }
+  --m_size;
+}
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_VISIT_FRAME_H_
@@ -23,8 +23,7 @@
 #ifndef SUP_DTO_VISIT_T_H_
 #define SUP_DTO_VISIT_T_H_
 
-#include <sup/dto/visit/any_visitorstack.h>
-#include <sup/dto/visit/create_any_visitornode_t.h>
+#include <sup/dto/visit/visit_frame.h>
 
 #include <sup/dto/i_any_visitor.h>
 
@@ -34,34 +33,81 @@ namespace dto
 {
 
 /**
- * @brief The Visit function will visit each node of an AnyType/AnyValue and call the appropriate
- * visitor methods while passing the node's value.
+ * @brief The VisitStatic function will visit each node of an AnyType/AnyValue and call the
+ * appropriate methods of the visitor while passing the node's value.
+ *
+ * @details The visitor methods are resolved at compile time, so the visitor can be any class that
+ * provides the callbacks of IAnyVisitor, e.g. by deriving from StaticAnyVisitor. Callbacks with an
+ * empty inline body are then compiled away. The traversal keeps a stack of plain frames and
+ * addresses children and member names by index, so that no heap allocation is required per
+ * visited node.
  *
  * @note Although this function is designed to change the underlying AnyType/AnyValue, it's
  * implementation expects that the structure is not changed. This means that only changes in leaf
  * values are allowed, i.e. scalar values for AnyValue, and scalar types for AnyType.
 */
-template <typename T>
-void Visit(T& any, IAnyVisitor<T>& visitor)
+template <typename Visitor, typename T>
+void VisitStatic(T& any, Visitor& visitor)
 {
-  AnyVisitorStack<T> node_stack;
-  auto node = CreateRootNodeT<T>(&any);
-  node_stack.Push(std::move(node), visitor);
-  while (!node_stack.empty())
+  VisitFrameStack<T> frame_stack;
+  auto root_frame = CreateVisitFrame<T>(&any);
+  AddVisitProlog(root_frame, visitor);
+  frame_stack.Push(root_frame);
+  while (!frame_stack.empty())
   {
-    auto& top = node_stack.Top();
-    auto next_child = top.NextChild();
-    if (next_child.IsValid())
+    auto& top = frame_stack.Top();
+    if (top.next_child < top.n_children)
     {
-      node_stack.Push(std::move(next_child), visitor);
+      const auto idx = top.next_child++;
+      if (idx > 0)
+      {
+        AddVisitSeparator(top, visitor);
+      }
+      auto child_frame = CreateVisitFrame<T>(GetIndexedChild(top.node, idx));
+      if (top.kind == VisitFrameKind::kStruct)
+      {
+        visitor.MemberProlog(child_frame.node, GetIndexedMemberName(top.node, idx));
+      }
+      AddVisitProlog(child_frame, visitor);
+      if (child_frame.n_children > 0)
+      {
+        frame_stack.Push(child_frame);
+        continue;
+      }
+      // Leaf nodes are closed immediately, without passing through the stack
+      AddVisitEpilog(child_frame, visitor);
+      if (top.kind == VisitFrameKind::kStruct)
+      {
+        visitor.MemberEpilog(child_frame.node, GetIndexedMemberName(top.node, idx));
+      }
+      continue;
     }
-    else
+    const auto frame = top;
+    AddVisitEpilog(frame, visitor);
+    frame_stack.Pop();
+    if (!frame_stack.empty())
     {
-      node_stack.Pop(visitor);
+      const auto& parent = frame_stack.Top();
+      if (parent.kind == VisitFrameKind::kStruct)
+      {
+        visitor.MemberEpilog(frame.node, GetIndexedMemberName(parent.node, parent.next_child - 1));
+      }
     }
   }
 }
 
+/**
+ * @brief The Visit function will visit each node of an AnyType/AnyValue and call the appropriate
+ * visitor methods while passing the node's value.
+ *
+ * @note See VisitStatic for the restrictions on changing the AnyType/AnyValue during the visit.
+*/
+template <typename T>
+void Visit(T& any, IAnyVisitor<T>& visitor)
+{
+  VisitStatic<IAnyVisitor<T>>(any, visitor);
+}
+
 }  // namespace dto
 
 }  // namespace sup
@@ -20,20 +20,12 @@
  * of the distribution package.
  ******************************************************************************/
 
-#include "anyvalue_convert_node.h"
+#ifndef SUP_DTO_VISIT_STATIC_H_
+#define SUP_DTO_VISIT_STATIC_H_
 
-namespace sup
-{
-namespace dto
-{
+// Visiting AnyType/AnyValue trees with visitors that are resolved at compile time: provides the
+// VisitStatic function template and the StaticAnyVisitor base class.
+#include <sup/dto/visit/static_any_visitor.h>
+#include <sup/dto/visit/visit_t.h>
 
-AnyValueConvertNode::AnyValueConvertNode(AnyValue* left, const AnyValue* right)
-  : m_left{left}
-  , m_right{right}
-  , m_n_children{m_left->NumberOfChildren()}
-  , m_index{0}
-{}
-
-}  // namespace dto
-
-}  // namespace sup
+#endif  // SUP_DTO_VISIT_STATIC_H_
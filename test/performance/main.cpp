@@ -48,6 +48,13 @@ int main()
 
   std::cout << std::endl;
 
+  // Measure AnyValue hashing
+  std::cout << "Test AnyValue hash performance" << std::endl;
+  std::cout << "******************************" << std::endl;
+  performance::RunTestFunction(performance::MeasureHashAnyValue);
+
+  std::cout << std::endl;
+
   // Measure JSON performance:
   std::cout << "Test JSON serialize/parse performance" << std::endl;
   std::cout << "*************************************" << std::endl;
@@ -55,8 +62,32 @@ int main()
 
   std::cout << std::endl;
 
+  // Measure typed JSON performance:
+  std::cout << "Test typed JSON serialize/parse performance" << std::endl;
+  std::cout << "*******************************************" << std::endl;
+  performance::RunTestFunction(
+    performance::MeasureEncoderWithValue<performance::TypedJSONEncoder>);
+
+  std::cout << std::endl;
+
+  // Measure typed JSON performance with parallel parsing:
+  std::cout << "Test typed JSON serialize/parallel parse performance" << std::endl;
+  std::cout << "****************************************************" << std::endl;
+  performance::RunTestFunction(
+    performance::MeasureEncoderWithValue<performance::ParallelTypedJSONEncoder>);
+
+  std::cout << std::endl;
+
   // Measure binary performance:
   std::cout << "Test binary serialize/parse performance" << std::endl;
   std::cout << "***************************************" << std::endl;
   performance::RunTestFunction(performance::MeasureEncoderWithValue<performance::BinaryEncoder>);
+
+  std::cout << std::endl;
+
+  // Measure contention of the functor decorators:
+  std::cout << "Test concurrent AnyFunctor decorator throughput" << std::endl;
+  std::cout << "***********************************************" << std::endl;
+  performance::MeasureFunctorDecorators(performance::CreateScalarMix_Type());
+  performance::MeasureFunctorDecorators(performance::CreateScalarMixArray_Type());
 }
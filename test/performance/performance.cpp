@@ -22,13 +22,16 @@
 
 #include "performance.h"
 
+#include <sup/dto/any_functor.h>
 #include <sup/dto/anytype.h>
 #include <sup/dto/anyvalue.h>
 #include <sup/dto/anyvalue_helper.h>
+#include <sup/dto/anyvalue_operations.h>
 #include <sup/dto/json_value_parser.h>
 
 #include <ctime>
 #include <iomanip>
+#include <thread>
 
 namespace sup
 {
@@ -36,6 +39,38 @@ namespace dto
 {
 namespace performance
 {
+namespace
+{
+/**
+ * @brief Functor that is not thread safe and returns a checked copy of the request's payload.
+ */
+class CopyFunctor : public AnyFunctor
+{
+public:
+  CopyFunctor() = default;
+  ~CopyFunctor() override = default;
+
+  AnyValue operator()(const AnyValue& input) override
+  {
+    AnyValue result{input["payload"]};
+    if (result != input["payload"])
+    {
+      throw std::runtime_error("Copy is not equal to original");
+    }
+    ++m_n_calls;
+    return result;
+  }
+
+private:
+  std::size_t m_n_calls = 0;
+};
+
+std::chrono::nanoseconds MeasureConcurrentCalls(AnyFunctor& functor, const AnyValue& payload,
+                                                unsigned n_threads, unsigned n_calls);
+
+void PrintFunctorResults(const std::string& name, unsigned n_threads, unsigned n_calls,
+                         std::chrono::nanoseconds duration);
+}  // unnamed namespace
 
 void RunTestFunction(TestFunction func)
 {
@@ -150,6 +185,55 @@ std::size_t JSONEncoder::Size() const
   return m_representation.size();
 }
 
+TypedJSONEncoder::TypedJSONEncoder(const AnyValue& value)
+  : m_value{value}
+  , m_type{value.GetType()}
+  , m_representation{}
+{}
+
+TypedJSONEncoder::~TypedJSONEncoder() = default;
+
+void TypedJSONEncoder::Encode()
+{
+  m_representation = ValuesToJSONString(m_value);
+}
+
+void TypedJSONEncoder::Decode()
+{
+  JSONAnyValueParser parser;
+  parser.TypedParseString(m_type, m_representation);
+}
+
+std::size_t TypedJSONEncoder::Size() const
+{
+  return m_representation.size();
+}
+
+ParallelTypedJSONEncoder::ParallelTypedJSONEncoder(const AnyValue& value)
+  : m_value{value}
+  , m_type{value.GetType()}
+  , m_representation{}
+  , m_pool{0}
+{}
+
+ParallelTypedJSONEncoder::~ParallelTypedJSONEncoder() = default;
+
+void ParallelTypedJSONEncoder::Encode()
+{
+  m_representation = ValuesToJSONString(m_value);
+}
+
+void ParallelTypedJSONEncoder::Decode()
+{
+  JSONAnyValueParser parser;
+  parser.TypedParseString(m_type, m_representation, m_pool);
+}
+
+std::size_t ParallelTypedJSONEncoder::Size() const
+{
+  return m_representation.size();
+}
+
 BinaryEncoder::BinaryEncoder(const AnyValue& value)
   : m_value{value}
   , m_representation{}
@@ -253,6 +337,118 @@ void MeasureCopyAnyValue(const AnyType& anytype)
   std::cout << std::endl;
 }
 
+void MeasureHashAnyValue(const AnyType& anytype)
+{
+  AnyValue anyvalue{anytype};
+  const AnyValue copy{anyvalue};
+  auto start = std::chrono::system_clock::now();
+  auto hash = Hash(anyvalue);
+  auto one_cycle = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now() - start).count();
+  if (one_cycle < 1)
+  {
+    one_cycle = 1;
+  }
+  unsigned N = std::min(100000u, static_cast<unsigned>(5000000000 / one_cycle));  // max 5s
+  N = std::max(N, 3u);  // at least 3 iterations
+  std::chrono::nanoseconds hash_duration{0};
+  std::chrono::nanoseconds equality_duration{0};
+  for (unsigned i=0; i<N; ++i)
+  {
+    auto start = std::chrono::system_clock::now();
+    if (Hash(anyvalue) != hash)
+    {
+      throw std::runtime_error("Hash is not deterministic");
+    }
+    auto middle = std::chrono::system_clock::now();
+    if (copy != anyvalue)
+    {
+      throw std::runtime_error("Copy is not equal to original");
+    }
+    hash_duration += middle - start;
+    equality_duration += std::chrono::system_clock::now() - middle;
+  }
+  auto hash_duration_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(hash_duration).count();
+  auto equality_duration_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(equality_duration).count();
+  std::cout << "Results for " << N << " iterations:" << std::endl;
+  std::cout << "  Total hash time (us)           : " << hash_duration_us << std::endl;
+  std::cout << "  Total equality check time (us) : " << equality_duration_us << std::endl;
+  auto mean_hash_us = (double)hash_duration_us / N;
+  auto mean_equality_us = (double)equality_duration_us / N;
+  std::cout << "  Mean hash time (us)           : " << mean_hash_us << std::endl;
+  std::cout << "  Mean equality check time (us) : " << mean_equality_us << std::endl;
+  std::cout << std::endl;
+}
+
+void MeasureFunctorDecorators(const AnyType& anytype)
+{
+  const AnyValue payload{anytype};
+  const unsigned n_threads = std::max(2u, std::thread::hardware_concurrency());
+  CopyFunctor single_functor;
+  ThreadsafeAnyFunctorDecorator threadsafe{single_functor};
+  auto factory = []() { return std::unique_ptr<AnyFunctor>(new CopyFunctor{}); };
+  PooledAnyFunctorDecorator pooled{factory, n_threads};
+  ShardedAnyFunctorDecorator sharded{factory, n_threads, "client"};
+
+  auto one_cycle = MeasureConcurrentCalls(threadsafe, payload, 1, 1).count();
+  if (one_cycle < 1)
+  {
+    one_cycle = 1;
+  }
+  unsigned N = std::min(100000u, static_cast<unsigned>(1000000000 / one_cycle));  // max ~1s
+  N = std::max(N, 3u);  // at least 3 iterations
+  std::cout << "Results for " << n_threads << " threads with " << N << " calls each:"
+            << std::endl;
+  PrintFunctorResults("Threadsafe", n_threads, N,
+                      MeasureConcurrentCalls(threadsafe, payload, n_threads, N));
+  PrintFunctorResults("Pooled", n_threads, N,
+                      MeasureConcurrentCalls(pooled, payload, n_threads, N));
+  PrintFunctorResults("Sharded", n_threads, N,
+                      MeasureConcurrentCalls(sharded, payload, n_threads, N));
+  std::cout << std::endl;
+}
+
+namespace
+{
+std::chrono::nanoseconds MeasureConcurrentCalls(AnyFunctor& functor, const AnyValue& payload,
+                                                unsigned n_threads, unsigned n_calls)
+{
+  std::vector<std::thread> threads;
+  auto start = std::chrono::system_clock::now();
+  for (unsigned thread_idx = 0; thread_idx < n_threads; ++thread_idx)
+  {
+    threads.emplace_back([&functor, &payload, thread_idx, n_calls]() {
+      const AnyValue request{{
+        {"client", thread_idx},
+        {"payload", payload}
+      }};
+      for (unsigned idx = 0; idx < n_calls; ++idx)
+      {
+        (void)functor(request);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  return std::chrono::system_clock::now() - start;
+}
+
+void PrintFunctorResults(const std::string& name, unsigned n_threads, unsigned n_calls,
+                         std::chrono::nanoseconds duration)
+{
+  auto duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+  auto calls_per_s = (1e9 * n_threads * n_calls) / static_cast<double>(duration.count());
+  std::cout << "  " << std::left << std::setw(10) << name << " total time (ms) : " << duration_ms
+            << std::endl;
+  std::cout << "  " << std::left << std::setw(10) << name << " calls/s         : " << calls_per_s
+            << std::endl;
+}
+}  // unnamed namespace
+
 }  // namespace performance
 
 }  // namespace dto
@@ -25,6 +25,7 @@
 
 #include <sup/dto/anyvalue.h>
 #include <sup/dto/basic_scalar_types.h>
+#include <sup/dto/thread_pool.h>
 
 #include <chrono>
 #include <iostream>
@@ -62,6 +63,39 @@ private:
   std::string m_representation;
 };
 
+class TypedJSONEncoder
+{
+public:
+  TypedJSONEncoder(const AnyValue& value);
+  ~TypedJSONEncoder();
+
+  void Encode();
+  void Decode();
+  std::size_t Size() const;
+
+private:
+  const AnyValue& m_value;
+  AnyType m_type;
+  std::string m_representation;
+};
+
+class ParallelTypedJSONEncoder
+{
+public:
+  ParallelTypedJSONEncoder(const AnyValue& value);
+  ~ParallelTypedJSONEncoder();
+
+  void Encode();
+  void Decode();
+  std::size_t Size() const;
+
+private:
+  const AnyValue& m_value;
+  AnyType m_type;
+  std::string m_representation;
+  ThreadPool m_pool;
+};
+
 class BinaryEncoder
 {
 public:
@@ -128,6 +162,18 @@ void MeasureCopyAnyType(const AnyType& anytype);
 
 void MeasureCopyAnyValue(const AnyType& anytype);
 
+/**
+ * @brief Measure the structural hash of a value of the given type, compared to an equality check
+ * with a copy, which reads the leaves of both values once.
+ */
+void MeasureHashAnyValue(const AnyType& anytype);
+
+/**
+ * @brief Measure the throughput of concurrent calls to a functor through the different
+ * concurrency decorators. The functor copies a value of the given type.
+ */
+void MeasureFunctorDecorators(const AnyType& anytype);
+
 }  // namespace performance
 
 }  // namespace dto
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include "allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Count all heap allocations made through the global allocation functions:
+namespace
+{
+std::atomic<std::size_t> g_allocation_count{0};
+}
+
+void* operator new(std::size_t size)
+{
+  ++g_allocation_count;
+  if (void* ptr = std::malloc(size == 0 ? 1u : size))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace sup
+{
+namespace dto
+{
+
+std::size_t TotalAllocationCount()
+{
+  return g_allocation_count.load();
+}
+
+AllocationCounter::AllocationCounter()
+  : m_start{TotalAllocationCount()}
+{}
+
+AllocationCounter::~AllocationCounter() = default;
+
+std::size_t AllocationCounter::GetCount() const
+{
+  return TotalAllocationCount() - m_start;
+}
+
+void AllocationCounter::Reset()
+{
+  m_start = TotalAllocationCount();
+}
+
+}  // namespace dto
+
+}  // namespace sup
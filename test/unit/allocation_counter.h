@@ -0,0 +1,66 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#ifndef SUP_DTO_ALLOCATION_COUNTER_H_
+#define SUP_DTO_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+namespace sup
+{
+namespace dto
+{
+/**
+ * @brief Total number of heap allocations made through the global allocation functions of the
+ * unit test executable.
+ */
+std::size_t TotalAllocationCount();
+
+/**
+ * @brief Count the heap allocations made since construction.
+ *
+ * @note Allocations by other threads are counted as well.
+ */
+class AllocationCounter
+{
+public:
+  AllocationCounter();
+  ~AllocationCounter();
+
+  AllocationCounter(const AllocationCounter& other) = delete;
+  AllocationCounter(AllocationCounter&& other) = delete;
+  AllocationCounter& operator=(const AllocationCounter& other) = delete;
+  AllocationCounter& operator=(AllocationCounter&& other) = delete;
+
+  std::size_t GetCount() const;
+
+  void Reset();
+
+private:
+  std::size_t m_start;
+};
+
+}  // namespace dto
+
+}  // namespace sup
+
+#endif  // SUP_DTO_ALLOCATION_COUNTER_H_
@@ -0,0 +1,382 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/any_functor.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <atomic>
+#include <map>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace sup::dto;
+
+namespace
+{
+/**
+ * @brief Functor that is not thread safe: it records when it is entered concurrently.
+ */
+class TestFunctor : public AnyFunctor
+{
+public:
+  TestFunctor(uint32 id, std::atomic<int>& overlaps);
+  ~TestFunctor() override;
+
+  AnyValue operator()(const AnyValue& input) override;
+
+private:
+  uint32 m_id;
+  std::atomic<int>& m_overlaps;
+  std::atomic<bool> m_busy;
+  std::map<std::string, uint32> m_calls_per_key;
+};
+
+class AnyFunctorTest : public ::testing::Test
+{
+protected:
+  AnyFunctorTest();
+  ~AnyFunctorTest() override;
+
+  AnyFunctorFactory GetFactory();
+
+  // Call the functor concurrently and return all outputs
+  std::vector<AnyValue> CallConcurrently(AnyFunctor& functor, std::size_t n_threads,
+                                         std::size_t n_calls);
+
+  std::atomic<int> m_overlaps;
+  uint32 m_n_created;
+};
+
+AnyValue Request(const std::string& key, uint32 value);
+}  // unnamed namespace
+
+TEST_F(AnyFunctorTest, ThreadsafeDecorator)
+{
+  TestFunctor functor{0, m_overlaps};
+  ThreadsafeAnyFunctorDecorator decorator{functor};
+  const auto outputs = CallConcurrently(decorator, 4, 200);
+  EXPECT_EQ(m_overlaps, 0);
+  ASSERT_EQ(outputs.size(), 800);
+  for (const auto& output : outputs)
+  {
+    EXPECT_EQ(output["instance"].As<uint32>(), 0);
+  }
+}
+
+TEST_F(AnyFunctorTest, MemoizingHitsAndMisses)
+{
+  TestFunctor functor{0, m_overlaps};
+  EXPECT_THROW(MemoizingAnyFunctorDecorator(functor, 0), InvalidOperationException);
+  MemoizingAnyFunctorDecorator decorator{functor, 10};
+  EXPECT_EQ(decorator.Capacity(), 10);
+  EXPECT_EQ(decorator.NumberOfEntries(), 0);
+  const auto first = decorator(Request("key", 1));
+  EXPECT_EQ(first["result"].As<uint32>(), 2);
+  EXPECT_EQ(first["calls"].As<uint32>(), 1);
+  EXPECT_EQ(decorator.NumberOfHits(), 0);
+  EXPECT_EQ(decorator.NumberOfMisses(), 1);
+
+  // Same input: the cached output is returned without calling the functor
+  EXPECT_EQ(decorator(Request("key", 1)), first);
+  EXPECT_EQ(decorator.NumberOfHits(), 1);
+  EXPECT_EQ(decorator.NumberOfMisses(), 1);
+
+  // Input that compares equal, but has different leaf types
+  AnyValue equal_input{{
+    {"key", "key"},
+    {"value", {UnsignedInteger64Type, 1}}
+  }};
+  EXPECT_EQ(decorator(equal_input), first);
+  EXPECT_EQ(decorator.NumberOfHits(), 2);
+
+  // Different input
+  const auto second = decorator(Request("key", 2));
+  EXPECT_EQ(second["result"].As<uint32>(), 4);
+  EXPECT_EQ(second["calls"].As<uint32>(), 2);
+  EXPECT_EQ(decorator.NumberOfMisses(), 2);
+  EXPECT_EQ(decorator.NumberOfEntries(), 2);
+
+  // Failing calls are not cached
+  AnyValue failing_request = Request("key", 3);
+  failing_request.AddMember("fail", true);
+  EXPECT_THROW(decorator(failing_request), InvalidOperationException);
+  EXPECT_THROW(decorator(failing_request), InvalidOperationException);
+  EXPECT_EQ(decorator.NumberOfMisses(), 4);
+  EXPECT_EQ(decorator.NumberOfEntries(), 2);
+
+  // Clear
+  decorator.Clear();
+  EXPECT_EQ(decorator.NumberOfEntries(), 0);
+  EXPECT_EQ(decorator(Request("key", 1))["calls"].As<uint32>(), 5);
+  EXPECT_EQ(decorator.NumberOfHits(), 2);
+}
+
+TEST_F(AnyFunctorTest, MemoizingEviction)
+{
+  TestFunctor functor{0, m_overlaps};
+  MemoizingAnyFunctorDecorator decorator{functor, 2};
+  (void)decorator(Request("a", 1));
+  (void)decorator(Request("b", 1));
+  (void)decorator(Request("a", 1));
+  EXPECT_EQ(decorator.NumberOfHits(), 1);
+
+  // The cache is full: the entry that was not hit recently is evicted
+  (void)decorator(Request("c", 1));
+  EXPECT_EQ(decorator.NumberOfEntries(), 2);
+  EXPECT_EQ(decorator.NumberOfMisses(), 3);
+  EXPECT_EQ(decorator(Request("a", 1))["calls"].As<uint32>(), 1);
+  EXPECT_EQ(decorator(Request("c", 1))["calls"].As<uint32>(), 1);
+  EXPECT_EQ(decorator.NumberOfHits(), 3);
+  EXPECT_EQ(decorator(Request("b", 1))["calls"].As<uint32>(), 2);
+  EXPECT_EQ(decorator.NumberOfMisses(), 4);
+  EXPECT_EQ(decorator.NumberOfEntries(), 2);
+}
+
+TEST_F(AnyFunctorTest, MemoizingConcurrentCalls)
+{
+  TestFunctor functor{0, m_overlaps};
+  ThreadsafeAnyFunctorDecorator threadsafe_functor{functor};
+  MemoizingAnyFunctorDecorator decorator{threadsafe_functor, 1000};
+  const auto first_outputs = CallConcurrently(decorator, 4, 200);
+  EXPECT_EQ(decorator.NumberOfMisses(), 800);
+  EXPECT_EQ(decorator.NumberOfEntries(), 800);
+  const auto second_outputs = CallConcurrently(decorator, 4, 200);
+  EXPECT_EQ(decorator.NumberOfHits(), 800);
+  EXPECT_EQ(decorator.NumberOfMisses(), 800);
+  EXPECT_EQ(m_overlaps, 0);
+  EXPECT_EQ(second_outputs, first_outputs);
+}
+
+TEST_F(AnyFunctorTest, PooledConstruction)
+{
+  EXPECT_THROW(PooledAnyFunctorDecorator(GetFactory(), 0), InvalidOperationException);
+  EXPECT_THROW(PooledAnyFunctorDecorator([](){ return std::unique_ptr<AnyFunctor>{}; }, 2),
+               InvalidOperationException);
+  m_n_created = 0;
+  PooledAnyFunctorDecorator decorator{GetFactory(), 3};
+  EXPECT_EQ(decorator.NumberOfInstances(), 3);
+  EXPECT_EQ(m_n_created, 3);
+  EXPECT_EQ(decorator(Request("key", 21))["result"].As<uint32>(), 42);
+}
+
+TEST_F(AnyFunctorTest, PooledConcurrentCalls)
+{
+  PooledAnyFunctorDecorator decorator{GetFactory(), 3};
+  const auto outputs = CallConcurrently(decorator, 8, 200);
+  EXPECT_EQ(m_overlaps, 0);
+  ASSERT_EQ(outputs.size(), 1600);
+  std::set<uint32> instances;
+  for (const auto& output : outputs)
+  {
+    instances.insert(output["instance"].As<uint32>());
+  }
+  EXPECT_LE(instances.size(), 3);
+}
+
+TEST_F(AnyFunctorTest, PooledExceptions)
+{
+  PooledAnyFunctorDecorator decorator{GetFactory(), 1};
+  AnyValue failing_request = Request("key", 1);
+  failing_request.AddMember("fail", true);
+  EXPECT_THROW(decorator(failing_request), InvalidOperationException);
+  // The instance was returned to the pool
+  EXPECT_EQ(decorator(Request("key", 2))["result"].As<uint32>(), 4);
+}
+
+TEST_F(AnyFunctorTest, ShardedRouting)
+{
+  EXPECT_THROW(ShardedAnyFunctorDecorator(GetFactory(), 0, "key"), InvalidOperationException);
+  ShardedAnyFunctorDecorator decorator{GetFactory(), 4, "key"};
+  EXPECT_EQ(decorator.NumberOfShards(), 4);
+  std::set<std::size_t> shards;
+  for (uint32 idx = 0; idx < 32; ++idx)
+  {
+    const auto key = "key" + std::to_string(idx);
+    const auto shard = decorator.GetShardIndex(Request(key, 0));
+    EXPECT_LT(shard, 4);
+    EXPECT_EQ(decorator.GetShardIndex(Request(key, idx)), shard);
+    (void)shards.insert(shard);
+  }
+  EXPECT_GT(shards.size(), 1);
+  // Inputs without key field go to the first shard
+  EXPECT_EQ(decorator.GetShardIndex(AnyValue{42}), 0);
+  EXPECT_EQ(decorator.GetShardIndex(AnyValue{{{"other", 1}}}), 0);
+
+  // Nested key fields
+  ShardedAnyFunctorDecorator nested_decorator{GetFactory(), 4, "header.key"};
+  AnyValue request{{{"header", Request("key5", 0)}}};
+  EXPECT_EQ(nested_decorator.GetShardIndex(request), decorator.GetShardIndex(Request("key5", 1)));
+
+  // Keys that compare equal are routed to the same shard, independent of their type
+  ShardedAnyFunctorDecorator numeric_decorator{GetFactory(), 4, "id"};
+  for (uint32 idx = 0; idx < 32; ++idx)
+  {
+    AnyValue request_u32{{{"id", idx}}};
+    AnyValue request_f64{{{"id", static_cast<float64>(idx)}}};
+    EXPECT_EQ(numeric_decorator.GetShardIndex(request_u32),
+              numeric_decorator.GetShardIndex(request_f64));
+  }
+}
+
+TEST_F(AnyFunctorTest, ShardedConcurrentCalls)
+{
+  ShardedAnyFunctorDecorator decorator{GetFactory(), 3, "key"};
+  const auto outputs = CallConcurrently(decorator, 8, 200);
+  EXPECT_EQ(m_overlaps, 0);
+  ASSERT_EQ(outputs.size(), 1600);
+  // All calls with the same key were handled by the same instance, which saw all of them
+  std::map<std::string, uint32> instance_per_key;
+  std::map<std::string, uint32> max_calls_per_key;
+  for (const auto& output : outputs)
+  {
+    const auto key = output["key"].As<std::string>();
+    const auto instance = output["instance"].As<uint32>();
+    auto it = instance_per_key.emplace(key, instance).first;
+    EXPECT_EQ(it->second, instance);
+    auto& max_calls = max_calls_per_key[key];
+    max_calls = std::max(max_calls, output["calls"].As<uint32>());
+  }
+  for (const auto& entry : max_calls_per_key)
+  {
+    EXPECT_EQ(entry.second, 200);
+  }
+}
+
+TEST_F(AnyFunctorTest, BatchAdapter)
+{
+  TestFunctor functor{0, m_overlaps};
+  AnyFunctorBatchAdapter adapter{functor};
+  std::vector<AnyValue> inputs;
+  for (uint32 idx = 0; idx < 10; ++idx)
+  {
+    inputs.push_back(Request("key", idx));
+  }
+  std::vector<AnyValue> outputs(inputs.size());
+  adapter(inputs.data(), outputs.data(), inputs.size());
+  for (uint32 idx = 0; idx < 10; ++idx)
+  {
+    EXPECT_EQ(outputs[idx]["result"].As<uint32>(), 2 * idx);
+    EXPECT_EQ(outputs[idx]["calls"].As<uint32>(), idx + 1);
+  }
+
+  // Outputs preceding a failing input are assigned
+  inputs[5].AddMember("fail", true);
+  std::vector<AnyValue> partial_outputs(inputs.size());
+  EXPECT_THROW(adapter(inputs.data(), partial_outputs.data(), inputs.size()),
+               InvalidOperationException);
+  EXPECT_FALSE(IsEmptyValue(partial_outputs[4]));
+  EXPECT_TRUE(IsEmptyValue(partial_outputs[5]));
+
+  // Empty batch
+  EXPECT_NO_THROW(adapter(nullptr, nullptr, 0));
+}
+
+namespace
+{
+TestFunctor::TestFunctor(uint32 id, std::atomic<int>& overlaps)
+  : AnyFunctor{}
+  , m_id{id}
+  , m_overlaps{overlaps}
+  , m_busy{false}
+  , m_calls_per_key{}
+{}
+
+TestFunctor::~TestFunctor() = default;
+
+AnyValue TestFunctor::operator()(const AnyValue& input)
+{
+  if (m_busy.exchange(true))
+  {
+    ++m_overlaps;
+  }
+  const auto key = input["key"].As<std::string>();
+  const auto calls = ++m_calls_per_key[key];
+  std::this_thread::yield();
+  m_busy = false;
+  if (input.HasField("fail"))
+  {
+    throw InvalidOperationException("TestFunctor failed");
+  }
+  return AnyValue{{
+    {"key", key},
+    {"instance", m_id},
+    {"calls", calls},
+    {"result", 2 * input["value"].As<uint32>()}
+  }};
+}
+
+AnyFunctorTest::AnyFunctorTest()
+  : m_overlaps{0}
+  , m_n_created{0}
+{}
+
+AnyFunctorTest::~AnyFunctorTest() = default;
+
+AnyFunctorFactory AnyFunctorTest::GetFactory()
+{
+  return [this]() {
+    return std::unique_ptr<AnyFunctor>(new TestFunctor{m_n_created++, m_overlaps});
+  };
+}
+
+std::vector<AnyValue> AnyFunctorTest::CallConcurrently(AnyFunctor& functor, std::size_t n_threads,
+                                                       std::size_t n_calls)
+{
+  std::vector<std::vector<AnyValue>> outputs(n_threads);
+  std::vector<std::thread> threads;
+  for (std::size_t thread_idx = 0; thread_idx < n_threads; ++thread_idx)
+  {
+    threads.emplace_back([&functor, &outputs, thread_idx, n_calls]() {
+      const auto key = "client" + std::to_string(thread_idx);
+      for (std::size_t idx = 0; idx < n_calls; ++idx)
+      {
+        outputs[thread_idx].push_back(functor(Request(key, static_cast<uint32>(idx))));
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  std::vector<AnyValue> result;
+  for (auto& thread_outputs : outputs)
+  {
+    for (auto& output : thread_outputs)
+    {
+      result.push_back(std::move(output));
+    }
+  }
+  return result;
+}
+
+AnyValue Request(const std::string& key, uint32 value)
+{
+  return AnyValue{{
+    {"key", key},
+    {"value", value}
+  }};
+}
+}  // unnamed namespace
@@ -75,3 +75,51 @@ TEST(AnyValueAssignTest, Arrays)
   EXPECT_EQ(copy.GetType(), array_val.GetType());
   EXPECT_THROW(copy["[0]"].AddMember("third", {SignedInteger8Type, 10}), InvalidOperationException);
 }
+
+TEST(AnyValueAssignTest, IdenticalTypes)
+{
+  const AnyType record_type{{
+    {"id", UnsignedInteger32Type},
+    {"name", StringType},
+    {"samples", AnyType(3, Float64Type)}
+  }, "record_t"};
+  AnyValue source{record_type};
+  source["id"] = 7u;
+  source["name"] = "short name";
+  source["samples[2]"] = 1.5;
+
+  // Unlocked destination: existing nodes are reused
+  AnyValue dest{record_type};
+  dest["name"] = std::string(64, 'x');
+  const auto* name_node = &dest["name"];
+  const auto* element_node = &dest["samples[1]"];
+  EXPECT_NO_THROW(dest = source);
+  EXPECT_EQ(dest, source);
+  EXPECT_EQ(&dest["name"], name_node);
+  EXPECT_EQ(&dest["samples[1]"], element_node);
+
+  // Locked destination (array element)
+  AnyValue records{2, record_type};
+  const auto* id_node = &records["[1].id"];
+  EXPECT_NO_THROW(records[1] = source);
+  EXPECT_EQ(records[1], source);
+  EXPECT_EQ(&records["[1].id"], id_node);
+  EXPECT_THROW(records[1].AddMember("extra", {SignedInteger8Type, 1}), InvalidOperationException);
+
+  // Move assignment from a locked value
+  EXPECT_NO_THROW(dest = std::move(records[0]));
+  EXPECT_EQ(dest, AnyValue{record_type});
+  EXPECT_EQ(&dest["name"], name_node);
+
+  // Different type names or member names are not identical and replace the unlocked value
+  const AnyType other_type{{
+    {"id", UnsignedInteger32Type},
+    {"name", StringType},
+    {"samples", AnyType(3, Float64Type)}
+  }, "other_t"};
+  AnyValue other{other_type};
+  EXPECT_NO_THROW(dest = other);
+  EXPECT_EQ(dest.GetType(), other_type);
+  EXPECT_NO_THROW(records[0] = other);
+  EXPECT_EQ(records[0].GetType(), record_type);
+}
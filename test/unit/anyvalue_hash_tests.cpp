@@ -0,0 +1,214 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_operations.h>
+
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace sup::dto;
+
+class AnyValueHashTest : public ::testing::Test
+{
+protected:
+  AnyValueHashTest();
+  ~AnyValueHashTest() override;
+
+  AnyValue m_struct_value;
+};
+
+TEST_F(AnyValueHashTest, EqualValues)
+{
+  // Equal values of the same type
+  EXPECT_EQ(Hash(AnyValue{}), Hash(AnyValue{}));
+  EXPECT_EQ(Hash(AnyValue{42}), Hash(AnyValue{42}));
+  EXPECT_EQ(Hash(AnyValue{"text"}), Hash(AnyValue{"text"}));
+  AnyValue copy = m_struct_value;
+  EXPECT_EQ(copy, m_struct_value);
+  EXPECT_EQ(Hash(copy), Hash(m_struct_value));
+
+  // Equal numeric values of different types
+  const AnyValue i8{SignedInteger8Type, 3};
+  const AnyValue u64{UnsignedInteger64Type, 3};
+  const AnyValue f32{Float32Type, 3.0};
+  const AnyValue f64{Float64Type, 3.0};
+  for (const auto& value : {u64, f32, f64})
+  {
+    ASSERT_EQ(value, i8);
+    EXPECT_EQ(Hash(value), Hash(i8));
+  }
+  const AnyValue half_f32{Float32Type, 0.5};
+  const AnyValue half_f64{Float64Type, 0.5};
+  EXPECT_EQ(half_f32, half_f64);
+  EXPECT_EQ(Hash(half_f32), Hash(half_f64));
+  const AnyValue one_u8{UnsignedInteger8Type, 1};
+  EXPECT_EQ(AnyValue{true}, one_u8);
+  EXPECT_EQ(Hash(AnyValue{true}), Hash(one_u8));
+  EXPECT_EQ(AnyValue{-0.0}, AnyValue{0});
+  EXPECT_EQ(Hash(AnyValue{-0.0}), Hash(AnyValue{0}));
+  const AnyValue minus_seven{SignedInteger64Type, -7};
+  EXPECT_EQ(Hash(minus_seven), Hash(AnyValue{-7.0}));
+
+  // Strings and fixed strings with the same content
+  AnyValue fixed_string{FixedStringType(16)};
+  fixed_string = "text";
+  ASSERT_EQ(fixed_string, AnyValue{"text"});
+  EXPECT_EQ(Hash(fixed_string), Hash(AnyValue{"text"}));
+
+  // Structures with leaves of different types that compare equal
+  AnyValue other_struct{{
+    {"id", {UnsignedInteger16Type, 1}},
+    {"name", "first"},
+    {"values", AnyValue(3, Float64Type)}
+  }, "hash_test_t"};
+  other_struct["values"][1] = 2.0;
+  other_struct["values"][2] = 4.0;
+  ASSERT_EQ(other_struct, m_struct_value);
+  EXPECT_EQ(Hash(other_struct), Hash(m_struct_value));
+}
+
+TEST_F(AnyValueHashTest, DifferentValues)
+{
+  EXPECT_NE(Hash(AnyValue{1}), Hash(AnyValue{2}));
+  EXPECT_NE(Hash(AnyValue{0.5}), Hash(AnyValue{0.25}));
+  EXPECT_NE(Hash(AnyValue{"a"}), Hash(AnyValue{"b"}));
+  EXPECT_NE(Hash(AnyValue{}), Hash(AnyValue{0}));
+
+  // Single leaf changed
+  auto changed_leaf = m_struct_value;
+  changed_leaf["values"][2] = 5;
+  EXPECT_NE(Hash(changed_leaf), Hash(m_struct_value));
+
+  // Different type name or member names
+  AnyValue renamed{{
+    {"id", 1},
+    {"name", "first"},
+    {"values", m_struct_value["values"]}
+  }, "other_t"};
+  EXPECT_NE(Hash(renamed), Hash(m_struct_value));
+  AnyValue other_members{{
+    {"index", 1},
+    {"name", "first"},
+    {"values", m_struct_value["values"]}
+  }, "hash_test_t"};
+  EXPECT_NE(Hash(other_members), Hash(m_struct_value));
+
+  // Same leaves in a different structure
+  AnyValue flat{{{"a", 1}, {"b", 2}}};
+  AnyValue nested{{{"a", {{"b", 2}}}}};
+  EXPECT_NE(Hash(flat), Hash(nested));
+  EXPECT_NE(Hash(AnyValue(2, SignedInteger32Type)), Hash(AnyValue(3, SignedInteger32Type)));
+
+  // Distribution over a range of values
+  std::set<std::size_t> hashes;
+  for (uint32 idx = 0; idx < 1000; ++idx)
+  {
+    AnyValue value{{{"id", idx}, {"name", "element"}}};
+    (void)hashes.insert(Hash(value));
+  }
+  EXPECT_EQ(hashes.size(), 1000);
+}
+
+TEST_F(AnyValueHashTest, NumericArrays)
+{
+  // Arrays of numeric elements are hashed in bulk; equal arrays with different element types
+  // still have the same hash
+  const std::size_t n_elements = 1000;
+  AnyValue int_array(n_elements, SignedInteger32Type);
+  AnyValue float_array(n_elements, Float64Type);
+  for (std::size_t idx = 0; idx < n_elements; ++idx)
+  {
+    int_array[idx] = static_cast<int32>(idx) - 500;
+    float_array[idx] = static_cast<float64>(idx) - 500.0;
+  }
+  ASSERT_EQ(int_array, float_array);
+  EXPECT_EQ(Hash(int_array), Hash(float_array));
+
+  // Every element and its position contribute to the hash
+  std::set<std::size_t> hashes{Hash(int_array)};
+  for (std::size_t idx = 0; idx < n_elements; idx += 37)
+  {
+    auto changed = int_array;
+    changed[idx] = 12345;
+    (void)hashes.insert(Hash(changed));
+  }
+  auto swapped = int_array;
+  swapped[0] = int_array[1];
+  swapped[1] = int_array[0];
+  (void)hashes.insert(Hash(swapped));
+  EXPECT_EQ(hashes.size(), 30);
+
+  // Arrays of strings and fixed strings with the same content
+  AnyValue string_array(3, StringType);
+  AnyValue fixed_string_array(3, FixedStringType(8));
+  for (std::size_t idx = 0; idx < 3; ++idx)
+  {
+    string_array[idx] = "str" + std::to_string(idx);
+    fixed_string_array[idx] = "str" + std::to_string(idx);
+  }
+  ASSERT_EQ(string_array, fixed_string_array);
+  EXPECT_EQ(Hash(string_array), Hash(fixed_string_array));
+
+  // Arrays of structures
+  AnyValue struct_array(20, m_struct_value.GetType());
+  const auto original = Hash(struct_array);
+  struct_array[19]["values"][2] = 1;
+  EXPECT_NE(Hash(struct_array), original);
+}
+
+TEST_F(AnyValueHashTest, StdHash)
+{
+  EXPECT_EQ(std::hash<AnyValue>{}(m_struct_value), Hash(m_struct_value));
+
+  // Deduplication in an unordered set
+  std::unordered_set<AnyValue> values;
+  for (uint32 idx = 0; idx < 100; ++idx)
+  {
+    (void)values.insert(AnyValue{{{"id", idx % 10}, {"name", "element"}}});
+  }
+  EXPECT_EQ(values.size(), 10);
+  EXPECT_EQ(values.count(AnyValue{{{"id", 3u}, {"name", "element"}}}), 1);
+  EXPECT_EQ(values.count(AnyValue{{{"id", 10u}, {"name", "element"}}}), 0);
+
+  // Lookup with a key of a different, but equal, type
+  std::unordered_map<AnyValue, std::string> names;
+  names[AnyValue{UnsignedInteger16Type, 7}] = "seven";
+  EXPECT_EQ(names.at(AnyValue{SignedInteger64Type, 7}), "seven");
+}
+
+AnyValueHashTest::AnyValueHashTest()
+  : m_struct_value{{
+      {"id", 1},
+      {"name", "first"},
+      {"values", AnyValue(3, SignedInteger32Type)}
+    }, "hash_test_t"}
+{
+  m_struct_value["values"][1] = 2;
+  m_struct_value["values"][2] = 4;
+}
+
+AnyValueHashTest::~AnyValueHashTest() = default;
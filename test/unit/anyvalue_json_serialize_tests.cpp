@@ -190,6 +190,22 @@ TEST_F(AnyValueJSONSerializeTest, Float32Value)
   EXPECT_EQ(json_string, expected);
 }
 
+TEST_F(AnyValueJSONSerializeTest, Float32ShortestRepresentation)
+{
+  EXPECT_EQ(ValuesToJSONString(AnyValue{0.1f}), "0.1");
+  EXPECT_EQ(ValuesToJSONString(AnyValue{-1.0f}), "-1.0");
+  EXPECT_EQ(ValuesToJSONString(AnyValue{3.14f}), "3.14");
+  EXPECT_EQ(ValuesToJSONString(AnyValue{-2.5e-7f}), "-2.5e-07");
+  EXPECT_EQ(ValuesToJSONString(AnyValue{1e20f}), "1e+20");
+  EXPECT_EQ(ValuesToJSONString(AnyValue{3.4028235e38f}), "3.4028235e+38");
+
+  AnyValue array_val{AnyType(3, Float32Type)};
+  array_val[0] = 0.3f;
+  array_val[1] = 16777216.0f;
+  array_val[2] = 1e-45f;
+  EXPECT_EQ(ValuesToJSONString(array_val), "[0.3,16777216.0,1e-45]");
+}
+
 TEST_F(AnyValueJSONSerializeTest, Float64Value)
 {
   AnyValue float64_val = {Float64Type, -777.125};
@@ -0,0 +1,226 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_leaves.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace sup::dto;
+
+namespace
+{
+AnyValue NestedValue();
+}
+
+TEST(AnyValueLeavesTest, IterateLeaves)
+{
+  const auto value = NestedValue();
+  std::vector<std::string> paths;
+  std::vector<AnyValue> leaves;
+  std::size_t expected_ordinal = 0;
+  for (const auto& leaf : Leaves(value))
+  {
+    EXPECT_EQ(leaf.ordinal, expected_ordinal++);
+    paths.push_back(leaf.path.ToString());
+    leaves.push_back(leaf.value);
+    EXPECT_EQ(value[leaf.path.ToString()], leaf.value);
+  }
+  const std::vector<std::string> expected_paths = {
+    "id", "position[0]", "position[1]", "position[2]", "setpoints[0].name",
+    "setpoints[0].value", "setpoints[1].name", "setpoints[1].value", "enabled"
+  };
+  EXPECT_EQ(paths, expected_paths);
+  EXPECT_EQ(leaves[0], 7u);
+  EXPECT_EQ(leaves[5], -0.5);
+  EXPECT_EQ(leaves[7], 1.5);
+  EXPECT_EQ(leaves[6], "second");
+  EXPECT_EQ(leaves[8], true);
+
+  // Path components
+  auto it = Leaves(value).begin();
+  std::advance(it, 7);
+  const auto leaf = *it;
+  ASSERT_EQ(leaf.path.size(), 3);
+  ASSERT_NE(leaf.path[0].member_name, nullptr);
+  EXPECT_EQ(*leaf.path[0].member_name, "setpoints");
+  EXPECT_EQ(leaf.path[0].index, 2);
+  EXPECT_EQ(leaf.path[1].member_name, nullptr);
+  EXPECT_EQ(leaf.path[1].index, 1);
+  ASSERT_NE(leaf.path[2].member_name, nullptr);
+  EXPECT_EQ(*leaf.path[2].member_name, "value");
+  EXPECT_EQ(leaf.path[2].index, 1);
+}
+
+TEST(AnyValueLeavesTest, ModifyLeaves)
+{
+  AnyValue value{{
+    {"a", ArrayValue({1, 2, 3})},
+    {"b", {{"c", 4}}}
+  }};
+  for (auto leaf : Leaves(value))
+  {
+    leaf.value = static_cast<int32>(10 * leaf.ordinal);
+  }
+  EXPECT_EQ(value["a[0]"], 0);
+  EXPECT_EQ(value["a[1]"], 10);
+  EXPECT_EQ(value["a[2]"], 20);
+  EXPECT_EQ(value["b.c"], 30);
+}
+
+TEST(AnyValueLeavesTest, SpecialValues)
+{
+  {
+    // Scalar root is a single leaf with an empty path
+    const AnyValue scalar{3.0f};
+    auto it = Leaves(scalar).begin();
+    ASSERT_NE(it, Leaves(scalar).end());
+    EXPECT_TRUE((*it).path.empty());
+    EXPECT_EQ((*it).path.ToString(), "");
+    EXPECT_EQ((*it).value, scalar);
+    EXPECT_EQ(++it, Leaves(scalar).end());
+  }
+  {
+    // Empty values and empty arrays do not have leaves
+    const AnyValue empty{};
+    EXPECT_EQ(Leaves(empty).begin(), Leaves(empty).end());
+    const AnyValue empty_array{0, SignedInteger8Type};
+    EXPECT_EQ(Leaves(empty_array).begin(), Leaves(empty_array).end());
+  }
+  {
+    // Empty parts are skipped
+    const AnyValue value{{
+      {"first", AnyValue{}},
+      {"array", AnyValue{0, StringType}},
+      {"last", 5}
+    }};
+    std::vector<std::string> paths;
+    for (const auto& leaf : Leaves(value))
+    {
+      paths.push_back(leaf.path.ToString());
+    }
+    EXPECT_EQ(paths, std::vector<std::string>{"last"});
+  }
+}
+
+TEST(AnyValueLeavesTest, DeeplyNested)
+{
+  // Deeper than the inline stack of the iterator
+  const std::size_t depth = 3 * ConstLeafIterator::kInlineDepth;
+  AnyValue value{42u};
+  for (std::size_t idx = 0; idx < depth; ++idx)
+  {
+    value = AnyValue{{{"x", value}, {"y", static_cast<uint32>(idx)}}};
+  }
+  std::size_t n_leaves = 0;
+  for (const auto& leaf : Leaves(value))
+  {
+    if (n_leaves == 0)
+    {
+      EXPECT_EQ(leaf.path.size(), depth);
+      EXPECT_EQ(leaf.value, 42u);
+    }
+    else
+    {
+      EXPECT_EQ(leaf.path.size(), depth + 1 - n_leaves);
+      EXPECT_EQ(leaf.value, static_cast<uint32>(n_leaves - 1));
+    }
+    ++n_leaves;
+  }
+  EXPECT_EQ(n_leaves, depth + 1);
+}
+
+TEST(AnyValueLeavesTest, LeafIndex)
+{
+  auto value = NestedValue();
+  LeafIndex index{value.GetType()};
+  EXPECT_EQ(index.GetType(), value.GetType());
+  ASSERT_EQ(index.NumberOfLeaves(), 9);
+  for (const auto& leaf : Leaves(value))
+  {
+    EXPECT_EQ(index.GetLeafPath(leaf.ordinal).ToString(), leaf.path.ToString());
+    EXPECT_EQ(index.GetLeafTypeCode(leaf.ordinal), leaf.value.GetTypeCode());
+    EXPECT_EQ(&index.GetLeaf(value, leaf.ordinal), &leaf.value);
+  }
+  index.GetLeaf(value, 6) = "changed";
+  EXPECT_EQ(value["setpoints[1].name"], "changed");
+
+  // Other value of the same type
+  AnyValue other{value.GetType()};
+  const auto& const_other = other;
+  EXPECT_EQ(index.GetLeaf(const_other, 3), 0.0);
+  EXPECT_EQ(&index.GetLeaf(const_other, 3), &other["position[2]"]);
+}
+
+TEST(AnyValueLeavesTest, LeafIndexErrors)
+{
+  const auto value = NestedValue();
+  LeafIndex index{value.GetType()};
+  EXPECT_THROW(index.GetLeafPath(9), InvalidOperationException);
+  EXPECT_THROW(index.GetLeafTypeCode(9), InvalidOperationException);
+  EXPECT_THROW(index.GetLeaf(value, 9), InvalidOperationException);
+
+  // Value with a different structure
+  const AnyValue other{{{"id", 1u}}};
+  EXPECT_THROW(index.GetLeaf(other, 2), InvalidOperationException);
+  const AnyValue wrong_leaf{{{"id", 1.0}}};
+  EXPECT_THROW(index.GetLeaf(wrong_leaf, 0), InvalidOperationException);
+
+  // Unbounded arrays
+  AnyType unbounded{{{"values", AnyType{0, Float32Type}}}};
+  EXPECT_THROW(LeafIndex{unbounded}, InvalidOperationException);
+
+  // Types without leaves
+  LeafIndex empty_index{EmptyType};
+  EXPECT_EQ(empty_index.NumberOfLeaves(), 0);
+}
+
+namespace
+{
+AnyValue NestedValue()
+{
+  AnyType setpoint_type{{
+    {"name", StringType},
+    {"value", Float64Type}
+  }};
+  AnyType nested_type{{
+    {"id", UnsignedInteger32Type},
+    {"position", AnyType(3, Float32Type)},
+    {"setpoints", AnyType(2, setpoint_type)},
+    {"enabled", BooleanType}
+  }};
+  AnyValue result{nested_type};
+  result["id"] = 7u;
+  result["position[1]"] = 2.0f;
+  result["setpoints[0].name"] = "first";
+  result["setpoints[0].value"] = -0.5;
+  result["setpoints[1].name"] = "second";
+  result["setpoints[1].value"] = 1.5;
+  result["enabled"] = true;
+  return result;
+}
+}
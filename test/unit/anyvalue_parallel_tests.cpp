@@ -0,0 +1,203 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_helper.h>
+#include <sup/dto/thread_pool.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace sup::dto;
+
+namespace
+{
+AnyType ElementType();
+
+AnyValue Element(uint32 idx);
+
+AnyValue LargeValue(std::size_t n_elements);
+}
+
+class AnyValueParallelTest : public ::testing::Test
+{
+protected:
+  AnyValueParallelTest();
+  ~AnyValueParallelTest() override;
+
+  ThreadPool m_pool;
+};
+
+TEST_F(AnyValueParallelTest, Copy)
+{
+  const auto value = LargeValue(1000);
+  AnyValue copy{value, m_pool};
+  EXPECT_EQ(copy, value);
+  EXPECT_EQ(copy.GetType(), value.GetType());
+
+  // Array elements have a locked type, while the copy itself does not
+  EXPECT_THROW(copy["elements"][3].AddMember("extra", 1), InvalidOperationException);
+  EXPECT_NO_THROW(copy.AddMember("extra", 1));
+
+  // Values without large arrays
+  const auto element = Element(3);
+  EXPECT_EQ(AnyValue(element, m_pool), element);
+  const AnyValue scalar{2.5};
+  EXPECT_EQ(AnyValue(scalar, m_pool), scalar);
+  const AnyValue empty{};
+  EXPECT_EQ(AnyValue(empty, m_pool), empty);
+}
+
+TEST_F(AnyValueParallelTest, Equals)
+{
+  const auto value = LargeValue(1000);
+  auto other = value;
+  EXPECT_TRUE(value.Equals(other, m_pool));
+
+  other["elements"][777]["limits"]["high"] = 0;
+  EXPECT_FALSE(value.Equals(other, m_pool));
+  EXPECT_EQ(value.Equals(other, m_pool), value == other);
+
+  other = value;
+  other["header"] = "different";
+  EXPECT_FALSE(value.Equals(other, m_pool));
+
+  // Different number of elements
+  EXPECT_FALSE(value.Equals(LargeValue(999), m_pool));
+  EXPECT_FALSE(value.Equals(AnyValue{}, m_pool));
+}
+
+TEST_F(AnyValueParallelTest, ConvertFrom)
+{
+  AnyValue source{1000, SignedInteger32Type};
+  for (int32 idx = 0; idx < 1000; ++idx)
+  {
+    source[idx] = -idx;
+  }
+  AnyValue target{1000, Float64Type};
+  target.ConvertFrom(source, m_pool);
+  for (int32 idx = 0; idx < 1000; ++idx)
+  {
+    EXPECT_EQ(target[idx], static_cast<float64>(-idx));
+  }
+  AnyValue sequential{1000, Float64Type};
+  sequential.ConvertFrom(source);
+  EXPECT_EQ(target, sequential);
+
+  // Same type
+  const auto value = LargeValue(500);
+  AnyValue dest{value.GetType()};
+  dest.ConvertFrom(value, m_pool);
+  EXPECT_EQ(dest, value);
+
+  // Failing conversions
+  source[600] = 1000;
+  AnyValue narrow_target{1000, SignedInteger8Type};
+  EXPECT_THROW(narrow_target.ConvertFrom(source, m_pool), InvalidConversionException);
+  AnyValue wrong_size{999, Float64Type};
+  EXPECT_THROW(wrong_size.ConvertFrom(source, m_pool), InvalidConversionException);
+}
+
+TEST_F(AnyValueParallelTest, ValuesToJSONString)
+{
+  const auto value = LargeValue(1000);
+  EXPECT_EQ(ValuesToJSONString(value, m_pool), ValuesToJSONString(value));
+
+  // Nested large arrays and arrays of scalars
+  AnyValue nested{{
+    {"grid", AnyValue(100, AnyType(100, Float32Type))},
+    {"small", AnyValue(3, StringType)},
+    {"large", AnyValue(200, StringType)}
+  }};
+  nested["grid"][42][17] = 1.25f;
+  nested["small"][1] = "small \"quoted\"";
+  nested["large"][150] = "large\n\\escaped";
+  EXPECT_EQ(ValuesToJSONString(nested, m_pool), ValuesToJSONString(nested));
+
+  // Large arrays deeper in the tree, next to members without them
+  AnyValue deep{{
+    {"header", Element(1)},
+    {"payload", {
+      {"tag", "deep"},
+      {"samples", AnyValue(500, Float64Type)},
+      {"flags", AnyValue(2, BooleanType)}
+    }}
+  }};
+  deep["payload.samples"][250] = 2.5;
+  EXPECT_EQ(ValuesToJSONString(deep, m_pool), ValuesToJSONString(deep));
+
+  // Values without large arrays
+  const auto element = Element(5);
+  EXPECT_EQ(ValuesToJSONString(element, m_pool), ValuesToJSONString(element));
+  EXPECT_EQ(ValuesToJSONString(AnyValue{}, m_pool), ValuesToJSONString(AnyValue{}));
+}
+
+AnyValueParallelTest::AnyValueParallelTest()
+  : m_pool{4}
+{}
+
+AnyValueParallelTest::~AnyValueParallelTest() = default;
+
+namespace
+{
+AnyType ElementType()
+{
+  return AnyType{{
+    {"id", UnsignedInteger32Type},
+    {"name", StringType},
+    {"values", AnyType(4, Float64Type)},
+    {"limits", {
+      {"low", SignedInteger32Type},
+      {"high", SignedInteger32Type}
+    }}
+  }, "element_t"};
+}
+
+AnyValue Element(uint32 idx)
+{
+  AnyValue result{ElementType()};
+  result["id"] = idx;
+  result["name"] = "element_" + std::to_string(idx);
+  for (uint32 i = 0; i < 4; ++i)
+  {
+    result["values"][i] = 0.5 * (idx + i);
+  }
+  result["limits.low"] = -static_cast<int32>(idx);
+  result["limits.high"] = static_cast<int32>(idx * 3);
+  return result;
+}
+
+AnyValue LargeValue(std::size_t n_elements)
+{
+  AnyValue result{{
+    {"header", "snapshot"},
+    {"elements", AnyValue(n_elements, ElementType(), "element_array_t")}
+  }, "snapshot_t"};
+  for (std::size_t idx = 0; idx < n_elements; ++idx)
+  {
+    result["elements"][idx] = Element(static_cast<uint32>(idx));
+  }
+  return result;
+}
+}
@@ -0,0 +1,239 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "allocation_counter.h"
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_publisher.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace sup::dto;
+
+namespace
+{
+AnyType StateType();
+
+// State with all array elements equal to the counter, so that readers can detect torn values
+AnyValue State(uint32 counter);
+}  // unnamed namespace
+
+class AnyValuePublisherTest : public ::testing::Test
+{
+protected:
+  AnyValuePublisherTest();
+  ~AnyValuePublisherTest() override;
+
+  AnyValuePublisher m_publisher;
+};
+
+TEST_F(AnyValuePublisherTest, Construction)
+{
+  EXPECT_THROW(AnyValuePublisher(State(0), 1), InvalidOperationException);
+  EXPECT_THROW(AnyValuePublisher(State(0), kMaxPublisherBuffers + 1), InvalidOperationException);
+  EXPECT_EQ(m_publisher.NumberOfBuffers(), 3);
+  EXPECT_EQ(m_publisher.GetVersion(), 0);
+  auto snapshot = m_publisher.GetSnapshot();
+  EXPECT_EQ(*snapshot, State(0));
+  EXPECT_EQ(snapshot->GetType(), StateType());
+  EXPECT_EQ(snapshot.GetVersion(), 0);
+
+  AnyValuePublisher other_publisher{State(5), 2};
+  EXPECT_EQ(other_publisher.NumberOfBuffers(), 2);
+  EXPECT_EQ(*other_publisher.GetSnapshot(), State(5));
+}
+
+TEST_F(AnyValuePublisherTest, Publish)
+{
+  auto first = m_publisher.GetSnapshot();
+  m_publisher.Publish(State(1));
+  EXPECT_EQ(m_publisher.GetVersion(), 1);
+  auto second = m_publisher.GetSnapshot();
+  m_publisher.Publish(State(2));
+  auto third = m_publisher.GetSnapshot();
+
+  // Snapshots keep their value after later publications
+  EXPECT_EQ(*first, State(0));
+  EXPECT_EQ(*second, State(1));
+  EXPECT_EQ(*third, State(2));
+  EXPECT_EQ(first.GetVersion(), 0);
+  EXPECT_EQ(second.GetVersion(), 1);
+  EXPECT_EQ(third.GetVersion(), 2);
+
+  // Moving snapshots
+  AnyValueSnapshot moved{std::move(first)};
+  EXPECT_EQ(*moved, State(0));
+  moved = std::move(third);
+  EXPECT_EQ(*moved, State(2));
+
+  // Values of another type are converted
+  AnyValue converted{{
+    {"counter", {UnsignedInteger16Type, 3}},
+    {"values", State(3)["values"]}
+  }, "publisher_state_t"};
+  m_publisher.Publish(converted);
+  auto fourth = m_publisher.GetSnapshot();
+  EXPECT_EQ(fourth->GetType(), StateType());
+  EXPECT_EQ(*fourth, State(3));
+
+  // Failed conversion
+  EXPECT_THROW(m_publisher.Publish(AnyValue{"wrong"}), InvalidConversionException);
+  EXPECT_EQ(m_publisher.GetVersion(), 3);
+  EXPECT_EQ(*m_publisher.GetSnapshot(), State(3));
+}
+
+TEST_F(AnyValuePublisherTest, BufferReuse)
+{
+  // Without snapshots, the preallocated buffers are reused
+  for (uint32 idx = 1; idx <= 10; ++idx)
+  {
+    m_publisher.Publish(State(idx));
+    EXPECT_EQ(*m_publisher.GetSnapshot(), State(idx));
+  }
+  EXPECT_EQ(m_publisher.NumberOfBuffers(), 3);
+
+  // Snapshots of all buffers that are not current: buffers are added
+  std::vector<AnyValueSnapshot> snapshots;
+  for (uint32 idx = 11; idx <= 15; ++idx)
+  {
+    snapshots.push_back(m_publisher.GetSnapshot());
+    m_publisher.Publish(State(idx));
+  }
+  EXPECT_EQ(m_publisher.NumberOfBuffers(), 6);
+  for (uint32 idx = 0; idx < 5; ++idx)
+  {
+    EXPECT_EQ(*snapshots[idx], State(idx + 10));
+  }
+
+  // After releasing the snapshots, the buffers are reused
+  snapshots.clear();
+  for (uint32 idx = 16; idx <= 30; ++idx)
+  {
+    m_publisher.Publish(State(idx));
+  }
+  EXPECT_EQ(m_publisher.NumberOfBuffers(), 6);
+  EXPECT_EQ(*m_publisher.GetSnapshot(), State(30));
+
+  // Many snapshots of the same version only occupy a single buffer
+  for (uint32 idx = 0; idx < 100; ++idx)
+  {
+    snapshots.push_back(m_publisher.GetSnapshot());
+  }
+  m_publisher.Publish(State(31));
+  m_publisher.Publish(State(32));
+  EXPECT_EQ(m_publisher.NumberOfBuffers(), 6);
+}
+
+TEST_F(AnyValuePublisherTest, NoAllocations)
+{
+  const auto next_state = State(1);
+  AllocationCounter allocations;
+  for (uint32 idx = 0; idx < 10; ++idx)
+  {
+    auto snapshot = m_publisher.GetSnapshot();
+    m_publisher.Publish(next_state);
+  }
+  EXPECT_EQ(allocations.GetCount(), 0);
+  EXPECT_EQ(*m_publisher.GetSnapshot(), next_state);
+}
+
+TEST_F(AnyValuePublisherTest, ConcurrentReaders)
+{
+  const uint32 n_publications = 2000;
+  std::vector<AnyValue> states;
+  for (uint32 idx = 1; idx <= n_publications; ++idx)
+  {
+    states.push_back(State(idx));
+  }
+  std::atomic<bool> done{false};
+  std::atomic<int> failures{0};
+  std::vector<std::thread> readers;
+  for (int reader_idx = 0; reader_idx < 4; ++reader_idx)
+  {
+    readers.emplace_back([this, &done, &failures]() {
+      uint64 last_version = 0;
+      while (!done)
+      {
+        auto snapshot = m_publisher.GetSnapshot();
+        const auto counter = (*snapshot)["counter"].As<uint32>();
+        if (snapshot.GetVersion() < last_version || counter != snapshot.GetVersion())
+        {
+          ++failures;
+        }
+        for (std::size_t idx = 0; idx < 16; ++idx)
+        {
+          if ((*snapshot)["values"][idx].As<uint32>() != counter)
+          {
+            ++failures;
+          }
+        }
+        last_version = snapshot.GetVersion();
+      }
+    });
+  }
+  for (const auto& state : states)
+  {
+    m_publisher.Publish(state);
+  }
+  done = true;
+  for (auto& reader : readers)
+  {
+    reader.join();
+  }
+  EXPECT_EQ(failures, 0);
+  EXPECT_EQ(m_publisher.GetVersion(), n_publications);
+  EXPECT_EQ(*m_publisher.GetSnapshot(), states.back());
+  EXPECT_LE(m_publisher.NumberOfBuffers(), 7);
+}
+
+AnyValuePublisherTest::AnyValuePublisherTest()
+  : m_publisher{State(0)}
+{}
+
+AnyValuePublisherTest::~AnyValuePublisherTest() = default;
+
+namespace
+{
+AnyType StateType()
+{
+  return AnyType{{
+    {"counter", UnsignedInteger32Type},
+    {"values", AnyType(16, UnsignedInteger32Type)}
+  }, "publisher_state_t"};
+}
+
+AnyValue State(uint32 counter)
+{
+  AnyValue result{StateType()};
+  result["counter"] = counter;
+  for (std::size_t idx = 0; idx < 16; ++idx)
+  {
+    result["values"][idx] = counter;
+  }
+  return result;
+}
+}  // unnamed namespace
@@ -0,0 +1,193 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/any_functor.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/async_any_functor.h>
+#include <sup/dto/thread_pool.h>
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+using namespace sup::dto;
+
+namespace
+{
+/**
+ * @brief Thread safe functor that doubles its input and throws for negative inputs.
+ */
+class DoublingFunctor : public AnyFunctor
+{
+public:
+  DoublingFunctor();
+  ~DoublingFunctor() override;
+
+  AnyValue operator()(const AnyValue& input) override;
+
+  std::atomic<int> m_n_calls;
+};
+
+/**
+ * @brief Executor that queues tasks until they are explicitly run.
+ */
+class ManualExecutor
+{
+public:
+  ManualExecutor();
+  ~ManualExecutor();
+
+  AnyFunctorExecutor GetExecutor();
+
+  void RunAll();
+
+  std::vector<std::function<void()>> m_tasks;
+};
+}  // unnamed namespace
+
+TEST(AsyncAnyFunctorTest, Future)
+{
+  DoublingFunctor functor;
+  ThreadPool pool{4};
+  AsyncAnyFunctor async_functor{functor, pool};
+  std::vector<std::future<AnyValue>> futures;
+  for (int32 idx = 0; idx < 100; ++idx)
+  {
+    futures.push_back(async_functor.CallAsync(AnyValue{idx}));
+  }
+  for (int32 idx = 0; idx < 100; ++idx)
+  {
+    EXPECT_EQ(futures[idx].get(), AnyValue{2 * idx});
+  }
+  EXPECT_EQ(functor.m_n_calls, 100);
+
+  // Exceptions are rethrown by the future
+  auto failing = async_functor.CallAsync(AnyValue{-1});
+  EXPECT_THROW(failing.get(), InvalidOperationException);
+}
+
+TEST(AsyncAnyFunctorTest, Callback)
+{
+  DoublingFunctor functor;
+  ManualExecutor executor;
+  AsyncAnyFunctor async_functor{functor, executor.GetExecutor()};
+  AnyValue output;
+  std::exception_ptr error;
+  auto callback = [&output, &error](AnyValue&& result, std::exception_ptr result_error) {
+    output = std::move(result);
+    error = result_error;
+  };
+  async_functor.CallAsync(AnyValue{21}, callback);
+  EXPECT_EQ(async_functor.NumberOfPendingCalls(), 1);
+  EXPECT_EQ(functor.m_n_calls, 0);
+  executor.RunAll();
+  EXPECT_EQ(async_functor.NumberOfPendingCalls(), 0);
+  EXPECT_EQ(output, AnyValue{42});
+  EXPECT_FALSE(error);
+
+  async_functor.CallAsync(AnyValue{-5}, callback);
+  executor.RunAll();
+  EXPECT_TRUE(IsEmptyValue(output));
+  ASSERT_TRUE(error);
+  EXPECT_THROW(std::rethrow_exception(error), InvalidOperationException);
+
+  // Exceptions thrown by the callback are discarded
+  async_functor.CallAsync(AnyValue{1}, [](AnyValue&&, std::exception_ptr) {
+    throw InvalidOperationException("callback failed");
+  });
+  EXPECT_NO_THROW(executor.RunAll());
+  EXPECT_EQ(async_functor.NumberOfPendingCalls(), 0);
+}
+
+TEST(AsyncAnyFunctorTest, ExecutorFailure)
+{
+  DoublingFunctor functor;
+  AsyncAnyFunctor async_functor{functor, [](std::function<void()>) {
+    throw InvalidOperationException("executor is shut down");
+  }};
+  EXPECT_THROW(async_functor.CallAsync(AnyValue{1}), InvalidOperationException);
+  EXPECT_EQ(async_functor.NumberOfPendingCalls(), 0);
+}
+
+TEST(AsyncAnyFunctorTest, DestructorWaitsForPendingCalls)
+{
+  DoublingFunctor functor;
+  std::atomic<int> n_callbacks{0};
+  {
+    ThreadPool pool{2};
+    AsyncAnyFunctor async_functor{functor, pool};
+    for (int32 idx = 0; idx < 50; ++idx)
+    {
+      async_functor.CallAsync(AnyValue{idx}, [&n_callbacks](AnyValue&&, std::exception_ptr) {
+        ++n_callbacks;
+      });
+    }
+  }
+  EXPECT_EQ(n_callbacks, 50);
+}
+
+namespace
+{
+DoublingFunctor::DoublingFunctor()
+  : AnyFunctor{}
+  , m_n_calls{0}
+{}
+
+DoublingFunctor::~DoublingFunctor() = default;
+
+AnyValue DoublingFunctor::operator()(const AnyValue& input)
+{
+  ++m_n_calls;
+  const auto value = input.As<int32>();
+  if (value < 0)
+  {
+    throw InvalidOperationException("DoublingFunctor: negative input");
+  }
+  return AnyValue{2 * value};
+}
+
+ManualExecutor::ManualExecutor()
+  : m_tasks{}
+{}
+
+ManualExecutor::~ManualExecutor() = default;
+
+AnyFunctorExecutor ManualExecutor::GetExecutor()
+{
+  return [this](std::function<void()> task) {
+    m_tasks.push_back(std::move(task));
+  };
+}
+
+void ManualExecutor::RunAll()
+{
+  auto tasks = std::move(m_tasks);
+  m_tasks.clear();
+  for (auto& task : tasks)
+  {
+    task();
+  }
+}
+}  // unnamed namespace
@@ -0,0 +1,113 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/parse/anyvalue_buildnode.h>
+#include <sup/dto/parse/arrayvalue_buildnode.h>
+#include <sup/dto/parse/build_node_arena.h>
+
+#include <sup/dto/anytype_registry.h>
+#include <sup/dto/anyvalue.h>
+
+#include <cstdint>
+
+using namespace sup::dto;
+
+TEST(BuildNodeArenaTest, AllocationsAreAligned)
+{
+  BuildNodeArena arena;
+  for (std::size_t size = 1; size < 300; size += 7)
+  {
+    auto ptr = arena.Allocate(size);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignof(std::max_align_t), 0);
+  }
+  // Larger than the maximum block size
+  auto large_ptr = arena.Allocate(100000);
+  EXPECT_NE(large_ptr, nullptr);
+}
+
+TEST(BuildNodeArenaTest, ReleasedMemoryIsReused)
+{
+  BuildNodeArena arena;
+  auto first = arena.Allocate(48);
+  auto second = arena.Allocate(48);
+  EXPECT_NE(first, second);
+  arena.Deallocate(second, 48);
+  arena.Deallocate(first, 48);
+  EXPECT_EQ(arena.Allocate(48), first);
+  EXPECT_EQ(arena.Allocate(48), second);
+  // Different size is not served from the same free list
+  arena.Deallocate(first, 48);
+  EXPECT_NE(arena.Allocate(96), first);
+}
+
+TEST(BuildNodeArenaTest, ChildNodesUseParentArena)
+{
+  AnyTypeRegistry anytype_registry;
+  AnyValue struct_val = {{
+    {"inner", {
+      {"flag", {BooleanType, false}}
+    }},
+    {"numbers", AnyValue(AnyType(2, SignedInteger32Type))}
+  }};
+  BuildNodeArena arena;
+  AnyValueBuildNode node(&anytype_registry, nullptr, struct_val);
+  EXPECT_EQ(node.GetArena(), nullptr);
+  node.SetArena(&arena);
+
+  // Repeatedly creating and popping a child node reuses the same memory
+  EXPECT_TRUE(node.Member("inner"));
+  auto child = node.GetStructureNode();
+  ASSERT_NE(child, nullptr);
+  EXPECT_EQ(child->GetArena(), &arena);
+  EXPECT_TRUE(child->Member("flag"));
+  EXPECT_TRUE(child->Bool(true));
+  EXPECT_TRUE(node.PopStructureNode());
+  EXPECT_TRUE(node.Member("inner"));
+  EXPECT_EQ(node.GetStructureNode(), child);
+  EXPECT_TRUE(node.PopStructureNode());
+
+  EXPECT_TRUE(node.Member("numbers"));
+  auto array_child = node.GetArrayNode();
+  ASSERT_NE(array_child, nullptr);
+  EXPECT_EQ(array_child->GetArena(), &arena);
+  EXPECT_TRUE(array_child->Int32(-5));
+  EXPECT_TRUE(array_child->RawNumber("12", 2));
+  EXPECT_TRUE(node.PopArrayNode());
+
+  EXPECT_EQ(struct_val["inner.flag"], true);
+  EXPECT_EQ(struct_val["numbers"][0], -5);
+  EXPECT_EQ(struct_val["numbers"][1], 12);
+}
+
+TEST(BuildNodeArenaTest, HeapNodesWithoutArena)
+{
+  AnyTypeRegistry anytype_registry;
+  AnyValue array_val(AnyType(2, StringType));
+  auto node = CreateArrayBuildNode(&anytype_registry, nullptr, array_val);
+  EXPECT_EQ(node->GetArena(), nullptr);
+  EXPECT_TRUE(node->String("first"));
+  EXPECT_TRUE(node->String("second"));
+  node.reset();
+  EXPECT_EQ(array_val[1], "second");
+}
@@ -0,0 +1,282 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/low_level/byte_swap.h>
+#include <sup/dto/serialize/network_order_layout.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace sup::dto;
+
+namespace
+{
+AnyType RecordType();
+
+AnyValue RecordArray(std::size_t n_records);
+
+bool HostIsLittleEndian();
+}  // unnamed namespace
+
+TEST(ByteSwapTest, Runs)
+{
+  // Lengths cover the vector blocks and the scalar tails
+  for (std::size_t width : {2u, 4u, 8u})
+  {
+    for (std::size_t n = 0; n < 80; ++n)
+    {
+      std::vector<uint8> data(n * width);
+      for (std::size_t idx = 0; idx < data.size(); ++idx)
+      {
+        data[idx] = static_cast<uint8>(idx * 7 + 1);
+      }
+      auto expected = data;
+      for (std::size_t idx = 0; idx < n; ++idx)
+      {
+        std::reverse(expected.begin() + idx * width, expected.begin() + (idx + 1) * width);
+      }
+      ByteSwapRun(data.data(), n, width);
+      EXPECT_EQ(data, expected) << "width " << width << ", n " << n;
+    }
+  }
+  // Other widths leave the data untouched
+  std::vector<uint8> data{1, 2, 3, 4, 5, 6};
+  ByteSwapRun(data.data(), 2, 3);
+  EXPECT_EQ(data, std::vector<uint8>({1, 2, 3, 4, 5, 6}));
+}
+
+TEST(ByteSwapTest, Implementations)
+{
+  EXPECT_TRUE(IsByteSwapImplementationSupported(ByteSwapImplementation::kScalar));
+  EXPECT_TRUE(IsByteSwapImplementationSupported(GetByteSwapImplementation()));
+  if (IsByteSwapImplementationSupported(ByteSwapImplementation::kAVX2))
+  {
+    EXPECT_EQ(GetByteSwapImplementation(), ByteSwapImplementation::kAVX2);
+  }
+  // All implementations give the same result, also for unaligned data; unsupported ones fall back
+  // to the scalar loop
+  for (auto implementation : { ByteSwapImplementation::kScalar, ByteSwapImplementation::kSSSE3,
+                               ByteSwapImplementation::kAVX2 })
+  {
+    for (std::size_t width : {2u, 4u, 8u})
+    {
+      for (std::size_t n = 0; n < 80; ++n)
+      {
+        const std::size_t misalignment = n % 3;
+        std::vector<uint8> data(n * width + misalignment);
+        for (std::size_t idx = 0; idx < data.size(); ++idx)
+        {
+          data[idx] = static_cast<uint8>(idx * 13 + 5);
+        }
+        auto expected = data;
+        for (std::size_t idx = 0; idx < n; ++idx)
+        {
+          const auto first = expected.begin() + misalignment + idx * width;
+          std::reverse(first, first + width);
+        }
+        ByteSwapRun(data.data() + misalignment, n, width, implementation);
+        EXPECT_EQ(data, expected) << "implementation " << static_cast<int>(implementation)
+                                  << ", width " << width << ", n " << n;
+      }
+    }
+  }
+}
+
+TEST(ByteSwapTest, SingleValues)
+{
+  EXPECT_EQ(ByteSwap(uint8{0x12}), 0x12);
+  EXPECT_EQ(ByteSwap(uint16{0x1234}), 0x3412);
+  EXPECT_EQ(ByteSwap(uint32{0x12345678u}), 0x78563412u);
+  EXPECT_EQ(ByteSwap(uint64{0x0123456789ABCDEFull}), 0xEFCDAB8967452301ull);
+  EXPECT_EQ(ByteSwapValue(int16{0x0102}), 0x0201);
+  EXPECT_EQ(ByteSwapValue(ByteSwapValue(-1.5f)), -1.5f);
+  EXPECT_EQ(ByteSwapValue(ByteSwapValue(3.25)), 3.25);
+  float64 val = 3.25;
+  std::vector<uint8> run(sizeof(val));
+  std::memcpy(run.data(), &val, sizeof(val));
+  ByteSwapRun(run.data(), 1, sizeof(val));
+  val = ByteSwapValue(val);
+  EXPECT_EQ(std::memcmp(run.data(), &val, sizeof(val)), 0);
+}
+
+TEST(ByteSwapTest, NetworkOrderLayout)
+{
+  NetworkOrderLayout layout{RecordType()};
+  EXPECT_EQ(layout.GetType(), RecordType());
+  EXPECT_EQ(layout.GetSize(), 2 + 4 + 200 * 2 + kStringMaxLength + 8);
+  const auto& runs = layout.GetSwapRuns();
+  if (HostIsLittleEndian())
+  {
+    // The id and the flag are single bytes and the string is never swapped
+    ASSERT_EQ(runs.size(), 3);
+    EXPECT_EQ(runs[0].offset, 2);
+    EXPECT_EQ(runs[0].count, 1);
+    EXPECT_EQ(runs[0].width, 4);
+    EXPECT_EQ(runs[1].offset, 6);
+    EXPECT_EQ(runs[1].count, 200);
+    EXPECT_EQ(runs[1].width, 2);
+    EXPECT_EQ(runs[2].offset, 6 + 400 + kStringMaxLength);
+    EXPECT_EQ(runs[2].width, 8);
+  }
+  else
+  {
+    EXPECT_TRUE(runs.empty());
+  }
+  // Consecutive leaves of the same width are merged
+  NetworkOrderLayout array_layout{AnyType(10, AnyType{{
+    {"x", Float32Type},
+    {"y", SignedInteger32Type}
+  }})};
+  if (HostIsLittleEndian())
+  {
+    ASSERT_EQ(array_layout.GetSwapRuns().size(), 1);
+    EXPECT_EQ(array_layout.GetSwapRuns()[0].count, 20);
+  }
+  EXPECT_THROW(NetworkOrderLayout(AnyType(0, Float32Type)), InvalidOperationException);
+}
+
+TEST(ByteSwapTest, NetworkOrderBytes)
+{
+  const auto value = RecordArray(100);
+  const auto host_bytes = ToBytes(value);
+  const auto network_bytes = ToNetworkOrderBytes(value);
+  ASSERT_EQ(network_bytes.size(), host_bytes.size());
+  auto swapped = host_bytes;
+  GetNetworkOrderLayout(value.GetType())->SwapByteOrder(swapped.data());
+  EXPECT_EQ(swapped, network_bytes);
+  if (HostIsLittleEndian())
+  {
+    // The first 16-bit sample of the first record is stored big endian
+    EXPECT_EQ(network_bytes[6], 0);
+    EXPECT_EQ(network_bytes[7], 1);
+  }
+
+  AnyValue parsed{value.GetType()};
+  FromNetworkOrderBytes(parsed, network_bytes.data(), network_bytes.size());
+  EXPECT_EQ(parsed, value);
+  EXPECT_THROW(FromNetworkOrderBytes(parsed, network_bytes.data(), network_bytes.size() - 1),
+               ParseException);
+
+  auto too_long = value;
+  too_long[3]["name"] = std::string(kStringMaxLength, 'a');
+  EXPECT_THROW(ToNetworkOrderBytes(too_long), SerializeException);
+}
+
+TEST(ByteSwapTest, NetworkOrderRead)
+{
+  const auto value = RecordArray(10);
+  const auto network_bytes = ToNetworkOrderBytes(value);
+  const auto layout = GetNetworkOrderLayout(value);
+  ASSERT_NE(layout, nullptr);
+  EXPECT_EQ(layout, GetNetworkOrderLayout(value.GetType()));
+  const auto& leaves = layout->GetLeaves();
+  ASSERT_EQ(leaves.size(), 10 * 205);
+  EXPECT_EQ(leaves[2].offset, 2);
+  EXPECT_EQ(leaves[2].type_code, TypeCode::UInt32);
+  EXPECT_EQ(leaves[3].offset, 6);
+  EXPECT_EQ(leaves[3].width, 2);
+
+  // Reading swaps a copy of the input, which is left untouched
+  const auto input = network_bytes;
+  AnyValue parsed{value.GetType()};
+  layout->Read(parsed, network_bytes.data(), network_bytes.size());
+  EXPECT_EQ(parsed, value);
+  EXPECT_EQ(network_bytes, input);
+
+  // The buffer for the swapped copy can be reused
+  std::vector<uint8> buffer;
+  AnyValue reparsed{value.GetType()};
+  layout->Read(reparsed, network_bytes.data(), network_bytes.size(), buffer);
+  layout->Read(reparsed, network_bytes.data(), network_bytes.size(), buffer);
+  EXPECT_EQ(reparsed, value);
+  EXPECT_EQ(network_bytes, input);
+  if (!layout->GetSwapRuns().empty())
+  {
+    EXPECT_EQ(buffer.size(), network_bytes.size());
+  }
+
+  // Values that do not match the layout
+  AnyValue other{AnyType(10, AnyType{{{"id", UnsignedInteger8Type}}})};
+  EXPECT_THROW(layout->Read(other, network_bytes.data(), network_bytes.size()), ParseException);
+  AnyValue shorter{AnyType(9, RecordType())};
+  EXPECT_THROW(layout->Read(shorter, network_bytes.data(), network_bytes.size()), ParseException);
+
+  // Strings need to be zero-terminated
+  auto corrupted = network_bytes;
+  std::fill(corrupted.begin() + 406, corrupted.begin() + 406 + kStringMaxLength, 'x');
+  EXPECT_THROW(layout->Read(parsed, corrupted.data(), corrupted.size()), ParseException);
+
+  // Types with unbounded arrays have no layout
+  EXPECT_EQ(GetNetworkOrderLayout(AnyValue(0, RecordType())), nullptr);
+  AnyValue unbounded{{{"id", 1}, {"samples", AnyValue(0, Float32Type)}}};
+  EXPECT_EQ(GetNetworkOrderLayout(unbounded), nullptr);
+  AnyValue parsed_unbounded{unbounded.GetType()};
+  const auto unbounded_bytes = ToNetworkOrderBytes(unbounded);
+  FromNetworkOrderBytes(parsed_unbounded, unbounded_bytes.data(), unbounded_bytes.size());
+  EXPECT_EQ(parsed_unbounded, unbounded);
+}
+
+namespace
+{
+AnyType RecordType()
+{
+  return AnyType{{
+    {"id", UnsignedInteger8Type},
+    {"flag", BooleanType},
+    {"counter", UnsignedInteger32Type},
+    {"samples", AnyType(200, SignedInteger16Type)},
+    {"name", StringType},
+    {"value", Float64Type}
+  }, "record_t"};
+}
+
+AnyValue RecordArray(std::size_t n_records)
+{
+  AnyValue result{n_records, RecordType()};
+  for (std::size_t idx = 0; idx < n_records; ++idx)
+  {
+    auto& record = result[idx];
+    record["id"] = static_cast<uint8>(idx);
+    record["flag"] = (idx % 3 == 0);
+    record["counter"] = static_cast<uint32>(idx * 100000);
+    for (std::size_t i = 0; i < 200; ++i)
+    {
+      record["samples"][i] = static_cast<int16>(i + 1 - idx);
+    }
+    record["name"] = "record_" + std::to_string(idx);
+    record["value"] = -0.125 * idx;
+  }
+  return result;
+}
+
+bool HostIsLittleEndian()
+{
+  const uint16 val = 1;
+  return *reinterpret_cast<const uint8*>(&val) == 1;
+}
+}  // unnamed namespace
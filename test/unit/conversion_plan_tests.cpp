@@ -0,0 +1,363 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/anyvalue/conversion_plan.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include "allocation_counter.h"
+
+#include <string>
+
+using namespace sup::dto;
+
+namespace
+{
+AnyType SourceType();
+
+AnyType TargetType();
+
+AnyValue SourceValue();
+}
+
+TEST(ConversionPlanTest, LeafConversionKinds)
+{
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Int32, TypeCode::Int32),
+            LeafConversionKind::kIdentity);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::String, TypeCode::String),
+            LeafConversionKind::kIdentity);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Int64, TypeCode::Int32),
+            LeafConversionKind::kWidening);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Int32, TypeCode::UInt16),
+            LeafConversionKind::kWidening);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Float64, TypeCode::UInt64),
+            LeafConversionKind::kWidening);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Float64, TypeCode::Float32),
+            LeafConversionKind::kWidening);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Bool, TypeCode::Float64),
+            LeafConversionKind::kWidening);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Int8, TypeCode::Bool),
+            LeafConversionKind::kWidening);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Int32, TypeCode::Int64),
+            LeafConversionKind::kNarrowing);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Int32, TypeCode::UInt32),
+            LeafConversionKind::kNarrowing);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::UInt64, TypeCode::Int8),
+            LeafConversionKind::kNarrowing);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::UInt8, TypeCode::Float32),
+            LeafConversionKind::kNarrowing);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Float32, TypeCode::Float64),
+            LeafConversionKind::kNarrowing);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::String, TypeCode::Int32),
+            LeafConversionKind::kUnsupported);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Float32, TypeCode::String),
+            LeafConversionKind::kUnsupported);
+  EXPECT_EQ(GetLeafConversionKind(TypeCode::Struct, TypeCode::Int32),
+            LeafConversionKind::kUnsupported);
+}
+
+TEST(ConversionPlanTest, Steps)
+{
+  ConversionPlan plan{TargetType(), SourceType()};
+  ASSERT_TRUE(plan.IsValid());
+  EXPECT_EQ(plan.GetDestinationType(), TargetType());
+  EXPECT_EQ(plan.GetSourceType(), SourceType());
+  const auto& steps = plan.GetSteps();
+  // struct, id, name, array, element, flag
+  ASSERT_EQ(steps.size(), 6);
+  EXPECT_EQ(steps[0].opcode, ConversionOpcode::kStruct);
+  EXPECT_EQ(steps[0].count, 4);
+  EXPECT_EQ(steps[0].end, 6);
+  EXPECT_EQ(steps[1].opcode, ConversionOpcode::kScalar);
+  EXPECT_EQ(steps[1].kind, LeafConversionKind::kWidening);
+  EXPECT_EQ(steps[2].kind, LeafConversionKind::kIdentity);
+  EXPECT_EQ(steps[3].opcode, ConversionOpcode::kArray);
+  EXPECT_EQ(steps[3].count, 0);
+  EXPECT_EQ(steps[3].end, 5);
+  EXPECT_EQ(steps[4].kind, LeafConversionKind::kNarrowing);
+  EXPECT_EQ(steps[5].kind, LeafConversionKind::kWidening);
+}
+
+TEST(ConversionPlanTest, Execute)
+{
+  const auto source = SourceValue();
+  ConversionPlan plan{TargetType(), SourceType()};
+  AnyValue target{TargetType()};
+  plan.Execute(target, source);
+  EXPECT_EQ(target["id"], 42);
+  EXPECT_EQ(target["name"], "source");
+  EXPECT_EQ(target["samples[99]"], 99);
+  EXPECT_EQ(target["flag"], 1.0f);
+
+  // Same result as the conversion through ConvertFrom
+  AnyValue converted{TargetType()};
+  converted.ConvertFrom(source);
+  EXPECT_EQ(converted, target);
+
+  // Narrowing conversion that fails
+  auto out_of_range = source;
+  out_of_range["samples[50]"] = 1000;
+  EXPECT_THROW(plan.Execute(target, out_of_range), InvalidConversionException);
+  EXPECT_THROW(converted.ConvertFrom(out_of_range), InvalidConversionException);
+}
+
+TEST(ConversionPlanTest, ArithmeticArrays)
+{
+  const std::size_t n_elements = 1000;
+  AnyValue source{AnyType(n_elements, SignedInteger16Type)};
+  for (std::size_t idx = 0; idx < n_elements; ++idx)
+  {
+    source[idx] = static_cast<int16>(static_cast<int>(idx) - 500);
+  }
+  AnyValue widened{AnyType(n_elements, Float64Type)};
+  widened.ConvertFrom(source);
+  EXPECT_EQ(widened[0], -500.0);
+  EXPECT_EQ(widened[999], 499.0);
+  EXPECT_EQ(AnyValue(AnyType(n_elements, Float64Type), source), widened);
+
+  // Narrowing reports the first element that doesn't fit
+  AnyValue narrowed{AnyType(n_elements, SignedInteger8Type)};
+  try
+  {
+    narrowed.ConvertFrom(source);
+    FAIL() << "Conversion should fail";
+  }
+  catch(const InvalidConversionException& e)
+  {
+    EXPECT_NE(std::string(e.what()).find("array element 0"), std::string::npos);
+  }
+  for (std::size_t idx = 0; idx < n_elements; ++idx)
+  {
+    source[idx] = static_cast<int16>(idx % 100);
+  }
+  source[777] = int16{-1};
+  AnyValue unsigned_target{AnyType(n_elements, UnsignedInteger8Type)};
+  try
+  {
+    unsigned_target.ConvertFrom(source);
+    FAIL() << "Conversion should fail";
+  }
+  catch(const InvalidConversionException& e)
+  {
+    EXPECT_NE(std::string(e.what()).find("array element 777"), std::string::npos);
+  }
+  EXPECT_EQ(unsigned_target[776], 76u);
+  source[777] = int16{77};
+  EXPECT_NO_THROW(unsigned_target.ConvertFrom(source));
+  EXPECT_EQ(unsigned_target[777], 77u);
+
+  // Arrays of structures with arithmetic arrays
+  AnyValue nested{AnyType(2, AnyType{{{"data", source.GetType()}}})};
+  nested[1]["data"] = source;
+  AnyValue nested_target{AnyType(2, AnyType{{{"data", AnyType(n_elements, Float32Type)}}})};
+  nested_target.ConvertFrom(nested);
+  EXPECT_EQ(nested_target["[1].data[999]"], 99.0f);
+}
+
+TEST(ConversionPlanTest, InvalidPlans)
+{
+  {
+    // Different member names
+    AnyType other_type{{{"id", SignedInteger32Type}, {"other", StringType}}};
+    ConversionPlan plan{TargetType(), other_type};
+    EXPECT_FALSE(plan.IsValid());
+    EXPECT_TRUE(plan.GetSteps().empty());
+    AnyValue target{TargetType()};
+    EXPECT_THROW(plan.Execute(target, AnyValue{other_type}), InvalidConversionException);
+    EXPECT_EQ(target, AnyValue{TargetType()});
+  }
+  {
+    // Different array length is only detected on execution
+    ConversionPlan plan{AnyType(3, Float32Type), AnyType(4, Float32Type)};
+    EXPECT_TRUE(plan.IsValid());
+    AnyValue target{AnyType(3, Float32Type)};
+    EXPECT_THROW(plan.Execute(target, AnyValue{AnyType(4, Float32Type)}),
+                 InvalidConversionException);
+    EXPECT_THROW(target.ConvertFrom(AnyValue{AnyType(4, Float32Type)}),
+                 InvalidConversionException);
+    EXPECT_THROW(target.ConvertFrom(AnyValue{AnyType(0, Float32Type)}),
+                 InvalidConversionException);
+  }
+  {
+    // String to arithmetic
+    ConversionPlan plan{AnyType{{{"x", Float32Type}}}, AnyType{{{"x", StringType}}}};
+    EXPECT_FALSE(plan.IsValid());
+  }
+  {
+    // Structure to scalar and empty to array
+    EXPECT_FALSE(ConversionPlan(Float32Type, TargetType()).IsValid());
+    EXPECT_FALSE(ConversionPlan(AnyType(3, Float32Type), EmptyType).IsValid());
+  }
+  {
+    // Element types of empty arrays are not checked
+    ConversionPlan plan{AnyType(0, Float32Type), AnyType(0, StringType)};
+    EXPECT_TRUE(plan.IsValid());
+  }
+}
+
+TEST(ConversionPlanTest, Cache)
+{
+  auto plan = GetConversionPlan(TargetType(), SourceType());
+  EXPECT_EQ(GetConversionPlan(TargetType(), SourceType()), plan);
+  EXPECT_NE(GetConversionPlan(SourceType(), TargetType()), plan);
+  EXPECT_NE(GetConversionPlan(SourceType(), SourceType()), plan);
+}
+
+TEST(ConversionPlanTest, ValueLookup)
+{
+  const auto source = SourceValue();
+  AnyValue target{TargetType()};
+  const auto plan = GetConversionPlan(target, source);
+  EXPECT_TRUE(plan->Matches(target, source));
+  EXPECT_FALSE(plan->Matches(source, target));
+  EXPECT_EQ(GetConversionPlan(TargetType(), SourceType()), plan);
+  EXPECT_EQ(GetConversionPlan(target, source), plan);
+
+  // Plans are shared between types that only differ in type names and array lengths
+  AnyType renamed_type{{
+    {"id", SignedInteger16Type},
+    {"name", StringType},
+    {"samples", AnyType(5, SignedInteger32Type, "samples_t")},
+    {"flag", BooleanType}
+  }, "other_source_t"};
+  AnyValue renamed{renamed_type};
+  AnyType short_target_type{{
+    {"id", SignedInteger64Type},
+    {"name", StringType},
+    {"samples", AnyType(5, SignedInteger8Type)},
+    {"flag", Float32Type}
+  }};
+  AnyValue short_target{short_target_type};
+  EXPECT_TRUE(plan->Matches(short_target, renamed));
+  EXPECT_EQ(GetConversionPlan(short_target, renamed), plan);
+  renamed["samples[4]"] = int32{4};
+  plan->Execute(short_target, renamed);
+  EXPECT_EQ(short_target["samples[4]"], 4);
+
+  // But not between arrays with and without elements
+  AnyType empty_samples_type{{
+    {"id", SignedInteger16Type},
+    {"name", StringType},
+    {"samples", AnyType(0, SignedInteger32Type)},
+    {"flag", BooleanType}
+  }};
+  AnyValue empty_samples{empty_samples_type};
+  EXPECT_FALSE(plan->Matches(target, empty_samples));
+  EXPECT_NE(GetConversionPlan(target, empty_samples), plan);
+  EXPECT_THROW(target.ConvertFrom(empty_samples), InvalidConversionException);
+
+  // A held plan can be executed for all matching values
+  AnyValue other_target{TargetType()};
+  ASSERT_TRUE(plan->Matches(other_target, source));
+  plan->Execute(other_target, source);
+  EXPECT_EQ(other_target["samples[99]"], 99);
+}
+
+TEST(ConversionPlanTest, NoTypeConstructionOnLookup)
+{
+  const auto source = SourceValue();
+  AnyValue target{TargetType()};
+  const auto plan = GetConversionPlan(target, source);
+  AllocationCounter allocations;
+  EXPECT_EQ(GetConversionPlan(target, source), plan);
+  EXPECT_EQ(allocations.GetCount(), 0u);
+}
+
+TEST(ConversionPlanTest, IdenticalTypes)
+{
+  const auto source = SourceValue();
+  EXPECT_TRUE(ConversionPlan::HaveIdenticalTypes(source, AnyValue{SourceType()}));
+  EXPECT_FALSE(ConversionPlan::HaveIdenticalTypes(source, AnyValue{TargetType()}));
+  EXPECT_TRUE(ConversionPlan::HaveIdenticalTypes(AnyValue{}, AnyValue{}));
+  EXPECT_FALSE(ConversionPlan::HaveIdenticalTypes(AnyValue{int8{1}}, AnyValue{uint8{1}}));
+  EXPECT_FALSE(ConversionPlan::HaveIdenticalTypes(AnyValue{int8{1}}, AnyValue{}));
+  EXPECT_FALSE(ConversionPlan::HaveIdenticalTypes(AnyValue(2, StringType),
+                                                  AnyValue(3, StringType)));
+  EXPECT_FALSE(ConversionPlan::HaveIdenticalTypes(AnyValue(2, StringType, "names_t"),
+                                                  AnyValue(2, StringType)));
+  EXPECT_TRUE(ConversionPlan::HaveIdenticalTypes(AnyValue(0, StringType),
+                                                 AnyValue(0, StringType)));
+  EXPECT_FALSE(ConversionPlan::HaveIdenticalTypes(AnyValue(0, StringType),
+                                                  AnyValue(0, Float32Type)));
+  EXPECT_FALSE(ConversionPlan::HaveIdenticalTypes(AnyValue{{{"a", 1}}}, AnyValue{{{"b", 1}}}));
+  EXPECT_FALSE(ConversionPlan::HaveIdenticalTypes(AnyValue{{{"a", 1}}},
+                                                  AnyValue{{{"a", 1}, {"b", 1}}}));
+
+  AnyValue target{SourceType()};
+  ConversionPlan::CopyIdenticalValue(target, source);
+  EXPECT_EQ(target, source);
+}
+
+TEST(ConversionPlanTest, ScalarValues)
+{
+  AnyValue target{SignedInteger16Type};
+  ConversionPlan::ConvertScalarValue(target, AnyValue{uint8{200}});
+  EXPECT_EQ(target, 200);
+  EXPECT_THROW(ConversionPlan::ConvertScalarValue(target, AnyValue{int32{40000}}),
+               InvalidConversionException);
+  EXPECT_THROW(ConversionPlan::ConvertScalarValue(target, AnyValue{"text"}),
+               InvalidConversionException);
+  EXPECT_EQ(target, 200);
+
+  AnyValue string_target{std::string(100, 'x')};
+  ConversionPlan::ConvertScalarValue(string_target, AnyValue{"short"});
+  EXPECT_EQ(string_target, "short");
+}
+
+namespace
+{
+AnyType SourceType()
+{
+  return AnyType{{
+    {"id", SignedInteger16Type},
+    {"name", StringType},
+    {"samples", AnyType(100, SignedInteger32Type)},
+    {"flag", BooleanType}
+  }, "source_t"};
+}
+
+AnyType TargetType()
+{
+  return AnyType{{
+    {"id", SignedInteger64Type},
+    {"name", StringType},
+    {"samples", AnyType(100, SignedInteger8Type)},
+    {"flag", Float32Type}
+  }, "target_t"};
+}
+
+AnyValue SourceValue()
+{
+  AnyValue result{SourceType()};
+  result["id"] = int16{42};
+  result["name"] = "source";
+  for (int32 idx = 0; idx < 100; ++idx)
+  {
+    result["samples"][idx] = idx;
+  }
+  result["flag"] = true;
+  return result;
+}
+}
@@ -0,0 +1,217 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/ctype_layout.h>
+
+#include <cstddef>
+#include <cstring>
+
+using namespace sup::dto;
+
+namespace
+{
+struct Limits
+{
+  int8 low;
+  int32 high;
+};
+
+struct Record
+{
+  uint8 flag;
+  float64 value;
+  uint16 counts[3];
+  Limits limits[2];
+  char name[kStringMaxLength];
+  boolean enabled;
+};
+
+#pragma pack(push, 2)
+struct PackedRecord
+{
+  uint8 flag;
+  float64 value;
+  uint16 counts[3];
+};
+#pragma pack(pop)
+
+AnyType RecordType();
+
+AnyValue RecordValue();
+}  // unnamed namespace
+
+TEST(CLayoutTest, NaturalLayout)
+{
+  CLayout layout{RecordType()};
+  EXPECT_EQ(layout.GetType(), RecordType());
+  EXPECT_EQ(layout.GetPack(), 0);
+  EXPECT_EQ(layout.GetSize(), sizeof(Record));
+  EXPECT_EQ(layout.GetAlignment(), alignof(Record));
+
+  CLayout limits_layout{RecordType()["limits"].ElementType()};
+  EXPECT_EQ(limits_layout.GetSize(), sizeof(Limits));
+  EXPECT_EQ(limits_layout.GetAlignment(), alignof(Limits));
+
+  CLayout scalar_layout{Float64Type};
+  EXPECT_EQ(scalar_layout.GetSize(), sizeof(float64));
+  CLayout empty_layout{EmptyType};
+  EXPECT_EQ(empty_layout.GetSize(), 0);
+  EXPECT_EQ(empty_layout.GetAlignment(), 1);
+}
+
+TEST(CLayoutTest, WriteAndRead)
+{
+  CLayout layout{RecordType()};
+  const auto value = RecordValue();
+  auto record = ToCType<Record>(value, layout);
+  EXPECT_EQ(record.flag, 7);
+  EXPECT_EQ(record.value, 2.5);
+  EXPECT_EQ(record.counts[0], 10);
+  EXPECT_EQ(record.counts[2], 30);
+  EXPECT_EQ(record.limits[0].low, -1);
+  EXPECT_EQ(record.limits[1].high, 2000);
+  EXPECT_STREQ(record.name, "record");
+  EXPECT_TRUE(record.enabled);
+
+  record.value = -4.0;
+  record.counts[1] = 99;
+  record.limits[1].low = -100;
+  (void)std::strcpy(record.name, "changed");
+  AnyValue result{RecordType()};
+  AssignFromCType(result, record, layout);
+  EXPECT_EQ(result["value"], -4.0);
+  EXPECT_EQ(result["counts[1]"], 99);
+  EXPECT_EQ(result["limits[1].low"], -100);
+  EXPECT_EQ(result["name"], "changed");
+  EXPECT_EQ(result["flag"], 7);
+
+  // Round trip
+  EXPECT_EQ(ToCType<Record>(result, layout).limits[1].low, -100);
+  AnyValue copy{RecordType()};
+  AssignFromCType(copy, ToCType<Record>(value, layout), layout);
+  EXPECT_EQ(copy, value);
+}
+
+TEST(CLayoutTest, PackedLayouts)
+{
+  AnyType packed_type{{
+    {"flag", UnsignedInteger8Type},
+    {"value", Float64Type},
+    {"counts", AnyType(3, UnsignedInteger16Type)}
+  }};
+  CLayout layout{packed_type, 2};
+  EXPECT_EQ(layout.GetPack(), 2);
+  EXPECT_EQ(layout.GetSize(), sizeof(PackedRecord));
+  EXPECT_EQ(layout.GetAlignment(), alignof(PackedRecord));
+  AnyValue value{packed_type};
+  value["flag"] = uint8{3};
+  value["value"] = 1.25;
+  value["counts[2]"] = uint16{12};
+  auto packed_record = ToCType<PackedRecord>(value, layout);
+  EXPECT_EQ(packed_record.flag, 3);
+  EXPECT_EQ(packed_record.value, 1.25);
+  EXPECT_EQ(packed_record.counts[2], 12);
+
+  // Pack value of one corresponds to the byte representation of ToBytes
+  const auto record_value = RecordValue();
+  CLayout byte_layout{RecordType(), 1};
+  const auto bytes = ToBytes(record_value);
+  ASSERT_EQ(byte_layout.GetSize(), bytes.size());
+  std::vector<uint8> layout_bytes(byte_layout.GetSize(), 0);
+  byte_layout.Write(record_value, layout_bytes.data(), layout_bytes.size());
+  EXPECT_EQ(layout_bytes, bytes);
+  AnyValue parsed{RecordType()};
+  byte_layout.Read(parsed, bytes.data(), bytes.size());
+  EXPECT_EQ(parsed, record_value);
+
+  EXPECT_THROW(CLayout(packed_type, 3), InvalidOperationException);
+}
+
+TEST(CLayoutTest, Failures)
+{
+  CLayout layout{RecordType()};
+  auto value = RecordValue();
+  Record record{};
+  // Size mismatch
+  EXPECT_THROW(layout.Write(value, &record, sizeof(Record) - 1), SerializeException);
+  EXPECT_THROW(layout.Read(value, &record, sizeof(Record) + 1), ParseException);
+  EXPECT_THROW(ToCType<PackedRecord>(value, layout), SerializeException);
+
+  // Structure mismatch
+  AnyValue other{{
+    {"flag", UnsignedInteger8Type},
+    {"value", Float32Type}
+  }};
+  std::vector<uint8> buffer(layout.GetSize(), 0);
+  EXPECT_THROW(layout.Write(other, buffer.data(), buffer.size()), SerializeException);
+  EXPECT_THROW(layout.Read(other, buffer.data(), buffer.size()), ParseException);
+  CLayout array_layout{AnyType(3, SignedInteger32Type)};
+  AnyValue short_array{AnyType(2, SignedInteger32Type)};
+  EXPECT_THROW(array_layout.Write(short_array, buffer.data(), array_layout.GetSize()),
+               SerializeException);
+
+  // String too long or not zero-terminated
+  value["name"] = std::string(kStringMaxLength, 'a');
+  EXPECT_THROW(ToCType<Record>(value, layout), SerializeException);
+  (void)std::memset(record.name, 'a', kStringMaxLength);
+  EXPECT_THROW(AssignFromCType(value, record, layout), ParseException);
+}
+
+namespace
+{
+AnyType RecordType()
+{
+  AnyType limits_type{{
+    {"low", SignedInteger8Type},
+    {"high", SignedInteger32Type}
+  }, "limits_t"};
+  return AnyType{{
+    {"flag", UnsignedInteger8Type},
+    {"value", Float64Type},
+    {"counts", AnyType(3, UnsignedInteger16Type)},
+    {"limits", AnyType(2, limits_type)},
+    {"name", StringType},
+    {"enabled", BooleanType}
+  }, "record_t"};
+}
+
+AnyValue RecordValue()
+{
+  AnyValue result{RecordType()};
+  result["flag"] = uint8{7};
+  result["value"] = 2.5;
+  result["counts[0]"] = uint16{10};
+  result["counts[1]"] = uint16{20};
+  result["counts[2]"] = uint16{30};
+  result["limits[0].low"] = int8{-1};
+  result["limits[0].high"] = int32{1000};
+  result["limits[1].low"] = int8{-2};
+  result["limits[1].high"] = int32{2000};
+  result["name"] = "record";
+  result["enabled"] = true;
+  return result;
+}
+}  // unnamed namespace
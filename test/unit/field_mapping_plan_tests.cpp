@@ -0,0 +1,232 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/anyvalue/field_mapping_plan.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_helper.h>
+
+using namespace sup::dto;
+
+namespace
+{
+AnyType MessageType();
+
+AnyValue Message(uint16 id);
+}
+
+TEST(FieldMappingPlanTest, AllowExtraSourceFields)
+{
+  const AnyType target_type{{
+    {"payload", {
+      {"samples", AnyType(3, Float64Type)}
+    }},
+    {"id", UnsignedInteger64Type}
+  }, "target_t"};
+  FieldMappingPlan plan{MessageType(), target_type, FieldMappingMode::kAllowExtraSourceFields};
+  ASSERT_TRUE(plan.IsValid());
+  EXPECT_EQ(plan.GetResultType(), target_type);
+  const auto& steps = plan.GetSteps();
+  // struct, payload, samples, id
+  ASSERT_EQ(steps.size(), 4);
+  EXPECT_EQ(steps[0].opcode, FieldMappingOpcode::kStruct);
+  EXPECT_EQ(steps[0].count, 2);
+  EXPECT_EQ(steps[0].end, 4);
+  EXPECT_EQ(steps[1].opcode, FieldMappingOpcode::kStruct);
+  EXPECT_EQ(steps[1].src_index, 2);
+  EXPECT_EQ(steps[2].opcode, FieldMappingOpcode::kConvert);
+  EXPECT_EQ(steps[2].src_index, 1);
+  EXPECT_EQ(steps[3].src_index, 0);
+
+  const auto message = Message(12);
+  AnyValue result{plan.GetResultType()};
+  plan.Execute(result, message);
+  EXPECT_EQ(result["id"], 12u);
+  EXPECT_EQ(result["payload.samples[2]"], 6.0);
+
+  // Missing source field
+  const AnyType extended_type{{{"id", UnsignedInteger64Type}, {"missing", BooleanType}}};
+  FieldMappingPlan invalid_plan{MessageType(), extended_type,
+                                FieldMappingMode::kAllowExtraSourceFields};
+  EXPECT_FALSE(invalid_plan.IsValid());
+  AnyValue invalid_result{extended_type};
+  EXPECT_THROW(invalid_plan.Execute(invalid_result, message), InvalidConversionException);
+}
+
+TEST(FieldMappingPlanTest, AllowExtraTargetFields)
+{
+  const AnyType target_type{{
+    {"extra", StringType},
+    {"id", SignedInteger32Type},
+    {"name", StringType},
+    {"payload", {
+      {"flag", BooleanType},
+      {"samples", AnyType(3, Float32Type)},
+      {"count", UnsignedInteger8Type}
+    }}
+  }, "target_t"};
+  FieldMappingPlan plan{MessageType(), target_type, FieldMappingMode::kAllowExtraTargetFields};
+  ASSERT_TRUE(plan.IsValid());
+  const AnyType expected_type{{
+    {"id", SignedInteger32Type},
+    {"name", StringType},
+    {"payload", {
+      {"count", UnsignedInteger8Type},
+      {"samples", AnyType(3, Float32Type)}
+    }}
+  }, "target_t"};
+  EXPECT_EQ(plan.GetResultType(), expected_type);
+  ASSERT_EQ(plan.GetSteps().size(), 1);
+  EXPECT_EQ(plan.GetSteps()[0].opcode, FieldMappingOpcode::kConvert);
+
+  AnyValue result{plan.GetResultType()};
+  plan.Execute(result, Message(7));
+  EXPECT_EQ(result["id"], 7);
+  EXPECT_EQ(result["payload.count"], 3u);
+  EXPECT_EQ(result["payload.samples[1]"], 3.5f);
+
+  // Narrowing failure at execution time
+  auto message = Message(7);
+  message["payload.count"] = uint32{1000};
+  EXPECT_THROW(plan.Execute(result, message), InvalidConversionException);
+  EXPECT_FALSE(TryConvertAllowExtraTargetFields(message, target_type).first);
+
+  // Source field that is missing in the target
+  const AnyType narrow_type{{{"id", SignedInteger32Type}}};
+  EXPECT_FALSE(FieldMappingPlan(MessageType(), narrow_type,
+                                FieldMappingMode::kAllowExtraTargetFields).IsValid());
+}
+
+TEST(FieldMappingPlanTest, Matches)
+{
+  FieldMappingPlan plan{MessageType(), MessageType(), FieldMappingMode::kAllowExtraSourceFields};
+  EXPECT_TRUE(plan.Matches(Message(1)));
+
+  // Type names are not relevant for the mapping
+  const AnyType renamed_type{{
+    {"id", UnsignedInteger16Type},
+    {"name", StringType},
+    {"payload", AnyType{{
+      {"count", UnsignedInteger32Type},
+      {"samples", AnyType(3, Float64Type)}
+    }, "other_payload_t"}}
+  }, "other_t"};
+  EXPECT_TRUE(plan.Matches(AnyValue{renamed_type}));
+
+  const AnyType reordered_type{{
+    {"name", StringType},
+    {"id", UnsignedInteger16Type},
+    {"payload", MessageType()["payload"]}
+  }};
+  EXPECT_FALSE(plan.Matches(AnyValue{reordered_type}));
+  EXPECT_FALSE(plan.Matches(AnyValue{uint16{1}}));
+  auto resized = Message(1);
+  resized["payload"].AddMember("extra", 1);
+  EXPECT_FALSE(plan.Matches(resized));
+}
+
+TEST(FieldMappingPlanTest, Cache)
+{
+  const AnyType target_type{{{"id", UnsignedInteger64Type}}};
+  const auto plan = GetFieldMappingPlan(Message(1), target_type,
+                                        FieldMappingMode::kAllowExtraSourceFields);
+  EXPECT_EQ(GetFieldMappingPlan(Message(2), target_type,
+                                FieldMappingMode::kAllowExtraSourceFields), plan);
+  EXPECT_NE(GetFieldMappingPlan(Message(2), target_type,
+                                FieldMappingMode::kAllowExtraTargetFields), plan);
+  EXPECT_NE(GetFieldMappingPlan(Message(2), MessageType(),
+                                FieldMappingMode::kAllowExtraSourceFields), plan);
+  EXPECT_NE(GetFieldMappingPlan(AnyValue{{{"id", 1}}}, target_type,
+                                FieldMappingMode::kAllowExtraSourceFields), plan);
+
+  // Target types that only differ in type names or in element types of empty arrays need their
+  // own plan, since the result type is taken from the target
+  const AnyType named_target{{{"id", UnsignedInteger64Type}}, "named_t"};
+  const auto named_plan = GetFieldMappingPlan(Message(2), named_target,
+                                              FieldMappingMode::kAllowExtraSourceFields);
+  EXPECT_NE(named_plan, plan);
+  EXPECT_EQ(named_plan->GetResultType(), named_target);
+  const AnyType empty_target{{{"id", UnsignedInteger64Type}, {"extra", AnyType(0, SignedInteger8Type)}}};
+  const AnyType other_empty_target{{{"id", UnsignedInteger64Type},
+                                    {"extra", AnyType(0, Float32Type)}}};
+  const auto empty_plan = GetFieldMappingPlan(Message(2), empty_target,
+                                              FieldMappingMode::kAllowExtraTargetFields);
+  EXPECT_NE(GetFieldMappingPlan(Message(2), other_empty_target,
+                                FieldMappingMode::kAllowExtraTargetFields), empty_plan);
+  EXPECT_EQ(GetFieldMappingPlan(Message(3), AnyType{empty_target},
+                                FieldMappingMode::kAllowExtraTargetFields), empty_plan);
+
+  // Repeated conversions through the public helpers
+  for (uint16 id = 0; id < 10; ++id)
+  {
+    auto result = TryConvertAllowExtraSourceFields(Message(id), target_type);
+    ASSERT_TRUE(result.first);
+    EXPECT_EQ(result.second["id"], static_cast<uint64>(id));
+  }
+}
+
+TEST(FieldMappingPlanTest, CacheEviction)
+{
+  // A plan that keeps being used is not evicted by many other plans
+  const AnyType target_type{{{"id", UnsignedInteger64Type}}};
+  const auto plan = GetFieldMappingPlan(Message(1), target_type,
+                                        FieldMappingMode::kAllowExtraSourceFields);
+  for (std::size_t n_elements = 1; n_elements < 1000; ++n_elements)
+  {
+    AnyValue other{{{"id", 1}, {"samples", AnyValue(n_elements, Float32Type)}}};
+    (void)GetFieldMappingPlan(other, target_type, FieldMappingMode::kAllowExtraSourceFields);
+    ASSERT_EQ(GetFieldMappingPlan(Message(2), target_type,
+                                  FieldMappingMode::kAllowExtraSourceFields), plan);
+  }
+}
+
+namespace
+{
+AnyType MessageType()
+{
+  return AnyType{{
+    {"id", UnsignedInteger16Type},
+    {"name", StringType},
+    {"payload", AnyType{{
+      {"count", UnsignedInteger32Type},
+      {"samples", AnyType(3, Float64Type)}
+    }, "payload_t"}}
+  }, "message_t"};
+}
+
+AnyValue Message(uint16 id)
+{
+  AnyValue result{MessageType()};
+  result["id"] = id;
+  result["name"] = "message";
+  result["payload.count"] = 3u;
+  for (uint32 idx = 0; idx < 3; ++idx)
+  {
+    result["payload.samples"][idx] = 2.5 + idx;
+  }
+  result["payload.samples[2]"] = 0.5 * id;
+  return result;
+}
+}
@@ -0,0 +1,278 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/anytype_helper.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_helper.h>
+#include <sup/dto/anyvalue_operations.h>
+#include <sup/dto/ctype_layout.h>
+#include <sup/dto/fixed_string.h>
+#include <sup/dto/json_type_parser.h>
+#include <sup/dto/json_value_parser.h>
+#include <sup/dto/struct_binding.h>
+
+#include <cstring>
+#include <type_traits>
+
+namespace fixedstringtest
+{
+struct Channel
+{
+  sup::dto::uint16 id;
+  sup::dto::FixedString<12> name;
+  sup::dto::float32 value;
+};
+}  // namespace fixedstringtest
+
+SUP_DTO_STRUCT_BINDING(fixedstringtest::Channel, "channel_t",
+                       SUP_DTO_MEMBER(id),
+                       SUP_DTO_MEMBER(name),
+                       SUP_DTO_MEMBER(value))
+
+using namespace sup::dto;
+using fixedstringtest::Channel;
+
+namespace
+{
+AnyType ChannelType();
+
+AnyValue ChannelValue(uint16 id, const std::string& name, float32 value);
+}  // unnamed namespace
+
+TEST(FixedStringTest, Type)
+{
+  const auto anytype = FixedStringType(16);
+  EXPECT_EQ(anytype.GetTypeCode(), TypeCode::FixedString);
+  EXPECT_EQ(anytype.GetTypeName(), kFixedStringTypeName);
+  EXPECT_EQ(anytype.StringCapacity(), 16);
+  EXPECT_TRUE(IsScalarType(anytype));
+
+  // Appending the type code keeps the public values of the existing type codes
+  EXPECT_EQ(static_cast<uint32>(TypeCode::String), 13u);
+  EXPECT_EQ(static_cast<uint32>(TypeCode::Struct), 14u);
+  EXPECT_EQ(static_cast<uint32>(TypeCode::Array), 15u);
+  EXPECT_EQ(static_cast<uint32>(TypeCode::FixedString), 16u);
+  EXPECT_EQ(anytype, FixedStringType(16));
+  EXPECT_NE(anytype, FixedStringType(8));
+  EXPECT_NE(anytype, StringType);
+  EXPECT_EQ(StringType.StringCapacity(), 0);
+  EXPECT_EQ(AnyType{anytype}, anytype);
+
+  EXPECT_THROW(FixedStringType(0), InvalidOperationException);
+  EXPECT_THROW(AnyType{TypeCode::FixedString}, InvalidOperationException);
+}
+
+TEST(FixedStringTest, Value)
+{
+  AnyValue value{FixedStringType(8)};
+  EXPECT_EQ(value.GetTypeCode(), TypeCode::FixedString);
+  EXPECT_EQ(value.GetTypeName(), kFixedStringTypeName);
+  EXPECT_EQ(value.StringCapacity(), 8);
+  EXPECT_EQ(value.GetType(), FixedStringType(8));
+  EXPECT_EQ(value.As<std::string>(), "");
+
+  value.ConvertFrom("status");
+  EXPECT_EQ(value.As<std::string>(), "status");
+  EXPECT_EQ(value, AnyValue{"status"});
+  EXPECT_EQ(value.GetType(), FixedStringType(8));
+
+  // Seven characters and the terminating null character fill the capacity
+  value.ConvertFrom("1234567");
+  EXPECT_EQ(value, "1234567");
+  EXPECT_THROW(value.ConvertFrom("12345678"), InvalidConversionException);
+  EXPECT_EQ(value, "1234567");
+  value.ConvertFrom("ok");
+  EXPECT_EQ(value, "ok");
+
+  // Copies keep the capacity
+  AnyValue copy{value};
+  EXPECT_EQ(copy.GetType(), FixedStringType(8));
+  EXPECT_EQ(copy, value);
+  AnyValue other{FixedStringType(8)};
+  other = value;
+  EXPECT_EQ(other, value);
+  EXPECT_EQ(other.GetType(), FixedStringType(8));
+  EXPECT_EQ(AnyValue{FixedStringType(4)}, AnyValue{FixedStringType(8)});
+
+  // Arithmetic conversions are not supported
+  EXPECT_THROW(value.As<int32>(), InvalidConversionException);
+  EXPECT_THROW(value.ConvertFrom(AnyValue{42}), InvalidConversionException);
+  EXPECT_FALSE(Increment(value));
+}
+
+TEST(FixedStringTest, ArrayConversions)
+{
+  AnyValue fixed_array{AnyType(3, FixedStringType(6))};
+  AnyValue string_array{AnyType(3, StringType)};
+  string_array[0] = "one";
+  string_array[2] = "three";
+  fixed_array.ConvertFrom(string_array);
+  EXPECT_EQ(fixed_array[0], "one");
+  EXPECT_EQ(fixed_array[2], "three");
+  EXPECT_EQ(fixed_array[0].GetType(), FixedStringType(6));
+
+  // Array elements keep their type on assignment
+  fixed_array[1] = "two";
+  EXPECT_EQ(fixed_array[1].GetType(), FixedStringType(6));
+  EXPECT_THROW(fixed_array[1] = "too long", InvalidConversionException);
+
+  AnyValue back{AnyType(3, StringType)};
+  back.ConvertFrom(fixed_array);
+  EXPECT_EQ(back[1], "two");
+
+  AnyValue narrow{AnyType(3, FixedStringType(5))};
+  EXPECT_NO_THROW(narrow.ConvertFrom(AnyValue{AnyType(3, FixedStringType(20))}));
+  string_array[1] = "longer";
+  EXPECT_THROW(narrow.ConvertFrom(string_array), InvalidConversionException);
+}
+
+TEST(FixedStringTest, CLayoutAndBytes)
+{
+  const auto value = ChannelValue(7, "pressure", 1.5f);
+  CLayout layout{ChannelType()};
+  EXPECT_EQ(layout.GetSize(), sizeof(Channel));
+  EXPECT_EQ(layout.GetAlignment(), alignof(Channel));
+  auto channel = ToCType<Channel>(value, layout);
+  EXPECT_EQ(channel.id, 7);
+  EXPECT_STREQ(channel.name.GetData(), "pressure");
+  EXPECT_EQ(channel.value, 1.5f);
+
+  channel.name = "flow";
+  AnyValue result{ChannelType()};
+  AssignFromCType(result, channel, layout);
+  EXPECT_EQ(result["name"], "flow");
+  EXPECT_EQ(result["name"].GetType(), FixedStringType(12));
+
+  // Packed bytes contain exactly the capacity of the string
+  const auto bytes = ToBytes(value);
+  EXPECT_EQ(bytes.size(), sizeof(uint16) + 12 + sizeof(float32));
+  EXPECT_EQ(std::memcmp(bytes.data() + sizeof(uint16), "pressure\0\0\0\0", 12), 0);
+  AnyValue parsed{ChannelType()};
+  FromBytes(parsed, bytes.data(), bytes.size());
+  EXPECT_EQ(parsed, value);
+  EXPECT_EQ(parsed.GetType(), ChannelType());
+  AnyValue network_parsed{ChannelType()};
+  const auto network_bytes = ToNetworkOrderBytes(value);
+  EXPECT_EQ(std::memcmp(network_bytes.data() + sizeof(uint16), "pressure", 8), 0);
+  FromNetworkOrderBytes(network_parsed, network_bytes.data(), network_bytes.size());
+  EXPECT_EQ(network_parsed, value);
+
+  // Records
+  std::vector<uint8> record_bytes = bytes;
+  const auto second = ToBytes(ChannelValue(8, "level", -2.0f));
+  record_bytes.insert(record_bytes.end(), second.begin(), second.end());
+  const auto records = RecordsFromBytes(ChannelType(), record_bytes.data(), record_bytes.size());
+  ASSERT_EQ(records.NumberOfElements(), 2);
+  EXPECT_EQ(records[1]["name"], "level");
+  EXPECT_EQ(records[1]["name"].GetType(), FixedStringType(12));
+
+  // Missing terminator
+  auto unterminated = bytes;
+  std::memset(unterminated.data() + sizeof(uint16), 'x', 12);
+  EXPECT_THROW(FromBytes(parsed, unterminated.data(), unterminated.size()), ParseException);
+  EXPECT_THROW(RecordsFromBytes(ChannelType(), unterminated.data(), unterminated.size()),
+               ParseException);
+}
+
+TEST(FixedStringTest, BinaryAndJSON)
+{
+  const auto value = ChannelValue(3, "temperature", 20.5f);
+  const auto binary = AnyValueToBinary(value);
+  const auto from_binary = AnyValueFromBinary(binary);
+  EXPECT_EQ(from_binary, value);
+  EXPECT_EQ(from_binary.GetType(), ChannelType());
+  EXPECT_EQ(AnyTypeFromBinary(AnyTypeToBinary(ChannelType())), ChannelType());
+
+  const auto type_json = AnyTypeToJSONString(ChannelType());
+  EXPECT_NE(type_json.find(R"("type":"fixed_string","capacity":12)"), std::string::npos);
+  JSONAnyTypeParser type_parser;
+  ASSERT_TRUE(type_parser.ParseString(type_json));
+  EXPECT_EQ(type_parser.MoveAnyType(), ChannelType());
+  EXPECT_FALSE(type_parser.ParseString(R"({"type":"fixed_string"})"));
+  EXPECT_FALSE(type_parser.ParseString(R"({"type":"fixed_string","capacity":0})"));
+
+  JSONAnyValueParser value_parser;
+  ASSERT_TRUE(value_parser.ParseString(AnyValueToJSONString(value)));
+  const auto from_json = value_parser.MoveAnyValue();
+  EXPECT_EQ(from_json, value);
+  EXPECT_EQ(from_json.GetType(), ChannelType());
+  ASSERT_TRUE(value_parser.TypedParseString(ChannelType(), ValuesToJSONString(value)));
+  EXPECT_EQ(value_parser.MoveAnyValue(), value);
+  EXPECT_FALSE(value_parser.TypedParseString(
+    ChannelType(), R"({"id":1,"name":"much too long for this","value":0.0})"));
+}
+
+TEST(FixedStringTest, StructBinding)
+{
+  static_assert(sizeof(FixedString<12>) == 12, "FixedString must not add storage");
+  static_assert(std::is_standard_layout<FixedString<12>>::value, "FixedString layout");
+  static_assert(std::is_trivially_copyable<FixedString<12>>::value, "FixedString copies");
+  EXPECT_EQ(GetBoundType<Channel>(), ChannelType());
+
+  Channel channel{};
+  channel.id = 2;
+  channel.name = "valve";
+  channel.value = 0.5f;
+  EXPECT_EQ(channel.name.GetSize(), 5);
+  EXPECT_EQ(channel.name.ToString(), "valve");
+  EXPECT_EQ(channel.name, FixedString<12>{std::string{"valve"}});
+  EXPECT_THROW(channel.name = "exactly12chr", InvalidConversionException);
+  EXPECT_EQ(channel.name.ToString(), "valve");
+
+  auto value = ToAnyValue(channel);
+  EXPECT_EQ(value, ChannelValue(2, "valve", 0.5f));
+
+  // Updates of the fixed-capacity leaf are done in place
+  channel.name = "pump";
+  AssignFromBoundStruct(value, channel);
+  EXPECT_EQ(value["name"], "pump");
+  EXPECT_EQ(FromAnyValue<Channel>(value).name, channel.name);
+
+  // A string leaf that does not fit in the bound member
+  auto long_value = ChannelValue(2, "pump", 0.0f);
+  long_value["name"] = "a much longer name";
+  EXPECT_THROW(FromAnyValue<Channel>(long_value), InvalidConversionException);
+}
+
+namespace
+{
+AnyType ChannelType()
+{
+  return AnyType{{
+    {"id", UnsignedInteger16Type},
+    {"name", FixedStringType(12)},
+    {"value", Float32Type}
+  }, "channel_t"};
+}
+
+AnyValue ChannelValue(uint16 id, const std::string& name, float32 value)
+{
+  AnyValue result{ChannelType()};
+  result["id"] = id;
+  result["name"].ConvertFrom(name);
+  result["value"] = value;
+  return result;
+}
+}  // unnamed namespace
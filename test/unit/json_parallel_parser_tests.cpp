@@ -0,0 +1,263 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "test_config.h"
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_helper.h>
+#include <sup/dto/json_value_parser.h>
+#include <sup/dto/thread_pool.h>
+
+#include <string>
+
+using namespace sup::dto;
+
+namespace
+{
+AnyType ElementType();
+
+AnyValue Element(uint32 idx);
+
+AnyValue ElementArray(std::size_t n_elements);
+}
+
+class JSONParallelParserTest : public ::testing::Test
+{
+protected:
+  JSONParallelParserTest();
+  ~JSONParallelParserTest() override;
+
+  AnyValue SequentialParse(const AnyType& anytype, const std::string& json_str);
+
+  ThreadPool m_pool;
+  JSONAnyValueParser m_parser;
+};
+
+TEST_F(JSONParallelParserTest, TopLevelArray)
+{
+  const auto value = ElementArray(500);
+  const auto json_str = ValuesToJSONString(value);
+  ASSERT_TRUE(m_parser.TypedParseString(value.GetType(), json_str, m_pool));
+  auto parsed = m_parser.MoveAnyValue();
+  EXPECT_EQ(parsed, value);
+  EXPECT_EQ(parsed, SequentialParse(value.GetType(), json_str));
+
+  // Pretty printed
+  const auto pretty_json_str = ValuesToJSONString(value, true);
+  ASSERT_TRUE(m_parser.TypedParseString(value.GetType(), pretty_json_str, m_pool));
+  EXPECT_EQ(m_parser.MoveAnyValue(), value);
+}
+
+TEST_F(JSONParallelParserTest, UnboundedArray)
+{
+  AnyType unbounded_type{0, ElementType()};
+  AnyValue value{unbounded_type};
+  for (uint32 idx = 0; idx < 300; ++idx)
+  {
+    value.AddElement(Element(idx));
+  }
+  const auto json_str = ValuesToJSONString(value);
+  ASSERT_TRUE(m_parser.TypedParseString(unbounded_type, json_str, m_pool));
+  auto parsed = m_parser.MoveAnyValue();
+  EXPECT_EQ(parsed.NumberOfElements(), 300);
+  EXPECT_EQ(parsed, value);
+}
+
+TEST_F(JSONParallelParserTest, FewerElementsThanArraySize)
+{
+  const auto value = ElementArray(400);
+  const auto json_str = ValuesToJSONString(ElementArray(300));
+  ASSERT_TRUE(m_parser.TypedParseString(value.GetType(), json_str, m_pool));
+  auto parsed = m_parser.MoveAnyValue();
+  EXPECT_EQ(parsed, SequentialParse(value.GetType(), json_str));
+  EXPECT_EQ(parsed[299], Element(299));
+  EXPECT_EQ(parsed[300], AnyValue{ElementType()});
+}
+
+TEST_F(JSONParallelParserTest, NestedArrays)
+{
+  AnyType nested_type{{
+    {"header", {
+      {"id", UnsignedInteger64Type},
+      {"source", StringType}
+    }},
+    {"elements", AnyType(200, ElementType())},
+    {"grid", AnyType(50, AnyType(20, Float32Type))},
+    {"single", AnyType(1, AnyType(100, SignedInteger16Type))}
+  }, "nested_t"};
+  AnyValue value{nested_type};
+  value["header.id"] = 123456789ul;
+  value["header.source"] = R"RAW(some "quoted" [text] {with} \ delimiters)RAW";
+  for (uint32 idx = 0; idx < 200; ++idx)
+  {
+    value["elements"][idx] = Element(idx);
+  }
+  for (uint32 row = 0; row < 50; ++row)
+  {
+    for (uint32 col = 0; col < 20; ++col)
+    {
+      value["grid"][row][col] = 0.5f * static_cast<float32>(row * col);
+    }
+  }
+  for (int16 idx = 0; idx < 100; ++idx)
+  {
+    value["single"][0][idx] = static_cast<int16>(-idx);
+  }
+  const auto json_str = ValuesToJSONString(value);
+  ASSERT_TRUE(m_parser.TypedParseString(nested_type, json_str, m_pool));
+  auto parsed = m_parser.MoveAnyValue();
+  EXPECT_EQ(parsed, value);
+  EXPECT_EQ(parsed, SequentialParse(nested_type, json_str));
+}
+
+TEST_F(JSONParallelParserTest, SmallDocument)
+{
+  const auto value = ElementArray(2);
+  const auto json_str = ValuesToJSONString(value);
+  ASSERT_TRUE(m_parser.TypedParseString(value.GetType(), json_str, m_pool));
+  EXPECT_EQ(m_parser.MoveAnyValue(), value);
+}
+
+TEST_F(JSONParallelParserTest, ParseFile)
+{
+  const auto value = ElementArray(500);
+  const auto filename = testconfig::CMakeBinaryDir() + "/parallel_parse_file.json";
+  ValuesToJSONFile(value, filename);
+  ASSERT_TRUE(m_parser.TypedParseFile(value.GetType(), filename, m_pool));
+  EXPECT_EQ(m_parser.MoveAnyValue(), value);
+  EXPECT_FALSE(m_parser.TypedParseFile(value.GetType(), "/this/file/does/not/exist", m_pool));
+}
+
+TEST_F(JSONParallelParserTest, Failures)
+{
+  const auto value = ElementArray(300);
+  const auto anytype = value.GetType();
+  const auto json_str = ValuesToJSONString(value);
+  {
+    // Too many elements
+    const auto short_type = ElementArray(299).GetType();
+    EXPECT_FALSE(m_parser.TypedParseString(short_type, json_str, m_pool));
+  }
+  {
+    // Trailing characters
+    EXPECT_FALSE(m_parser.TypedParseString(anytype, json_str + " ]", m_pool));
+  }
+  {
+    // Missing separator between elements
+    auto malformed = json_str;
+    const auto pos = malformed.find("},{");
+    ASSERT_NE(pos, std::string::npos);
+    malformed[pos + 1] = ' ';
+    EXPECT_FALSE(m_parser.TypedParseString(anytype, malformed, m_pool));
+  }
+  {
+    // Trailing comma
+    auto malformed = json_str;
+    malformed.insert(malformed.size() - 1, ",");
+    EXPECT_FALSE(m_parser.TypedParseString(anytype, malformed, m_pool));
+  }
+  {
+    // Wrong value inside an element
+    auto malformed = json_str;
+    const auto pos = malformed.rfind("\"id\":");
+    ASSERT_NE(pos, std::string::npos);
+    malformed.replace(pos, 5, "\"id\":\"wrong\",\"x\":");
+    EXPECT_FALSE(m_parser.TypedParseString(anytype, malformed, m_pool));
+  }
+  {
+    // Unknown member inside an element
+    auto malformed = json_str;
+    const auto pos = malformed.rfind("\"id\":");
+    ASSERT_NE(pos, std::string::npos);
+    malformed.replace(pos, 5, "\"unknown\":");
+    EXPECT_FALSE(m_parser.TypedParseString(anytype, malformed, m_pool));
+  }
+  {
+    // Unbalanced structure
+    EXPECT_FALSE(m_parser.TypedParseString(anytype, json_str.substr(0, json_str.size() - 1),
+                                           m_pool));
+  }
+  {
+    // Structure instead of array
+    AnyType wrapped_type{{{"elements", anytype}}};
+    EXPECT_FALSE(m_parser.TypedParseString(wrapped_type, json_str, m_pool));
+  }
+}
+
+JSONParallelParserTest::JSONParallelParserTest()
+  : m_pool{4}
+  , m_parser{}
+{}
+
+JSONParallelParserTest::~JSONParallelParserTest() = default;
+
+AnyValue JSONParallelParserTest::SequentialParse(const AnyType& anytype,
+                                                 const std::string& json_str)
+{
+  JSONAnyValueParser parser;
+  EXPECT_TRUE(parser.TypedParseString(anytype, json_str));
+  return parser.MoveAnyValue();
+}
+
+namespace
+{
+AnyType ElementType()
+{
+  return AnyType{{
+    {"id", UnsignedInteger32Type},
+    {"name", StringType},
+    {"enabled", BooleanType},
+    {"values", AnyType(4, Float64Type)},
+    {"limits", {
+      {"low", SignedInteger32Type},
+      {"high", SignedInteger32Type}
+    }}
+  }, "element_t"};
+}
+
+AnyValue Element(uint32 idx)
+{
+  AnyValue result{ElementType()};
+  result["id"] = idx;
+  result["name"] = "element [" + std::to_string(idx) + "] {\"escaped\"}";
+  result["enabled"] = (idx % 2 == 0);
+  for (uint32 i = 0; i < 4; ++i)
+  {
+    result["values"][i] = 0.25 * (idx + i);
+  }
+  result["limits.low"] = -static_cast<int32>(idx);
+  result["limits.high"] = static_cast<int32>(idx * 2);
+  return result;
+}
+
+AnyValue ElementArray(std::size_t n_elements)
+{
+  AnyValue result{AnyType(n_elements, ElementType())};
+  for (std::size_t idx = 0; idx < n_elements; ++idx)
+  {
+    result[idx] = Element(static_cast<uint32>(idx));
+  }
+  return result;
+}
+}
@@ -0,0 +1,226 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "test_config.h"
+
+#include <sup/dto/anytype_registry.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_helper.h>
+#include <sup/dto/json_value_parser.h>
+
+#include <string>
+#include <vector>
+
+using namespace sup::dto;
+
+namespace
+{
+AnyType MeasurementType();
+
+AnyValue Measurement();
+}
+
+class JSONProjectionParserTest : public ::testing::Test
+{
+protected:
+  JSONProjectionParserTest();
+  ~JSONProjectionParserTest() override;
+
+  AnyValue m_value;
+  JSONAnyValueParser m_parser;
+};
+
+TEST_F(JSONProjectionParserTest, TypedSingleLeaf)
+{
+  const auto json_str = ValuesToJSONString(m_value);
+  ASSERT_TRUE(m_parser.TypedParseString(m_value.GetType(), json_str, {"setpoint.high"}));
+  auto parsed = m_parser.MoveAnyValue();
+  AnyType expected_type{{
+    {"setpoint", AnyType{{
+      {"high", Float64Type}
+    }, "setpoint_t"}}
+  }, "measurement_t"};
+  EXPECT_EQ(parsed.GetType(), expected_type);
+  EXPECT_EQ(parsed["setpoint.high"], m_value["setpoint.high"]);
+}
+
+TEST_F(JSONProjectionParserTest, TypedMultipleFields)
+{
+  const auto json_str = ValuesToJSONString(m_value, true);
+  // Member order of the result follows the type, not the list of paths
+  ASSERT_TRUE(m_parser.TypedParseString(m_value.GetType(), json_str,
+                                        {"samples", "setpoint.low", "id"}));
+  auto parsed = m_parser.MoveAnyValue();
+  const std::vector<std::string> expected_members{"id", "setpoint", "samples"};
+  EXPECT_EQ(parsed.MemberNames(), expected_members);
+  EXPECT_EQ(parsed["id"], m_value["id"]);
+  EXPECT_EQ(parsed["setpoint"].NumberOfMembers(), 1);
+  EXPECT_EQ(parsed["setpoint.low"], m_value["setpoint.low"]);
+  EXPECT_EQ(parsed["samples"], m_value["samples"]);
+}
+
+TEST_F(JSONProjectionParserTest, TypedOverlappingPaths)
+{
+  const auto json_str = ValuesToJSONString(m_value);
+  ASSERT_TRUE(m_parser.TypedParseString(m_value.GetType(), json_str,
+                                        {"setpoint.high", "setpoint", "setpoint.low"}));
+  auto parsed = m_parser.MoveAnyValue();
+  EXPECT_EQ(parsed.NumberOfMembers(), 1);
+  EXPECT_EQ(parsed["setpoint"], m_value["setpoint"]);
+
+  // Empty path selects everything
+  ASSERT_TRUE(m_parser.TypedParseString(m_value.GetType(), json_str, {"", "id"}));
+  EXPECT_EQ(m_parser.MoveAnyValue(), m_value);
+
+  // No paths select nothing
+  ASSERT_TRUE(m_parser.TypedParseString(m_value.GetType(), json_str,
+                                        std::vector<std::string>{}));
+  parsed = m_parser.MoveAnyValue();
+  EXPECT_TRUE(IsStructValue(parsed));
+  EXPECT_EQ(parsed.NumberOfMembers(), 0);
+}
+
+TEST_F(JSONProjectionParserTest, TypedSkippedValuesAreNotChecked)
+{
+  // Skipped members are only tokenized: they are not checked against the type
+  const std::string json_str = R"RAW({"id":7,"source":{"unexpected":[1,"two",{"three":3}]},)RAW"
+    R"RAW("setpoint":{"low":-1.5,"high":1.5,"unit":null},"samples":false})RAW";
+  ASSERT_TRUE(m_parser.TypedParseString(m_value.GetType(), json_str, {"id", "setpoint.high"}));
+  auto parsed = m_parser.MoveAnyValue();
+  EXPECT_EQ(parsed["id"], 7u);
+  EXPECT_EQ(parsed["setpoint.high"], 1.5);
+
+  // But they still need to be valid JSON
+  EXPECT_FALSE(m_parser.TypedParseString(m_value.GetType(), R"RAW({"id":7,"source":[1,}})RAW",
+                                         {"id"}));
+}
+
+TEST_F(JSONProjectionParserTest, TypedFailures)
+{
+  const auto json_str = ValuesToJSONString(m_value);
+  // Unknown field
+  EXPECT_FALSE(m_parser.TypedParseString(m_value.GetType(), json_str, {"setpoint.unknown"}));
+  // Field of a scalar
+  EXPECT_FALSE(m_parser.TypedParseString(m_value.GetType(), json_str, {"id.sub"}));
+  // Array element
+  EXPECT_FALSE(m_parser.TypedParseString(m_value.GetType(), json_str, {"samples[1]"}));
+  // Malformed path
+  EXPECT_FALSE(m_parser.TypedParseString(m_value.GetType(), json_str, {"setpoint..low"}));
+  // Wrong value type for a selected field
+  const std::string wrong_json = R"RAW({"id":"seven"})RAW";
+  EXPECT_FALSE(m_parser.TypedParseString(m_value.GetType(), wrong_json, {"id"}));
+}
+
+TEST_F(JSONProjectionParserTest, TypedParseFile)
+{
+  const auto filename = testconfig::CMakeBinaryDir() + "/projection_parse_file.json";
+  ValuesToJSONFile(m_value, filename);
+  ASSERT_TRUE(m_parser.TypedParseFile(m_value.GetType(), filename, {"source.name"}));
+  auto parsed = m_parser.MoveAnyValue();
+  EXPECT_EQ(parsed["source.name"], m_value["source.name"]);
+  EXPECT_FALSE(parsed["source"].HasField("location"));
+  EXPECT_FALSE(m_parser.TypedParseFile(m_value.GetType(), "/this/file/does/not/exist",
+                                       {"source.name"}));
+}
+
+TEST_F(JSONProjectionParserTest, SelfDescribing)
+{
+  const auto json_str = AnyValueToJSONString(m_value);
+  ASSERT_TRUE(m_parser.ParseString(json_str, nullptr, {"source.location", "samples"}));
+  auto parsed = m_parser.MoveAnyValue();
+  EXPECT_EQ(parsed.MemberNames(), std::vector<std::string>({"source", "samples"}));
+  EXPECT_EQ(parsed["source"].MemberNames(), std::vector<std::string>({"location"}));
+  EXPECT_EQ(parsed["source.location"], m_value["source.location"]);
+  EXPECT_EQ(parsed["samples"], m_value["samples"]);
+  EXPECT_EQ(parsed.GetTypeName(), m_value.GetTypeName());
+
+  // Unknown field
+  EXPECT_FALSE(m_parser.ParseString(json_str, nullptr, {"source.unknown"}));
+}
+
+TEST_F(JSONProjectionParserTest, SelfDescribingWithRegistry)
+{
+  AnyTypeRegistry registry;
+  registry.RegisterType(MeasurementType());
+  AnyValue wrapper = {{
+    {"measurement", m_value}
+  }};
+  auto json_str = AnyValueToJSONString(wrapper);
+  ASSERT_TRUE(m_parser.ParseString(json_str, &registry, {"measurement.setpoint.low"}));
+  auto parsed = m_parser.MoveAnyValue();
+  EXPECT_EQ(parsed["measurement.setpoint.low"], m_value["setpoint.low"]);
+  EXPECT_FALSE(parsed["measurement"].HasField("id"));
+}
+
+TEST_F(JSONProjectionParserTest, SelfDescribingParseFile)
+{
+  const auto filename = testconfig::CMakeBinaryDir() + "/projection_parse_file_full.json";
+  AnyValueToJSONFile(m_value, filename);
+  ASSERT_TRUE(m_parser.ParseFile(filename, nullptr, {"id"}));
+  auto parsed = m_parser.MoveAnyValue();
+  EXPECT_EQ(parsed.NumberOfMembers(), 1);
+  EXPECT_EQ(parsed["id"], m_value["id"]);
+  EXPECT_FALSE(m_parser.ParseFile("/this/file/does/not/exist", nullptr, {"id"}));
+}
+
+JSONProjectionParserTest::JSONProjectionParserTest()
+  : m_value{Measurement()}
+  , m_parser{}
+{}
+
+JSONProjectionParserTest::~JSONProjectionParserTest() = default;
+
+namespace
+{
+AnyType MeasurementType()
+{
+  return AnyType{{
+    {"id", UnsignedInteger32Type},
+    {"source", {
+      {"name", StringType},
+      {"location", StringType}
+    }},
+    {"setpoint", AnyType{{
+      {"low", Float64Type},
+      {"high", Float64Type}
+    }, "setpoint_t"}},
+    {"samples", AnyType(5, SignedInteger16Type)}
+  }, "measurement_t"};
+}
+
+AnyValue Measurement()
+{
+  AnyValue result{MeasurementType()};
+  result["id"] = 42u;
+  result["source.name"] = "sensor {\"A\"}";
+  result["source.location"] = "hall [3]";
+  result["setpoint.low"] = -2.5;
+  result["setpoint.high"] = 12.25;
+  for (uint32 idx = 0; idx < 5; ++idx)
+  {
+    result["samples"][idx] = static_cast<int16>(idx * 100 - 200);
+  }
+  return result;
+}
+}
@@ -28,6 +28,9 @@
 #include <sup/dto/anyvalue_helper.h>
 #include <sup/dto/json_value_parser.h>
 
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -318,6 +321,78 @@ TEST_F(JSONTypedValueParserTest, ValuesToJSONRoundTrip)
   EXPECT_EQ(round_tripped, original);
 }
 
+TEST_F(JSONTypedValueParserTest, Float32RoundTrip)
+{
+  // Sample the finite float32 values over the whole range (including subnormals) by stepping
+  // through their bit patterns
+  std::vector<float32> samples;
+  for (uint64 bits = 0; bits < 0x7F800000u; bits += 0x10001u)
+  {
+    const auto bits32 = static_cast<uint32>(bits);
+    float32 f;
+    std::memcpy(&f, &bits32, sizeof(f));
+    samples.push_back(f);
+    samples.push_back(-f);
+  }
+  samples.push_back(std::numeric_limits<float32>::min());
+  samples.push_back(std::numeric_limits<float32>::max());
+  samples.push_back(std::numeric_limits<float32>::denorm_min());
+  samples.push_back(std::nextafter(1.0f, 2.0f));
+  samples.push_back(0.1f);
+  AnyValue original{AnyType(samples.size(), Float32Type)};
+  for (std::size_t idx = 0; idx < samples.size(); ++idx)
+  {
+    original[idx] = samples[idx];
+  }
+  const std::string json = ValuesToJSONString(original);
+  ASSERT_TRUE(m_parser.TypedParseString(original.GetType(), json));
+  auto round_tripped = m_parser.MoveAnyValue();
+  for (std::size_t idx = 0; idx < samples.size(); ++idx)
+  {
+    ASSERT_EQ(round_tripped[idx].As<float32>(), samples[idx]) << "at index " << idx;
+  }
+
+  // Also through the self-describing format
+  ASSERT_TRUE(m_parser.ParseString(AnyValueToJSONString(original)));
+  EXPECT_EQ(m_parser.MoveAnyValue(), original);
+}
+
+TEST_F(JSONTypedValueParserTest, NumericArrays)
+{
+  {
+    ASSERT_TRUE(m_parser.TypedParseString(AnyType(3, SignedInteger8Type), "[1,-2,127]"));
+    auto parsed_val = m_parser.MoveAnyValue();
+    EXPECT_EQ(parsed_val[1], static_cast<int8>(-2));
+    EXPECT_EQ(parsed_val[2], static_cast<int8>(127));
+  }
+  {
+    ASSERT_TRUE(m_parser.TypedParseString(AnyType(3, Float64Type), "[1,-2.5,3e2]"));
+    auto parsed_val = m_parser.MoveAnyValue();
+    EXPECT_EQ(parsed_val[0], 1.0);
+    EXPECT_EQ(parsed_val[1], -2.5);
+    EXPECT_EQ(parsed_val[2], 300.0);
+  }
+  {
+    ASSERT_TRUE(m_parser.TypedParseString(AnyType(2, Float32Type), "[0.1,-7]"));
+    auto parsed_val = m_parser.MoveAnyValue();
+    EXPECT_EQ(parsed_val[0], 0.1f);
+    EXPECT_EQ(parsed_val[1], -7.0f);
+  }
+  {
+    AnyType unbounded_type(0, UnsignedInteger64Type);
+    ASSERT_TRUE(m_parser.TypedParseString(unbounded_type, "[0,18446744073709551615]"));
+    auto parsed_val = m_parser.MoveAnyValue();
+    ASSERT_EQ(parsed_val.NumberOfElements(), 2);
+    EXPECT_EQ(parsed_val[1], std::numeric_limits<uint64>::max());
+  }
+  // Out of range for the element type
+  EXPECT_FALSE(m_parser.TypedParseString(AnyType(1, SignedInteger8Type), "[128]"));
+  EXPECT_FALSE(m_parser.TypedParseString(AnyType(1, UnsignedInteger16Type), "[-1]"));
+  // Malformed numbers
+  EXPECT_FALSE(m_parser.TypedParseString(AnyType(1, Float64Type), "[1.]"));
+  EXPECT_FALSE(m_parser.TypedParseString(AnyType(1, Float32Type), "[01]"));
+}
+
 JSONTypedValueParserTest::JSONTypedValueParserTest() = default;
 
 JSONTypedValueParserTest::~JSONTypedValueParserTest() = default;
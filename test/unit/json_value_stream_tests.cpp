@@ -0,0 +1,221 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/anytype_registry.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_helper.h>
+#include <sup/dto/json_value_stream.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace sup::dto;
+
+namespace
+{
+const std::string kRecordTypeName = "record_t";
+
+AnyType RecordType();
+
+AnyValue Record(uint32 id);
+}
+
+TEST(JSONValueStreamTest, WriteRecordsPerLine)
+{
+  std::ostringstream oss;
+  JSONAnyValueStreamWriter writer(oss);
+  writer.Write(Record(1));
+  writer.Write(AnyValue{SignedInteger16Type, -5});
+  EXPECT_EQ(writer.NumberOfRecords(), 2);
+
+  const std::string expected = AnyValueToJSONString(Record(1)) + "\n"
+                               + AnyValueToJSONString(AnyValue{SignedInteger16Type, -5}) + "\n";
+  EXPECT_EQ(oss.str(), expected);
+}
+
+TEST(JSONValueStreamTest, WriteTypedRecordsPerLine)
+{
+  std::ostringstream oss;
+  JSONAnyValueStreamWriter writer(oss, RecordType());
+  writer.Write(Record(1));
+  writer.Write(Record(2));
+  EXPECT_EQ(writer.NumberOfRecords(), 2);
+
+  const std::string expected = ValuesToJSONString(Record(1)) + "\n"
+                               + ValuesToJSONString(Record(2)) + "\n";
+  EXPECT_EQ(oss.str(), expected);
+
+  // Record with wrong type throws and is not counted
+  EXPECT_THROW(writer.Write(AnyValue{StringType, "oops"}), SerializeException);
+  EXPECT_EQ(writer.NumberOfRecords(), 2);
+}
+
+TEST(JSONValueStreamTest, RoundTrip)
+{
+  std::vector<AnyValue> records;
+  for (uint32 i = 0; i < 100; ++i)
+  {
+    records.push_back(Record(i));
+  }
+  records.emplace_back(EmptyType);
+  records.emplace_back(StringType, "last one");
+
+  std::stringstream ss;
+  JSONAnyValueStreamWriter writer(ss);
+  for (const auto& record : records)
+  {
+    writer.Write(record);
+  }
+
+  JSONAnyValueStreamReader reader(ss);
+  AnyValue record;
+  std::size_t idx = 0;
+  while (reader.ReadNext(record))
+  {
+    ASSERT_LT(idx, records.size());
+    EXPECT_EQ(record, records[idx]);
+    ++idx;
+  }
+  EXPECT_EQ(idx, records.size());
+  EXPECT_EQ(reader.NumberOfRecords(), records.size());
+  EXPECT_FALSE(reader.ReadNext(record));
+}
+
+TEST(JSONValueStreamTest, TypedRoundTrip)
+{
+  std::stringstream ss;
+  JSONAnyValueStreamWriter writer(ss, RecordType());
+  for (uint32 i = 0; i < 100; ++i)
+  {
+    writer.Write(Record(i));
+  }
+
+  JSONAnyValueStreamReader reader(ss, RecordType());
+  AnyValue record;
+  uint32 idx = 0;
+  while (reader.ReadNext(record))
+  {
+    EXPECT_EQ(record, Record(idx));
+    ++idx;
+  }
+  EXPECT_EQ(idx, 100);
+  EXPECT_EQ(reader.NumberOfRecords(), 100);
+}
+
+TEST(JSONValueStreamTest, ReadWithRegistry)
+{
+  AnyTypeRegistry registry;
+  registry.RegisterType(RecordType());
+  const std::string json_record =
+    R"RAW([{"encoding":"sup-dto/v1.0/JSON"},{"datatype":{"type":"record_t"}},)RAW"
+    R"RAW({"instance":{"id":7,"name":"seven","data":[1.5,2.5]}}])RAW";
+  std::istringstream iss(json_record + "\n" + json_record + "\n");
+  {
+    // Unknown type name without registry
+    JSONAnyValueStreamReader reader(iss);
+    AnyValue record;
+    EXPECT_THROW(reader.ReadNext(record), ParseException);
+  }
+  JSONAnyValueStreamReader reader(iss, &registry);
+  AnyValue record;
+  ASSERT_TRUE(reader.ReadNext(record));
+  auto expected = Record(7);
+  expected["name"] = "seven";
+  expected["data"][0] = 1.5;
+  expected["data"][1] = 2.5;
+  EXPECT_EQ(record, expected);
+  EXPECT_FALSE(reader.ReadNext(record));
+}
+
+TEST(JSONValueStreamTest, BlankLines)
+{
+  std::istringstream iss("\n  42 \n\n\t43\n \t \n44\r\n\n");
+  JSONAnyValueStreamReader reader(iss, SignedInteger32Type);
+  AnyValue record;
+  std::vector<int32> parsed;
+  while (reader.ReadNext(record))
+  {
+    parsed.push_back(record.As<int32>());
+  }
+  const std::vector<int32> expected{42, 43, 44};
+  EXPECT_EQ(parsed, expected);
+}
+
+TEST(JSONValueStreamTest, EmptyStream)
+{
+  std::istringstream iss("");
+  JSONAnyValueStreamReader reader(iss);
+  AnyValue record{UnsignedInteger8Type, 3};
+  EXPECT_FALSE(reader.ReadNext(record));
+  EXPECT_EQ(reader.NumberOfRecords(), 0);
+  EXPECT_EQ(record, AnyValue(UnsignedInteger8Type, 3));
+}
+
+TEST(JSONValueStreamTest, ResynchronizeAfterMalformedRecord)
+{
+  std::stringstream ss;
+  JSONAnyValueStreamWriter writer(ss, RecordType());
+  writer.Write(Record(1));
+  ss << R"RAW({"id":2,"name":)RAW" << "\n";
+  ss << R"RAW({"id":"not a number"})RAW" << "\n";
+  ss << ValuesToJSONString(Record(3)) << " 3" << "\n";
+  writer.Write(Record(4));
+
+  JSONAnyValueStreamReader reader(ss, RecordType());
+  AnyValue record;
+  ASSERT_TRUE(reader.ReadNext(record));
+  EXPECT_EQ(record, Record(1));
+  EXPECT_THROW(reader.ReadNext(record), ParseException);
+  EXPECT_THROW(reader.ReadNext(record), ParseException);
+  EXPECT_THROW(reader.ReadNext(record), ParseException);
+  EXPECT_EQ(record, Record(1));
+  ASSERT_TRUE(reader.ReadNext(record));
+  EXPECT_EQ(record, Record(4));
+  EXPECT_FALSE(reader.ReadNext(record));
+  EXPECT_EQ(reader.NumberOfRecords(), 5);
+}
+
+namespace
+{
+AnyType RecordType()
+{
+  return AnyType{{
+    {"id", UnsignedInteger32Type},
+    {"name", StringType},
+    {"data", AnyType(2, Float64Type)}
+  }, kRecordTypeName};
+}
+
+AnyValue Record(uint32 id)
+{
+  AnyValue result{RecordType()};
+  result["id"] = id;
+  result["name"] = "record_" + std::to_string(id);
+  result["data"][0] = 0.5 * id;
+  result["data"][1] = -0.25 * id;
+  return result;
+}
+}
@@ -0,0 +1,69 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/anyvalue/leaf_payload_access.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+using namespace sup::dto;
+
+TEST(LeafPayloadAccessTest, Scalars)
+{
+  AnyValue leaf{SignedInteger32Type};
+  LeafPayloadAccess::Store(leaf, int32{-7});
+  EXPECT_EQ(leaf, -7);
+  int32 val = 0;
+  LeafPayloadAccess::Load(leaf, val);
+  EXPECT_EQ(val, -7);
+
+  // No conversions between scalar types
+  EXPECT_THROW(LeafPayloadAccess::Store(leaf, uint32{7}), InvalidConversionException);
+  float64 other = 0.0;
+  EXPECT_THROW(LeafPayloadAccess::Load(leaf, other), InvalidConversionException);
+}
+
+TEST(LeafPayloadAccessTest, Strings)
+{
+  AnyValue str{StringType};
+  const char8 src[8] = "sensor";
+  LeafPayloadAccess::StoreString(str, src, sizeof(src));
+  EXPECT_EQ(str, "sensor");
+  char8 dest[8] = "xxxxxxx";
+  LeafPayloadAccess::LoadString(str, dest, sizeof(dest));
+  EXPECT_STREQ(dest, "sensor");
+  EXPECT_EQ(dest[7], 0);
+  char8 small[6];
+  EXPECT_THROW(LeafPayloadAccess::LoadString(str, small, sizeof(small)),
+               InvalidConversionException);
+}
+
+TEST(LeafPayloadAccessTest, StringLength)
+{
+  const AnyValue str{StringType, std::string("with\0zero", 9)};
+  EXPECT_EQ(LeafPayloadAccess::StringLength(str), 9);
+  const AnyValue fixed_str{FixedStringType(16), "sensor"};
+  EXPECT_EQ(LeafPayloadAccess::StringLength(fixed_str), 6);
+  EXPECT_THROW(LeafPayloadAccess::StringLength(AnyValue{42}), InvalidConversionException);
+}
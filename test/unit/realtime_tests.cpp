@@ -0,0 +1,240 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "allocation_counter.h"
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_leaves.h>
+#include <sup/dto/ctype_layout.h>
+#include <sup/dto/fixed_string.h>
+#include <sup/dto/struct_binding.h>
+
+#include <cstring>
+#include <vector>
+
+namespace realtimetest
+{
+struct Sample
+{
+  sup::dto::uint32 counter;
+  sup::dto::float64 position[3];
+  sup::dto::boolean valid;
+  sup::dto::FixedString<16> label;
+};
+}  // namespace realtimetest
+
+SUP_DTO_STRUCT_BINDING(realtimetest::Sample, "sample_t",
+                       SUP_DTO_MEMBER(counter),
+                       SUP_DTO_MEMBER(position),
+                       SUP_DTO_MEMBER(valid),
+                       SUP_DTO_MEMBER(label))
+
+using namespace sup::dto;
+using realtimetest::Sample;
+
+namespace
+{
+AnyType RealTimeType();
+
+AnyValue RealTimeValue(uint32 seed);
+}  // unnamed namespace
+
+TEST(RealTimeTest, SameTypeAssignment)
+{
+  const auto anytype = RealTimeType();
+  AnyValue dest{anytype};
+  // Reserve room for the regular string leaf:
+  dest["status"] = "--------------------------------";
+  std::vector<AnyValue> sources;
+  std::vector<const AnyValue*> source_elements;
+  for (uint32 seed = 0; seed < 4; ++seed)
+  {
+    sources.push_back(RealTimeValue(seed));
+  }
+  for (const auto& source : sources)
+  {
+    source_elements.push_back(&source["history"][0]);
+  }
+  auto& element = dest["history"][1];
+  AllocationCounter allocations;
+  for (std::size_t idx = 0; idx < sources.size(); ++idx)
+  {
+    dest = sources[idx];
+    element = *source_elements[idx];
+  }
+  EXPECT_EQ(allocations.GetCount(), 0);
+  EXPECT_EQ(dest["counter"], sources.back()["counter"]);
+  EXPECT_EQ(dest["label"], sources.back()["label"]);
+  EXPECT_EQ(dest["status"], sources.back()["status"]);
+  EXPECT_EQ(dest["history"][1], sources.back()["history"][0]);
+  EXPECT_EQ(dest.GetType(), anytype);
+}
+
+TEST(RealTimeTest, LeafSet)
+{
+  const auto anytype = RealTimeType();
+  AnyValue value{anytype};
+  // Resolve the leaves once, before entering the loop:
+  LeafIndex index{anytype};
+  auto& counter = value["counter"];
+  auto& position = index.GetLeaf(value, 2);
+  auto& label = value["label"];
+  auto& history = value["history"];
+  std::vector<AnyValue*> levels;
+  for (std::size_t idx = 0; idx < history.NumberOfElements(); ++idx)
+  {
+    levels.push_back(&history[idx]["level"]);
+  }
+  float64 total = 0.0;
+  AllocationCounter allocations;
+  for (uint32 cycle = 0; cycle < 10; ++cycle)
+  {
+    counter.AssignScalar(cycle);
+    total += position.As<float64>();
+    position.AssignScalar(0.5 * cycle);
+    label.AssignScalar("cycle");
+    // Converted to the type of the leaf:
+    levels[cycle % 4]->AssignScalar(static_cast<int8>(-1));
+  }
+  EXPECT_EQ(allocations.GetCount(), 0);
+  EXPECT_EQ(value["counter"].As<uint32>(), 9);
+  EXPECT_EQ(total, 18.0);
+  EXPECT_EQ(value["position[1]"].As<float64>(), 4.5);
+  EXPECT_EQ(value["label"].As<std::string>(), "cycle");
+  EXPECT_EQ(value["history[1].level"].GetTypeCode(), TypeCode::Int32);
+  EXPECT_EQ(value["history[1].level"].As<int32>(), -1);
+  EXPECT_EQ(value.GetType(), anytype);
+
+  // Failing conversions leave the type unchanged:
+  EXPECT_THROW(counter.AssignScalar(-1), InvalidConversionException);
+  EXPECT_THROW(counter.AssignScalar("text"), InvalidConversionException);
+  EXPECT_THROW(label.AssignScalar(1.0), InvalidConversionException);
+  EXPECT_THROW(label.AssignScalar("more than sixteen characters"), InvalidConversionException);
+  EXPECT_THROW(history.AssignScalar(true), InvalidConversionException);
+  EXPECT_EQ(value.GetType(), anytype);
+  EXPECT_EQ(value["counter"].As<uint32>(), 9);
+}
+
+TEST(RealTimeTest, ByteDecode)
+{
+  const auto anytype = RealTimeType();
+  std::vector<std::vector<uint8>> frames;
+  for (uint32 seed = 0; seed < 4; ++seed)
+  {
+    frames.push_back(ToBytes(RealTimeValue(seed)));
+  }
+  AnyValue value{anytype};
+  value["status"] = "--------------------------------";
+  // The packed layout is the one of ToBytes:
+  CLayout layout{anytype, 1};
+  ASSERT_EQ(layout.GetSize(), frames.front().size());
+  AllocationCounter allocations;
+  for (const auto& frame : frames)
+  {
+    layout.Read(value, frame.data(), frame.size());
+  }
+  EXPECT_EQ(allocations.GetCount(), 0);
+  EXPECT_EQ(value, RealTimeValue(3));
+
+  // FromBytes gives the same result:
+  AnyValue other{anytype};
+  FromBytes(other, frames.back().data(), frames.back().size());
+  EXPECT_EQ(other, value);
+}
+
+TEST(RealTimeTest, CTypeCopy)
+{
+  const auto& anytype = GetBoundType<Sample>();
+  AnyValue value{anytype};
+  CLayout layout{anytype};
+  ASSERT_EQ(layout.GetSize(), sizeof(Sample));
+  Sample sample{};
+  sample.counter = 7;
+  sample.position[2] = 1.5;
+  sample.valid = true;
+  sample.label = FixedString<16>{"sample"};
+  Sample copy{};
+  Sample bound_copy{};
+  AllocationCounter allocations;
+  AssignFromCType(value, sample, layout);
+  copy = ToCType<Sample>(value, layout);
+  AssignFromBoundStruct(value, sample);
+  AssignToBoundStruct(bound_copy, value);
+  EXPECT_EQ(allocations.GetCount(), 0);
+  EXPECT_EQ(value["counter"].As<uint32>(), 7);
+  EXPECT_EQ(value["label"].As<std::string>(), "sample");
+  EXPECT_EQ(copy.position[2], 1.5);
+  EXPECT_EQ(copy.label, sample.label);
+  EXPECT_EQ(bound_copy.counter, 7);
+  EXPECT_TRUE(bound_copy.valid);
+}
+
+TEST(RealTimeTest, GrowingStrings)
+{
+  // Regular string leaves only allocate when they need to grow
+  AnyValue value{StringType};
+  value.AssignScalar("a string that does not fit in the small string buffer");
+  AllocationCounter allocations;
+  value.AssignScalar("short");
+  value.AssignScalar(std::string{});
+  EXPECT_EQ(allocations.GetCount(), 0);
+  EXPECT_EQ(value.As<std::string>(), "");
+}
+
+namespace
+{
+AnyType RealTimeType()
+{
+  AnyType entry_type{{
+    {"valid", BooleanType},
+    {"level", SignedInteger32Type}
+  }, "entry_t"};
+  return AnyType{{
+    {"counter", UnsignedInteger32Type},
+    {"position", AnyType(3, Float64Type)},
+    {"label", FixedStringType(16)},
+    {"status", StringType},
+    {"history", AnyType(4, entry_type)}
+  }, "realtime_t"};
+}
+
+AnyValue RealTimeValue(uint32 seed)
+{
+  AnyValue result{RealTimeType()};
+  result["counter"] = seed;
+  for (uint32 idx = 0; idx < 3; ++idx)
+  {
+    result["position"][idx] = 0.25 * (seed + idx);
+  }
+  result["label"].ConvertFrom("label " + std::to_string(seed));
+  result["status"] = "status " + std::to_string(seed);
+  for (uint32 idx = 0; idx < 4; ++idx)
+  {
+    result["history"][idx]["valid"] = (idx + seed) % 2 == 0;
+    result["history"][idx]["level"] = static_cast<int32>(seed * idx);
+  }
+  return result;
+}
+}  // unnamed namespace
@@ -0,0 +1,252 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/low_level/arithmetic_to_bytes_t.h>
+#include <sup/dto/parse/record_decoder.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <vector>
+
+using namespace sup::dto;
+
+namespace
+{
+AnyType RecordType();
+
+AnyValue Record(uint32 idx);
+
+std::vector<uint8> RecordBytes(std::size_t n_records, bool network_order);
+}  // unnamed namespace
+
+TEST(RecordDecoderTest, Leaves)
+{
+  RecordDecoder decoder{RecordType(), CTypeParser::ByteOrder::Host};
+  EXPECT_EQ(decoder.GetRecordType(), RecordType());
+  EXPECT_EQ(decoder.GetByteOrder(), CTypeParser::ByteOrder::Host);
+  EXPECT_EQ(decoder.GetRecordSize(), ToBytes(Record(0)).size());
+  const auto& leaves = decoder.GetLeaves();
+  ASSERT_EQ(leaves.size(), 7);
+  EXPECT_EQ(leaves[0].offset, 0);
+  EXPECT_EQ(leaves[0].type_code, TypeCode::UInt32);
+  EXPECT_EQ(leaves[1].offset, 4);
+  EXPECT_EQ(leaves[1].type_code, TypeCode::Int16);
+  EXPECT_EQ(leaves[4].offset, 10);
+  EXPECT_EQ(leaves[4].type_code, TypeCode::Float64);
+  EXPECT_EQ(leaves[5].offset, 18);
+  EXPECT_EQ(leaves[5].type_code, TypeCode::String);
+  EXPECT_EQ(leaves[6].offset, 18 + kStringMaxLength);
+
+  // Decoders are cached per type and byte order
+  const auto cached = GetRecordDecoder(RecordType(), CTypeParser::ByteOrder::Network);
+  EXPECT_EQ(cached, GetRecordDecoder(RecordType(), CTypeParser::ByteOrder::Network));
+  EXPECT_NE(cached, GetRecordDecoder(RecordType(), CTypeParser::ByteOrder::Host));
+
+  EXPECT_THROW(RecordDecoder(AnyType(0, Float32Type), CTypeParser::ByteOrder::Host),
+               InvalidOperationException);
+}
+
+TEST(RecordDecoderTest, SwapRuns)
+{
+  RecordDecoder host_decoder{RecordType(), CTypeParser::ByteOrder::Host};
+  EXPECT_TRUE(host_decoder.GetSwapRuns().empty());
+  RecordDecoder network_decoder{RecordType(), CTypeParser::ByteOrder::Network};
+  const auto& swap_runs = network_decoder.GetSwapRuns();
+  if (!IsLittleEndian())
+  {
+    EXPECT_TRUE(swap_runs.empty());
+    return;
+  }
+  // id, samples and value; the string and boolean leaves are not swapped
+  ASSERT_EQ(swap_runs.size(), 3);
+  EXPECT_EQ(swap_runs[0].offset, 0);
+  EXPECT_EQ(swap_runs[0].count, 1);
+  EXPECT_EQ(swap_runs[0].width, 4);
+  EXPECT_EQ(swap_runs[1].offset, 4);
+  EXPECT_EQ(swap_runs[1].count, 3);
+  EXPECT_EQ(swap_runs[1].width, 2);
+  EXPECT_EQ(swap_runs[2].offset, 10);
+  EXPECT_EQ(swap_runs[2].count, 1);
+  EXPECT_EQ(swap_runs[2].width, 8);
+
+  // Decoding does not modify the input
+  const auto bytes = RecordBytes(1, true);
+  const auto copy = bytes;
+  AnyValue record{RecordType()};
+  network_decoder.Decode(record, bytes.data());
+  EXPECT_EQ(record, Record(0));
+  EXPECT_EQ(bytes, copy);
+}
+
+TEST(RecordDecoderTest, ValueLookup)
+{
+  // Decoders are shared between record types that only differ in type names
+  const auto decoder = GetRecordDecoder(Record(0), CTypeParser::ByteOrder::Network);
+  EXPECT_EQ(GetRecordDecoder(RecordType(), CTypeParser::ByteOrder::Network), decoder);
+  AnyType renamed_type{{
+    {"id", UnsignedInteger32Type},
+    {"samples", AnyType(3, SignedInteger16Type, "samples_t")},
+    {"value", Float64Type},
+    {"source", StringType},
+    {"valid", BooleanType}
+  }, "other_record_t"};
+  EXPECT_EQ(GetRecordDecoder(AnyValue{renamed_type}, CTypeParser::ByteOrder::Network), decoder);
+  EXPECT_NE(GetRecordDecoder(Record(0), CTypeParser::ByteOrder::Host), decoder);
+  AnyType longer_type{{
+    {"id", UnsignedInteger32Type},
+    {"samples", AnyType(4, SignedInteger16Type)},
+    {"value", Float64Type},
+    {"source", StringType},
+    {"valid", BooleanType}
+  }, "record_t"};
+  EXPECT_NE(GetRecordDecoder(AnyValue{longer_type}, CTypeParser::ByteOrder::Network), decoder);
+}
+
+TEST(RecordDecoderTest, RecordArray)
+{
+  const std::size_t n_records = 1000;
+  for (bool network_order : {false, true})
+  {
+    const auto bytes = RecordBytes(n_records, network_order);
+    const auto records = network_order
+                       ? RecordsFromNetworkOrderBytes(RecordType(), bytes.data(), bytes.size())
+                       : RecordsFromBytes(RecordType(), bytes.data(), bytes.size());
+    ASSERT_EQ(records.NumberOfElements(), n_records);
+    EXPECT_EQ(records.ElementType(), RecordType());
+    for (uint32 idx = 0; idx < n_records; ++idx)
+    {
+      EXPECT_EQ(records[idx], Record(idx));
+    }
+  }
+  // Empty byte array
+  EXPECT_EQ(RecordsFromBytes(RecordType(), nullptr, 0).NumberOfElements(), 0);
+}
+
+TEST(RecordDecoderTest, CallerProvidedRecords)
+{
+  const std::size_t n_records = 50;
+  std::vector<AnyValue> records(n_records, AnyValue{RecordType()});
+  for (bool network_order : {false, true})
+  {
+    const auto bytes = RecordBytes(n_records, network_order);
+    if (network_order)
+    {
+      RecordsFromNetworkOrderBytes(records.data(), n_records, bytes.data(), bytes.size());
+    }
+    else
+    {
+      RecordsFromBytes(records.data(), n_records, bytes.data(), bytes.size());
+    }
+    for (uint32 idx = 0; idx < n_records; ++idx)
+    {
+      EXPECT_EQ(records[idx], Record(idx));
+    }
+  }
+  EXPECT_NO_THROW(RecordsFromBytes(records.data(), 0, nullptr, 0));
+}
+
+TEST(RecordDecoderTest, Failures)
+{
+  const auto bytes = RecordBytes(10, false);
+  // Size is not a multiple of the record size
+  EXPECT_THROW(RecordsFromBytes(RecordType(), bytes.data(), bytes.size() - 1), ParseException);
+  EXPECT_THROW(RecordsFromBytes(EmptyType, bytes.data(), bytes.size()), ParseException);
+  std::vector<AnyValue> records(10, AnyValue{RecordType()});
+  EXPECT_THROW(RecordsFromBytes(records.data(), 9, bytes.data(), bytes.size()), ParseException);
+  EXPECT_THROW(RecordsFromBytes(records.data(), 0, bytes.data(), bytes.size()), ParseException);
+
+  // Records of different types
+  records[5] = AnyValue{{
+    {"id", UnsignedInteger32Type},
+    {"samples", AnyType(3, SignedInteger32Type)}
+  }};
+  EXPECT_THROW(RecordsFromBytes(records.data(), 10, bytes.data(), bytes.size()), ParseException);
+
+  // String without terminator
+  auto corrupted = bytes;
+  const auto string_offset = GetRecordDecoder(RecordType(), CTypeParser::ByteOrder::Host)
+                               ->GetLeaves()[5].offset;
+  std::fill(corrupted.begin() + string_offset,
+            corrupted.begin() + string_offset + kStringMaxLength, 'x');
+  EXPECT_THROW(RecordsFromBytes(RecordType(), corrupted.data(), corrupted.size()), ParseException);
+}
+
+TEST(RecordDecoderTest, UnboundedArrays)
+{
+  const AnyType unbounded_type{{
+    {"id", UnsignedInteger32Type},
+    {"samples", AnyType(0, SignedInteger16Type)}
+  }, "unbounded_t"};
+  const auto bytes = RecordBytes(2, true);
+  EXPECT_THROW(GetRecordDecoder(unbounded_type, CTypeParser::ByteOrder::Network),
+               InvalidOperationException);
+  EXPECT_THROW(RecordsFromBytes(unbounded_type, bytes.data(), bytes.size()),
+               InvalidOperationException);
+  EXPECT_THROW(RecordsFromNetworkOrderBytes(unbounded_type, bytes.data(), bytes.size()),
+               InvalidOperationException);
+  std::vector<AnyValue> records(2, AnyValue{unbounded_type});
+  EXPECT_THROW(RecordsFromNetworkOrderBytes(records.data(), 2, bytes.data(), bytes.size()),
+               InvalidOperationException);
+}
+
+namespace
+{
+AnyType RecordType()
+{
+  return AnyType{{
+    {"id", UnsignedInteger32Type},
+    {"samples", AnyType(3, SignedInteger16Type)},
+    {"value", Float64Type},
+    {"source", StringType},
+    {"valid", BooleanType}
+  }, "record_t"};
+}
+
+AnyValue Record(uint32 idx)
+{
+  AnyValue result{RecordType()};
+  result["id"] = idx;
+  for (uint32 i = 0; i < 3; ++i)
+  {
+    result["samples"][i] = static_cast<int16>(idx * 3 - i);
+  }
+  result["value"] = 0.5 * idx;
+  result["source"] = "sensor_" + std::to_string(idx % 7);
+  result["valid"] = (idx % 2 == 0);
+  return result;
+}
+
+std::vector<uint8> RecordBytes(std::size_t n_records, bool network_order)
+{
+  std::vector<uint8> result;
+  for (std::size_t idx = 0; idx < n_records; ++idx)
+  {
+    const auto record = Record(static_cast<uint32>(idx));
+    const auto bytes = network_order ? ToNetworkOrderBytes(record) : ToBytes(record);
+    result.insert(result.end(), bytes.begin(), bytes.end());
+  }
+  return result;
+}
+}  // unnamed namespace
@@ -0,0 +1,153 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/low_level/scalar_array_conversion.h>
+
+#include <limits>
+#include <vector>
+
+using namespace sup::dto;
+
+namespace
+{
+// Check the array conversion against ConvertScalar for every value in src
+template <typename To, typename From>
+void CheckAgainstConvertScalar(const std::vector<From>& src);
+}
+
+TEST(ScalarArrayConversionTest, Traits)
+{
+  EXPECT_TRUE((IsWideningConversion<int64, int16>::value));
+  EXPECT_TRUE((IsWideningConversion<int32, uint16>::value));
+  EXPECT_TRUE((IsWideningConversion<float64, int64>::value));
+  EXPECT_TRUE((IsWideningConversion<float64, float32>::value));
+  EXPECT_TRUE((IsWideningConversion<boolean, float64>::value));
+  EXPECT_TRUE((IsWideningConversion<uint8, boolean>::value));
+  EXPECT_FALSE((IsWideningConversion<uint32, int32>::value));
+  EXPECT_FALSE((IsWideningConversion<int32, uint32>::value));
+  EXPECT_FALSE((IsWideningConversion<int16, int32>::value));
+  EXPECT_FALSE((IsWideningConversion<int64, float32>::value));
+  EXPECT_FALSE((IsWideningConversion<float32, float64>::value));
+}
+
+TEST(ScalarArrayConversionTest, Widening)
+{
+  std::vector<int16> src(1000);
+  for (std::size_t idx = 0; idx < src.size(); ++idx)
+  {
+    src[idx] = static_cast<int16>(static_cast<int>(idx * 37) - 15000);
+  }
+  std::vector<float64> dest(src.size());
+  EXPECT_EQ(ConvertScalarArray(dest.data(), src.data(), src.size()), src.size());
+  for (std::size_t idx = 0; idx < src.size(); ++idx)
+  {
+    EXPECT_EQ(dest[idx], static_cast<float64>(src[idx]));
+  }
+}
+
+TEST(ScalarArrayConversionTest, Narrowing)
+{
+  std::vector<int64> src(300, 100);
+  std::vector<int8> dest(src.size(), 0);
+  EXPECT_EQ(ConvertScalarArray(dest.data(), src.data(), src.size()), src.size());
+  EXPECT_EQ(dest[299], 100);
+
+  // First value that doesn't fit, in a full block and in the tail
+  src[130] = 128;
+  src[200] = -129;
+  src[290] = 1000;
+  std::vector<int8> partial(src.size(), 0);
+  EXPECT_EQ(ConvertScalarArray(partial.data(), src.data(), src.size()), 130);
+  EXPECT_EQ(partial[129], 100);
+  EXPECT_EQ(partial[130], 0);
+  EXPECT_EQ(partial[131], 0);
+  src[130] = 0;
+  src[200] = 0;
+  EXPECT_EQ(ConvertScalarArray(partial.data(), src.data(), src.size()), 290);
+  EXPECT_EQ(partial[289], 100);
+  EXPECT_EQ(partial[290], 0);
+
+  // Empty array
+  EXPECT_EQ(ConvertScalarArray(partial.data(), src.data(), 0), 0);
+}
+
+TEST(ScalarArrayConversionTest, SameResultAsConvertScalar)
+{
+  const std::vector<int64> signed_values{
+    std::numeric_limits<int64>::min(), -40000, -129, -128, -1, 0, 1, 127, 128, 255, 256, 32767,
+    32768, 65535, 65536, std::numeric_limits<int64>::max()};
+  CheckAgainstConvertScalar<int8>(signed_values);
+  CheckAgainstConvertScalar<uint8>(signed_values);
+  CheckAgainstConvertScalar<int16>(signed_values);
+  CheckAgainstConvertScalar<uint16>(signed_values);
+  CheckAgainstConvertScalar<uint64>(signed_values);
+  const std::vector<uint64> unsigned_values{
+    0, 1, 127, 128, 255, 256, 32767, 32768, 65535, 65536, std::numeric_limits<uint64>::max()};
+  CheckAgainstConvertScalar<int8>(unsigned_values);
+  CheckAgainstConvertScalar<uint8>(unsigned_values);
+  CheckAgainstConvertScalar<int32>(unsigned_values);
+  CheckAgainstConvertScalar<int64>(unsigned_values);
+  const std::vector<float64> float_values{
+    -1e300, -3e9, -129.5, -1.0, -0.5, 0.0, 0.5, 200.0, 255.5, 256.0, 3e9, 1e40, 1e300};
+  CheckAgainstConvertScalar<int8>(float_values);
+  CheckAgainstConvertScalar<uint8>(float_values);
+  CheckAgainstConvertScalar<int32>(float_values);
+  CheckAgainstConvertScalar<uint32>(float_values);
+  CheckAgainstConvertScalar<float32>(float_values);
+}
+
+namespace
+{
+template <typename To, typename From>
+void CheckAgainstConvertScalar(const std::vector<From>& src)
+{
+  for (const auto& value : src)
+  {
+    // Put the value at the end of a full block of fitting values
+    std::vector<From> values(kScalarArrayBlockSize + 10, From{});
+    values[kScalarArrayBlockSize - 1] = value;
+    std::vector<To> dest(values.size());
+    const auto n_converted = ConvertScalarArray(dest.data(), values.data(), values.size());
+    bool fits = true;
+    To expected{};
+    try
+    {
+      expected = ConvertScalar<To, From>(value);
+    }
+    catch(const InvalidConversionException&)
+    {
+      fits = false;
+    }
+    if (fits)
+    {
+      EXPECT_EQ(n_converted, values.size());
+      EXPECT_EQ(dest[kScalarArrayBlockSize - 1], expected);
+    }
+    else
+    {
+      EXPECT_EQ(n_converted, kScalarArrayBlockSize - 1);
+    }
+  }
+}
+}
@@ -0,0 +1,368 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/parse/binary_value_parser.h>
+#include <sup/dto/parse/ctype_parser.h>
+#include <sup/dto/serialize/binary_serializer.h>
+#include <sup/dto/serialize/ctype_serializer.h>
+#include <sup/dto/serialize/serialization_plan.h>
+#include <sup/dto/visit/visit_t.h>
+
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_helper.h>
+
+#include "allocation_counter.h"
+#include "test_serializers.h"
+
+using namespace sup::dto;
+
+namespace
+{
+AnyType RecordType();
+
+AnyValue RecordValue();
+
+AnyValue AllScalarsValue();
+
+template <typename Serializer>
+std::vector<uint8> VisitToBytes(const AnyValue& value, CTypeSerializer::ByteOrder byte_order);
+}  // unnamed namespace
+
+TEST(SerializationPlanTest, Instructions)
+{
+  AnyType record_type{{
+    {"id", UnsignedInteger16Type},
+    {"values", AnyType(3, Float32Type)}
+  }, "record_t"};
+  SerializationPlan plan{record_type};
+  const auto& instructions = plan.GetInstructions();
+  ASSERT_EQ(instructions.size(), 10);
+  EXPECT_EQ(instructions[0].opcode, PlanOpcode::kStructBegin);
+  EXPECT_EQ(instructions[1].opcode, PlanOpcode::kMemberBegin);
+  EXPECT_EQ(instructions[1].index, 0);
+  EXPECT_EQ(*instructions[1].member_name, "id");
+  EXPECT_EQ(instructions[2].opcode, PlanOpcode::kScalar);
+  EXPECT_EQ(instructions[2].type_code, TypeCode::UInt16);
+  EXPECT_EQ(instructions[2].width, 2);
+  EXPECT_EQ(instructions[3].opcode, PlanOpcode::kMemberEnd);
+  EXPECT_EQ(instructions[4].opcode, PlanOpcode::kMemberBegin);
+  EXPECT_EQ(instructions[4].index, 1);
+  EXPECT_EQ(*instructions[4].member_name, "values");
+  EXPECT_EQ(instructions[5].opcode, PlanOpcode::kArrayBegin);
+  EXPECT_EQ(instructions[5].index, 7);
+  EXPECT_EQ(instructions[6].opcode, PlanOpcode::kScalar);
+  EXPECT_EQ(instructions[6].type_code, TypeCode::Float32);
+  EXPECT_EQ(instructions[7].opcode, PlanOpcode::kArrayEnd);
+  EXPECT_EQ(instructions[7].index, 6);
+  EXPECT_EQ(instructions[8].opcode, PlanOpcode::kMemberEnd);
+  EXPECT_EQ(instructions[9].opcode, PlanOpcode::kStructEnd);
+  EXPECT_TRUE(plan.HasFixedSize());
+  EXPECT_EQ(plan.GetFixedSize(), 14);
+
+  // Unbounded arrays have no fixed size
+  SerializationPlan unbounded_plan{AnyType(0, record_type)};
+  EXPECT_FALSE(unbounded_plan.HasFixedSize());
+}
+
+TEST(SerializationPlanTest, SameCallbacksAsVisit)
+{
+  std::vector<AnyValue> values{
+    AnyValue{},
+    AnyValue{StringType, "text"},
+    RecordValue(),
+    AnyValue(3, RecordType()),
+    AnyValue(0, RecordType()),
+    AnyValue(AnyType(0, AnyType(2, SignedInteger8Type)))
+  };
+  values[5].AddElement(AnyValue(2, SignedInteger8Type));
+  values[5][0][1] = static_cast<int8>(-3);
+  values[4].AddElement(RecordValue());
+  values[4].AddElement(RecordValue());
+  for (const auto& value : values)
+  {
+    SimpleAnyValueSerializer visit_serializer;
+    Visit(value, visit_serializer);
+    SimpleAnyValueSerializer plan_serializer;
+    const auto plan = GetSerializationPlan(value.GetType());
+    plan->Execute<IAnyVisitor<const AnyValue>>(value, plan_serializer);
+    EXPECT_EQ(plan_serializer.GetRepresentation(), visit_serializer.GetRepresentation());
+  }
+}
+
+TEST(SerializationPlanTest, EncodeAndDecode)
+{
+  const auto value = RecordValue();
+  const auto plan = GetSerializationPlan(value.GetType());
+
+  // C-type encoding
+  CTypeSerializer serializer{CTypeSerializer::ByteOrder::Network};
+  plan->Execute<CTypeSerializer>(value, serializer);
+  const auto bytes = serializer.GetRepresentation();
+  ASSERT_TRUE(plan->HasFixedSize());
+  EXPECT_EQ(bytes.size(), plan->GetFixedSize());
+
+  // C-type decoding is the mirror image
+  AnyValue parsed{plan->GetType()};
+  CTypeParser parser{bytes.data(), bytes.size(), CTypeParser::ByteOrder::Network};
+  plan->Execute<CTypeParser>(parsed, parser);
+  EXPECT_TRUE(parser.IsFinished());
+  EXPECT_EQ(parsed, value);
+
+  // Public functions use the cached plans
+  EXPECT_EQ(AnyValueFromBinary(AnyValueToBinary(value)), value);
+  EXPECT_EQ(ToNetworkOrderBytes(value), bytes);
+}
+
+TEST(SerializationPlanTest, Cache)
+{
+  const auto plan = GetSerializationPlan(RecordType());
+  EXPECT_EQ(GetSerializationPlan(RecordType()), plan);
+  EXPECT_EQ(GetSerializationPlan(RecordValue().GetType()), plan);
+  AnyType other_type{{
+    {"id", UnsignedInteger16Type},
+    {"name", StringType}
+  }, "record_t"};
+  EXPECT_NE(GetSerializationPlan(other_type), plan);
+  EXPECT_EQ(AnyTypeHash(RecordType()), AnyTypeHash(RecordValue().GetType()));
+  EXPECT_NE(AnyTypeHash(RecordType()), AnyTypeHash(other_type));
+  EXPECT_NE(AnyTypeHash(AnyType(2, StringType)), AnyTypeHash(AnyType(3, StringType)));
+}
+
+TEST(SerializationPlanTest, ValueLookup)
+{
+  const auto value = RecordValue();
+  const auto plan = GetSerializationPlan(value);
+  EXPECT_EQ(GetSerializationPlan(value.GetType()), plan);
+  EXPECT_EQ(GetSerializationPlan(value), plan);
+  EXPECT_TRUE(plan->Matches(value));
+  EXPECT_EQ(ShapeHash(value), ShapeHash(value.GetType()));
+  EXPECT_EQ(ShapeHash(value), ShapeHash(RecordType()));
+
+  // Type names are not part of the shape
+  AnyValue renamed{AnyType{{
+    {"id", UnsignedInteger32Type},
+    {"name", StringType},
+    {"flags", AnyType(4, BooleanType, "flags_t")},
+    {"position", AnyType{{
+      {"x", Float64Type},
+      {"y", Float64Type}
+    }, "point_t"}}
+  }, "other_record_t"}};
+  EXPECT_EQ(ShapeHash(renamed), ShapeHash(value));
+  EXPECT_TRUE(plan->Matches(renamed));
+  EXPECT_EQ(GetSerializationPlan(renamed), plan);
+
+  // Member names, array lengths and string capacities are
+  AnyValue other_member{AnyType{{{"identifier", UnsignedInteger32Type}}}};
+  AnyValue same_member{AnyType{{{"id", UnsignedInteger32Type}}}};
+  EXPECT_FALSE(MatchesShape(other_member, same_member.GetType()));
+  EXPECT_TRUE(MatchesShape(same_member, same_member.GetType()));
+  AnyValue short_array{AnyType(3, BooleanType)};
+  EXPECT_FALSE(MatchesShape(short_array, AnyType(4, BooleanType)));
+  EXPECT_NE(ShapeHash(short_array), ShapeHash(AnyType(4, BooleanType)));
+  AnyValue fixed_string{FixedStringType(8), "text"};
+  EXPECT_FALSE(MatchesShape(fixed_string, FixedStringType(16)));
+  EXPECT_NE(ShapeHash(fixed_string), ShapeHash(FixedStringType(16)));
+  EXPECT_NE(GetSerializationPlan(fixed_string), GetSerializationPlan(FixedStringType(16)));
+  EXPECT_FALSE(MatchesShape(AnyValue{StringType}, FixedStringType(16)));
+}
+
+TEST(SerializationPlanTest, ScalarLeaves)
+{
+  // Plan execution dispatches on the type codes and widths of the plan, while visiting uses the
+  // scalar callbacks: both must produce the same representation
+  const auto value = AllScalarsValue();
+  const auto plan = GetSerializationPlan(value);
+  for (auto byte_order : { CTypeSerializer::ByteOrder::Host, CTypeSerializer::ByteOrder::Network })
+  {
+    CTypeSerializer serializer{byte_order};
+    plan->Execute<CTypeSerializer>(value, serializer);
+    const auto bytes = serializer.GetRepresentation();
+    EXPECT_EQ(bytes, VisitToBytes<CTypeSerializer>(value, byte_order));
+    ASSERT_EQ(bytes.size(), plan->GetFixedSize());
+
+    AnyValue parsed{value.GetType()};
+    const auto parse_order = byte_order == CTypeSerializer::ByteOrder::Host
+                               ? CTypeParser::ByteOrder::Host : CTypeParser::ByteOrder::Network;
+    CTypeParser parser{bytes.data(), bytes.size(), parse_order};
+    plan->Execute<CTypeParser>(parsed, parser);
+    EXPECT_TRUE(parser.IsFinished());
+    EXPECT_EQ(parsed, value);
+  }
+
+  // Binary encoding
+  std::vector<uint8> plan_bytes;
+  BinaryValueSerializer plan_serializer{plan_bytes};
+  plan->Execute<BinaryValueSerializer>(value, plan_serializer);
+  std::vector<uint8> visit_bytes;
+  BinaryValueSerializer visit_serializer{visit_bytes};
+  VisitStatic<BinaryValueSerializer, const AnyValue>(value, visit_serializer);
+  EXPECT_EQ(plan_bytes, visit_bytes);
+  AnyValue parsed{value.GetType()};
+  auto it = plan_bytes.cbegin();
+  BinaryValueParser parser{it, plan_bytes.cend()};
+  plan->Execute<BinaryValueParser>(parsed, parser);
+  EXPECT_TRUE(parser.IsFinished());
+  EXPECT_EQ(parsed, value);
+}
+
+TEST(SerializationPlanTest, ScalarLeafErrors)
+{
+  // String too long for its C-type representation
+  AnyValue too_long{AnyType{{{"text", StringType}}}};
+  too_long["text"] = std::string(kStringMaxLength, 'x');
+  CTypeSerializer serializer{CTypeSerializer::ByteOrder::Host};
+  EXPECT_THROW(GetSerializationPlan(too_long)->Execute<CTypeSerializer>(too_long, serializer),
+               SerializeException);
+
+  // String without terminating zero
+  AnyValue fixed_string{AnyType{{{"text", FixedStringType(4)}}}};
+  const std::vector<uint8> no_zero{'a', 'b', 'c', 'd'};
+  CTypeParser parser{no_zero.data(), no_zero.size(), CTypeParser::ByteOrder::Host};
+  EXPECT_THROW(GetSerializationPlan(fixed_string)->Execute<CTypeParser>(fixed_string, parser),
+               ParseException);
+
+  // Truncated input
+  AnyValue number{AnyType{{{"number", Float64Type}}}};
+  const std::vector<uint8> truncated(4, 0);
+  CTypeParser short_parser{truncated.data(), truncated.size(), CTypeParser::ByteOrder::Network};
+  EXPECT_THROW(GetSerializationPlan(number)->Execute<CTypeParser>(number, short_parser),
+               ParseException);
+  auto it = truncated.cbegin();
+  BinaryValueParser binary_parser{it, truncated.cend()};
+  EXPECT_THROW(GetSerializationPlan(number)->Execute<BinaryValueParser>(number, binary_parser),
+               ParseException);
+}
+
+TEST(SerializationPlanTest, NoAllocationPerLeaf)
+{
+  AnyValue value{AnyType(1000, Float64Type)};
+  for (std::size_t idx = 0; idx < value.NumberOfElements(); ++idx)
+  {
+    value[idx] = 0.5 * idx;
+  }
+  const auto plan = GetSerializationPlan(value);
+  CTypeSerializer serializer{CTypeSerializer::ByteOrder::Network};
+  serializer.Reserve(plan->GetFixedSize());
+  AllocationCounter allocations;
+  plan->Execute<CTypeSerializer>(value, serializer);
+  EXPECT_EQ(allocations.GetCount(), 0u);
+  const auto bytes = serializer.GetRepresentation();
+
+  AnyValue parsed{value.GetType()};
+  allocations.Reset();
+  CTypeParser parser{bytes.data(), bytes.size(), CTypeParser::ByteOrder::Network};
+  plan->Execute<CTypeParser>(parsed, parser);
+  EXPECT_EQ(allocations.GetCount(), 0u);
+  EXPECT_EQ(parsed, value);
+
+  // Looking up the plan from the value does not construct its type
+  allocations.Reset();
+  EXPECT_EQ(GetSerializationPlan(value), plan);
+  EXPECT_EQ(allocations.GetCount(), 0u);
+}
+
+TEST(SerializationPlanTest, WrongValue)
+{
+  const auto plan = GetSerializationPlan(RecordType());
+  AnyValue scalar{UnsignedInteger8Type, 1};
+  SimpleAnyValueSerializer serializer;
+  EXPECT_THROW(plan->Execute<IAnyVisitor<const AnyValue>>(scalar, serializer),
+               InvalidOperationException);
+}
+
+namespace
+{
+AnyType RecordType()
+{
+  return AnyType{{
+    {"id", UnsignedInteger32Type},
+    {"name", StringType},
+    {"flags", AnyType(4, BooleanType)},
+    {"position", {
+      {"x", Float64Type},
+      {"y", Float64Type}
+    }}
+  }, "record_t"};
+}
+
+AnyValue RecordValue()
+{
+  AnyValue result{RecordType()};
+  result["id"] = 7u;
+  result["name"] = "seven";
+  result["flags[2]"] = true;
+  result["position.x"] = 1.5;
+  result["position.y"] = -2.5;
+  return result;
+}
+
+AnyValue AllScalarsValue()
+{
+  AnyValue result{AnyType{{
+    {"flag", BooleanType},
+    {"letter", Character8Type},
+    {"i8", SignedInteger8Type},
+    {"u8", UnsignedInteger8Type},
+    {"i16", SignedInteger16Type},
+    {"u16", UnsignedInteger16Type},
+    {"i32", SignedInteger32Type},
+    {"u32", UnsignedInteger32Type},
+    {"i64", SignedInteger64Type},
+    {"u64", UnsignedInteger64Type},
+    {"f32", Float32Type},
+    {"f64", Float64Type},
+    {"text", StringType},
+    {"label", FixedStringType(12)},
+    {"samples", AnyType(3, SignedInteger16Type)}
+  }, "all_scalars_t"}};
+  result["flag"] = true;
+  result["letter"] = 'z';
+  result["i8"] = static_cast<int8>(-8);
+  result["u8"] = static_cast<uint8>(200);
+  result["i16"] = static_cast<int16>(-1600);
+  result["u16"] = static_cast<uint16>(60000);
+  result["i32"] = static_cast<int32>(-320000);
+  result["u32"] = static_cast<uint32>(4000000000u);
+  result["i64"] = static_cast<int64>(-6400000000);
+  result["u64"] = static_cast<uint64>(12345678901234567890u);
+  result["f32"] = 3.25f;
+  result["f64"] = -6.125;
+  result["text"] = "some text";
+  result["label"] = "label";
+  result["samples[0]"] = static_cast<int16>(1);
+  result["samples[1]"] = static_cast<int16>(-2);
+  result["samples[2]"] = static_cast<int16>(300);
+  return result;
+}
+
+template <typename Serializer>
+std::vector<uint8> VisitToBytes(const AnyValue& value, CTypeSerializer::ByteOrder byte_order)
+{
+  Serializer serializer{byte_order};
+  VisitStatic<Serializer, const AnyValue>(value, serializer);
+  return serializer.GetRepresentation();
+}
+}  // unnamed namespace
@@ -0,0 +1,179 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/struct_binding.h>
+
+#include <array>
+#include <cstring>
+
+namespace bindingtest
+{
+struct Limits
+{
+  sup::dto::int32 low;
+  sup::dto::int32 high;
+};
+
+struct Telemetry
+{
+  sup::dto::uint64 timestamp;
+  sup::dto::boolean valid;
+  char label[16];
+  std::array<sup::dto::float64, 3> position;
+  sup::dto::int16 samples[4];
+  std::array<Limits, 2> limits;
+  Limits range;
+};
+}  // namespace bindingtest
+
+SUP_DTO_STRUCT_BINDING(bindingtest::Limits, "limits_t",
+                       SUP_DTO_MEMBER(low),
+                       SUP_DTO_MEMBER(high))
+
+SUP_DTO_STRUCT_BINDING(bindingtest::Telemetry, "telemetry_t",
+                       SUP_DTO_MEMBER(timestamp),
+                       SUP_DTO_MEMBER(valid),
+                       SUP_DTO_MEMBER(label),
+                       SUP_DTO_MEMBER(position),
+                       SUP_DTO_MEMBER(samples),
+                       SUP_DTO_MEMBER(limits),
+                       SUP_DTO_MEMBER(range))
+
+using namespace sup::dto;
+using bindingtest::Limits;
+using bindingtest::Telemetry;
+
+namespace
+{
+Telemetry MakeTelemetry();
+}  // unnamed namespace
+
+TEST(StructBindingTest, BoundType)
+{
+  AnyType limits_type{{
+    {"low", SignedInteger32Type},
+    {"high", SignedInteger32Type}
+  }, "limits_t"};
+  AnyType expected{{
+    {"timestamp", UnsignedInteger64Type},
+    {"valid", BooleanType},
+    {"label", StringType},
+    {"position", AnyType(3, Float64Type)},
+    {"samples", AnyType(4, SignedInteger16Type)},
+    {"limits", AnyType(2, limits_type)},
+    {"range", limits_type}
+  }, "telemetry_t"};
+  EXPECT_EQ(GetBoundType<Telemetry>(), expected);
+  EXPECT_EQ(GetBoundType<Limits>(), limits_type);
+  EXPECT_EQ(GetBoundType<float32>(), Float32Type);
+  EXPECT_EQ(&GetBoundType<Telemetry>(), &GetBoundType<Telemetry>());
+}
+
+TEST(StructBindingTest, ToAndFromAnyValue)
+{
+  const auto telemetry = MakeTelemetry();
+  auto value = ToAnyValue(telemetry);
+  EXPECT_EQ(value.GetType(), GetBoundType<Telemetry>());
+  EXPECT_EQ(value["timestamp"], 123456789ul);
+  EXPECT_EQ(value["valid"], true);
+  EXPECT_EQ(value["label"], "sensor");
+  EXPECT_EQ(value["position[2]"], 3.5);
+  EXPECT_EQ(value["samples[3]"], int16{-4});
+  EXPECT_EQ(value["limits[1].high"], 20);
+  EXPECT_EQ(value["range.low"], -100);
+
+  value["label"] = "renamed";
+  value["position[0]"] = -1.0;
+  value["limits[0].low"] = 42;
+  const auto result = FromAnyValue<Telemetry>(value);
+  EXPECT_STREQ(result.label, "renamed");
+  EXPECT_EQ(result.position[0], -1.0);
+  EXPECT_EQ(result.limits[0].low, 42);
+  EXPECT_EQ(result.samples[3], -4);
+  EXPECT_EQ(result.range.high, 100);
+  EXPECT_EQ(ToAnyValue(result), value);
+
+  // Assign into an existing value, ignoring type and member names
+  AnyValue other{AnyType{{
+    {"low", SignedInteger32Type},
+    {"upper", SignedInteger32Type}
+  }, "other_t"}};
+  AssignFromBoundStruct(other, telemetry.range);
+  EXPECT_EQ(other["upper"], 100);
+  Limits limits{};
+  AssignToBoundStruct(limits, other);
+  EXPECT_EQ(limits.low, -100);
+}
+
+TEST(StructBindingTest, Failures)
+{
+  auto telemetry = MakeTelemetry();
+  auto value = ToAnyValue(telemetry);
+  {
+    // String doesn't fit in char array
+    auto copy = value;
+    copy["label"] = "a label that is far too long";
+    EXPECT_THROW(AssignToBoundStruct(telemetry, copy), InvalidConversionException);
+  }
+  {
+    // Leaf type mismatch
+    AnyValue limits{{
+      {"low", SignedInteger32Type},
+      {"high", SignedInteger64Type}
+    }};
+    EXPECT_THROW(AssignFromBoundStruct(limits, telemetry.range), InvalidConversionException);
+    EXPECT_THROW(AssignToBoundStruct(telemetry.range, limits), InvalidConversionException);
+  }
+  {
+    // Structure mismatch
+    AnyValue limits{{
+      {"low", SignedInteger32Type}
+    }};
+    EXPECT_THROW(AssignFromBoundStruct(limits, telemetry.range), InvalidConversionException);
+    AnyValue samples{AnyType(3, SignedInteger16Type)};
+    EXPECT_THROW(AssignFromBoundStruct(samples, telemetry.samples), InvalidConversionException);
+    EXPECT_THROW(AssignToBoundStruct(telemetry, AnyValue{42}), InvalidConversionException);
+  }
+}
+
+namespace
+{
+Telemetry MakeTelemetry()
+{
+  Telemetry result{};
+  result.timestamp = 123456789ul;
+  result.valid = true;
+  (void)std::strcpy(result.label, "sensor");
+  result.position = {1.5, 2.5, 3.5};
+  for (int16 idx = 0; idx < 4; ++idx)
+  {
+    result.samples[idx] = static_cast<int16>(-idx - 1);
+  }
+  result.limits[0] = {1, 10};
+  result.limits[1] = {2, 20};
+  result.range = {-100, 100};
+  return result;
+}
+}  // unnamed namespace
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/thread_pool.h>
+
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+using namespace sup::dto;
+
+TEST(ThreadPoolTest, Construction)
+{
+  {
+    ThreadPool pool{3};
+    EXPECT_EQ(pool.NumberOfThreads(), 3);
+  }
+  {
+    ThreadPool pool{0};
+    EXPECT_GE(pool.NumberOfThreads(), 1);
+  }
+}
+
+TEST(ThreadPoolTest, Submit)
+{
+  ThreadPool pool{2};
+  std::promise<std::thread::id> promise;
+  auto future = promise.get_future();
+  pool.Submit([&promise](){ promise.set_value(std::this_thread::get_id()); });
+  EXPECT_NE(future.get(), std::this_thread::get_id());
+
+  // Exceptions are swallowed and do not affect the workers
+  pool.Submit([](){ throw InvalidOperationException("test"); });
+  std::promise<int> other_promise;
+  auto other_future = other_promise.get_future();
+  pool.Submit([&other_promise](){ other_promise.set_value(42); });
+  EXPECT_EQ(other_future.get(), 42);
+}
+
+TEST(ThreadPoolTest, DestructorFinishesTasks)
+{
+  std::atomic<int> counter{0};
+  {
+    ThreadPool pool{2};
+    for (int i = 0; i < 100; ++i)
+    {
+      pool.Submit([&counter](){ ++counter; });
+    }
+  }
+  EXPECT_EQ(counter, 100);
+}
+
+TEST(ThreadPoolTest, ParallelFor)
+{
+  ThreadPool pool{4};
+  const std::size_t n_tasks = 1000;
+  std::vector<int> results(n_tasks, 0);
+  pool.ParallelFor(n_tasks, [&results](std::size_t idx){ results[idx] += static_cast<int>(idx); });
+  for (std::size_t idx = 0; idx < n_tasks; ++idx)
+  {
+    EXPECT_EQ(results[idx], static_cast<int>(idx));
+  }
+  // Zero tasks is a no-op
+  EXPECT_NO_THROW(pool.ParallelFor(0, [](std::size_t){ throw InvalidOperationException("no"); }));
+}
+
+TEST(ThreadPoolTest, ParallelForException)
+{
+  ThreadPool pool{4};
+  std::atomic<int> counter{0};
+  auto task = [&counter](std::size_t idx) {
+    ++counter;
+    if (idx == 10)
+    {
+      throw InvalidOperationException("task failed");
+    }
+  };
+  EXPECT_THROW(pool.ParallelFor(100, task), InvalidOperationException);
+  EXPECT_LE(counter, 100);
+
+  // Pool remains usable
+  counter = 0;
+  pool.ParallelFor(100, [&counter](std::size_t){ ++counter; });
+  EXPECT_EQ(counter, 100);
+}
+
+TEST(ThreadPoolTest, NestedParallelFor)
+{
+  ThreadPool pool{2};
+  std::atomic<int> counter{0};
+  pool.ParallelFor(8, [&pool, &counter](std::size_t) {
+    pool.ParallelFor(8, [&counter](std::size_t){ ++counter; });
+  });
+  EXPECT_EQ(counter, 64);
+}
@@ -0,0 +1,147 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sup/dto/serialize/type_keyed_cache.h>
+
+#include <string>
+
+using namespace sup::dto;
+
+namespace
+{
+using StringCache = TypeKeyedCache<std::string>;
+
+std::shared_ptr<const std::string> GetString(StringCache& cache, std::size_t hash,
+                                             const std::string& str, int& compile_count);
+}  // unnamed namespace
+
+TEST(TypeKeyedCacheTest, Construction)
+{
+  StringCache cache{4};
+  EXPECT_EQ(cache.Capacity(), 4u);
+  EXPECT_EQ(cache.Size(), 0u);
+
+  // Zero capacity is treated as one
+  StringCache minimal_cache{0};
+  EXPECT_EQ(minimal_cache.Capacity(), 1u);
+}
+
+TEST(TypeKeyedCacheTest, Hit)
+{
+  StringCache cache{4};
+  int compile_count = 0;
+  const auto first = GetString(cache, 1, "one", compile_count);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(*first, "one");
+  EXPECT_EQ(compile_count, 1);
+  EXPECT_EQ(cache.Size(), 1u);
+
+  // Second lookup returns the same object without compiling
+  const auto second = GetString(cache, 1, "one", compile_count);
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(compile_count, 1);
+  EXPECT_EQ(cache.Size(), 1u);
+}
+
+TEST(TypeKeyedCacheTest, EqualHashes)
+{
+  // The predicate distinguishes objects with the same hash
+  StringCache cache{4};
+  int compile_count = 0;
+  const auto one = GetString(cache, 7, "one", compile_count);
+  const auto two = GetString(cache, 7, "two", compile_count);
+  EXPECT_NE(one, two);
+  EXPECT_EQ(*one, "one");
+  EXPECT_EQ(*two, "two");
+  EXPECT_EQ(compile_count, 2);
+  EXPECT_EQ(cache.Size(), 2u);
+  EXPECT_EQ(GetString(cache, 7, "one", compile_count), one);
+  EXPECT_EQ(GetString(cache, 7, "two", compile_count), two);
+  EXPECT_EQ(compile_count, 2);
+}
+
+TEST(TypeKeyedCacheTest, LeastRecentlyUsedEviction)
+{
+  StringCache cache{3};
+  int compile_count = 0;
+  const auto one = GetString(cache, 1, "one", compile_count);
+  const auto two = GetString(cache, 2, "two", compile_count);
+  const auto three = GetString(cache, 3, "three", compile_count);
+  EXPECT_EQ(cache.Size(), 3u);
+  EXPECT_EQ(compile_count, 3);
+
+  // Using "one" makes "two" the least recently used entry
+  EXPECT_EQ(GetString(cache, 1, "one", compile_count), one);
+  const auto four = GetString(cache, 4, "four", compile_count);
+  EXPECT_EQ(cache.Size(), 3u);
+  EXPECT_EQ(compile_count, 4);
+  EXPECT_EQ(GetString(cache, 1, "one", compile_count), one);
+  EXPECT_EQ(GetString(cache, 3, "three", compile_count), three);
+  EXPECT_EQ(GetString(cache, 4, "four", compile_count), four);
+  EXPECT_EQ(compile_count, 4);
+
+  // "two" was evicted and is compiled again; this evicts "one"
+  const auto two_again = GetString(cache, 2, "two", compile_count);
+  EXPECT_NE(two_again, two);
+  EXPECT_EQ(*two_again, "two");
+  EXPECT_EQ(compile_count, 5);
+  EXPECT_EQ(cache.Size(), 3u);
+  EXPECT_NE(GetString(cache, 1, "one", compile_count), one);
+  EXPECT_EQ(compile_count, 6);
+
+  // Objects that were handed out stay valid after eviction
+  EXPECT_EQ(*one, "one");
+  EXPECT_EQ(*two, "two");
+}
+
+TEST(TypeKeyedCacheTest, EvictionWithEqualHashes)
+{
+  StringCache cache{2};
+  int compile_count = 0;
+  const auto one = GetString(cache, 5, "one", compile_count);
+  const auto two = GetString(cache, 5, "two", compile_count);
+  const auto three = GetString(cache, 5, "three", compile_count);
+  EXPECT_EQ(cache.Size(), 2u);
+  EXPECT_EQ(GetString(cache, 5, "two", compile_count), two);
+  EXPECT_EQ(GetString(cache, 5, "three", compile_count), three);
+  EXPECT_EQ(compile_count, 3);
+  EXPECT_NE(GetString(cache, 5, "one", compile_count), one);
+  EXPECT_EQ(compile_count, 4);
+}
+
+namespace
+{
+std::shared_ptr<const std::string> GetString(StringCache& cache, std::size_t hash,
+                                             const std::string& str, int& compile_count)
+{
+  auto matches = [&str](const std::string& cached) {
+    return cached == str;
+  };
+  auto compile = [&str, &compile_count]() {
+    ++compile_count;
+    return std::make_shared<const std::string>(str);
+  };
+  return cache.Get(hash, matches, compile);
+}
+}  // unnamed namespace
@@ -0,0 +1,238 @@
+/******************************************************************************
+ * $HeadURL: $
+ * $Id: $
+ *
+ * Project       : SUP - DTO
+ *
+ * Description   : Unit test code
+ *
+ * Author        : Walter Van Herck (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "allocation_counter.h"
+
+#include <sup/dto/anytype.h>
+#include <sup/dto/anyvalue.h>
+#include <sup/dto/anyvalue_exceptions.h>
+#include <sup/dto/anyvalue_helper.h>
+#include <sup/dto/i_any_visitor.h>
+#include <sup/dto/json_value_parser.h>
+#include <sup/dto/visit_static.h>
+
+#include <string>
+
+using namespace sup::dto;
+
+namespace
+{
+/**
+ * @brief Visitor that only counts the number of calls and does not allocate itself.
+ */
+class CountingVisitor : public IAnyVisitor<const AnyValue>
+{
+public:
+  CountingVisitor() = default;
+  ~CountingVisitor() override = default;
+
+  void EmptyProlog(const AnyValue*) override { ++n_empty; }
+  void EmptyEpilog(const AnyValue*) override {}
+  void StructProlog(const AnyValue*) override { ++n_structs; ++depth; }
+  void StructMemberSeparator() override { ++n_separators; }
+  void StructEpilog(const AnyValue*) override { --depth; }
+  void MemberProlog(const AnyValue*, const std::string& member_name) override
+  {
+    ++n_members;
+    name_length += member_name.size();
+  }
+  void MemberEpilog(const AnyValue*, const std::string&) override { --open_members; }
+  void ArrayProlog(const AnyValue*) override { ++n_arrays; ++depth; }
+  void ArrayElementSeparator() override { ++n_separators; }
+  void ArrayEpilog(const AnyValue*) override { --depth; }
+  void ScalarProlog(const AnyValue* anyvalue) override
+  {
+    ++n_scalars;
+    max_depth = depth > max_depth ? depth : max_depth;
+    sum += anyvalue->As<uint32>();
+  }
+  void ScalarEpilog(const AnyValue*) override {}
+
+  std::size_t n_empty = 0;
+  std::size_t n_structs = 0;
+  std::size_t n_members = 0;
+  long open_members = 0;
+  std::size_t n_arrays = 0;
+  std::size_t n_scalars = 0;
+  std::size_t n_separators = 0;
+  std::size_t name_length = 0;
+  std::size_t depth = 0;
+  std::size_t max_depth = 0;
+  uint64 sum = 0;
+};
+
+/**
+ * @brief Visitor resolved at compile time that only implements the callbacks it needs.
+ */
+class StaticCountingVisitor : public StaticAnyVisitor<const AnyValue>
+{
+public:
+  StaticCountingVisitor() = default;
+  ~StaticCountingVisitor() = default;
+
+  void MemberProlog(const AnyValue*, const std::string& member_name)
+  {
+    ++n_members;
+    name_length += member_name.size();
+  }
+  void ScalarProlog(const AnyValue* anyvalue)
+  {
+    ++n_scalars;
+    sum += anyvalue->As<uint32>();
+  }
+
+  std::size_t n_members = 0;
+  std::size_t n_scalars = 0;
+  std::size_t name_length = 0;
+  uint64 sum = 0;
+};
+
+AnyValue NestedValue(std::size_t depth);
+}  // unnamed namespace
+
+TEST(VisitTest, NoAllocationsPerNode)
+{
+  const std::size_t n_elements = 25000;
+  AnyType element_type{{
+    {"a", UnsignedInteger32Type},
+    {"b", UnsignedInteger32Type},
+    {"nested", {
+      {"c", UnsignedInteger32Type},
+      {"d", UnsignedInteger32Type}
+    }}
+  }, "element_t"};
+  AnyValue value{n_elements, element_type};
+  for (std::size_t idx = 0; idx < n_elements; ++idx)
+  {
+    value[idx]["a"] = 1u;
+    value[idx]["nested.d"] = 2u;
+  }
+  CountingVisitor visitor;
+  AllocationCounter allocations;
+  SerializeAnyValue(value, visitor);
+  EXPECT_EQ(allocations.GetCount(), 0);
+  EXPECT_EQ(visitor.n_scalars, 4 * n_elements);
+  EXPECT_EQ(visitor.n_structs, 2 * n_elements);
+  EXPECT_EQ(visitor.n_members, 5 * n_elements);
+  EXPECT_EQ(visitor.open_members, -static_cast<long>(5 * n_elements));
+  EXPECT_EQ(visitor.n_arrays, 1);
+  EXPECT_EQ(visitor.n_separators, (n_elements - 1) + 3 * n_elements);
+  EXPECT_EQ(visitor.name_length, 10 * n_elements);
+  EXPECT_EQ(visitor.depth, 0);
+  EXPECT_EQ(visitor.max_depth, 3);
+  EXPECT_EQ(visitor.sum, 3 * n_elements);
+}
+
+TEST(VisitTest, DeeplyNested)
+{
+  // Deeper than the number of inline frames of the visit stack
+  const std::size_t depth = 100;
+  const auto value = NestedValue(depth);
+  CountingVisitor visitor;
+  SerializeAnyValue(value, visitor);
+  EXPECT_EQ(visitor.n_structs, depth / 2);
+  EXPECT_EQ(visitor.n_arrays, depth / 2);
+  EXPECT_EQ(visitor.n_scalars, 1);
+  EXPECT_EQ(visitor.max_depth, depth);
+  EXPECT_EQ(visitor.depth, 0);
+  EXPECT_EQ(visitor.sum, 42);
+
+  // Round trip through JSON, which also uses the visitor
+  const auto json = ValuesToJSONString(value);
+  JSONAnyValueParser parser;
+  ASSERT_TRUE(parser.TypedParseString(value.GetType(), json));
+  EXPECT_EQ(parser.MoveAnyValue(), value);
+}
+
+TEST(VisitTest, VisitStatic)
+{
+  const auto value = NestedValue(10);
+  CountingVisitor dynamic_visitor;
+  SerializeAnyValue(value, dynamic_visitor);
+  StaticCountingVisitor static_visitor;
+  AllocationCounter allocations;
+  VisitStatic<StaticCountingVisitor>(value, static_visitor);
+  EXPECT_EQ(allocations.GetCount(), 0);
+  EXPECT_EQ(static_visitor.n_members, dynamic_visitor.n_members);
+  EXPECT_EQ(static_visitor.n_scalars, dynamic_visitor.n_scalars);
+  EXPECT_EQ(static_visitor.name_length, dynamic_visitor.name_length);
+  EXPECT_EQ(static_visitor.sum, 42);
+
+  // The virtual interface can also be resolved statically
+  CountingVisitor other_visitor;
+  VisitStatic<IAnyVisitor<const AnyValue>>(value, other_visitor);
+  EXPECT_EQ(other_visitor.n_structs, dynamic_visitor.n_structs);
+  EXPECT_EQ(other_visitor.n_arrays, dynamic_visitor.n_arrays);
+  EXPECT_EQ(other_visitor.n_separators, dynamic_visitor.n_separators);
+}
+
+TEST(VisitTest, EmptyAndLeafNodes)
+{
+  CountingVisitor visitor;
+  SerializeAnyValue(AnyValue{}, visitor);
+  EXPECT_EQ(visitor.n_empty, 1);
+  AnyValue empty_struct = EmptyStruct("empty_t");
+  SerializeAnyValue(empty_struct, visitor);
+  EXPECT_EQ(visitor.n_structs, 1);
+  EXPECT_EQ(visitor.n_members, 0);
+  EXPECT_EQ(visitor.depth, 0);
+}
+
+TEST(VisitTest, GetMemberName)
+{
+  AnyValue value{{
+    {"first", SignedInteger8Type},
+    {"second", StringType}
+  }};
+  EXPECT_EQ(value.GetMemberName(0), "first");
+  EXPECT_EQ(value.GetMemberName(1), "second");
+  EXPECT_THROW(value.GetMemberName(2), InvalidOperationException);
+  EXPECT_EQ(value.GetType().GetMemberName(1), "second");
+  EXPECT_THROW(value.GetType().GetMemberName(2), InvalidOperationException);
+  AnyValue scalar{UnsignedInteger32Type, 5};
+  EXPECT_THROW(scalar.GetMemberName(0), InvalidOperationException);
+  EXPECT_THROW(scalar.GetType().GetMemberName(0), InvalidOperationException);
+}
+
+namespace
+{
+AnyValue NestedValue(std::size_t depth)
+{
+  AnyValue result{UnsignedInteger32Type, 42};
+  for (std::size_t level = 0; level < depth; ++level)
+  {
+    if (level % 2 == 0)
+    {
+      AnyValue array_value{1, result.GetType()};
+      array_value[0] = result;
+      result = array_value;
+    }
+    else
+    {
+      result = AnyValue{{{"level" + std::to_string(level), result}}};
+    }
+  }
+  return result;
+}
+}  // unnamed namespace